@@ -2,7 +2,7 @@
  * This file is part of Traintastic,
  * see <https://github.com/traintastic/traintastic>.
  *
- * Copyright (C) 2020-2025 Reinder Feenstra
+ * Copyright (C) 2020-2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -23,6 +23,8 @@
 #include <cmath>
 #include <QPainter>
 #include <QPaintEvent>
+#include <QElapsedTimer>
+#include <QLoggingCategory>
 #include <QtMath>
 #include <QApplication>
 #include <QToolTip>
@@ -45,6 +47,9 @@
 #include "../misc/mimedata.hpp"
 #include "../settings/boardsettings.hpp"
 
+// enable with QT_LOGGING_RULES="traintastic.board.paint.debug=true"
+Q_LOGGING_CATEGORY(boardPaint, "traintastic.board.paint", QtWarningMsg)
+
 QRect rectToViewport(const QRect& r, const int gridSize)
 {
   QRect viewport;
@@ -103,9 +108,38 @@ BoardAreaWidget::BoardAreaWidget(std::shared_ptr<Board> board, QWidget* parent)
   connect(&BoardSettings::instance(), &SettingsBase::changed, this, &BoardAreaWidget::settingsChanged);
 
   connect(&m_blockHighlight, &BlockHighlight::colorsChanged, this,
-    [this](const QString& /*blockId*/, const QVector<Color>& /*colors*/)
+    [this](const QString& blockId, const QVector<Color>& /*colors*/)
     {
-      update();
+      // block ids can change, so verify the remembered location:
+      const auto isBlock =
+        [this, &blockId](TileLocation l)
+        {
+          const auto object = m_board->getTileObject(l);
+          return object && object->getPropertyValueString("id") == blockId;
+        };
+
+      auto it = m_blockLocations.find(blockId);
+      if(it != m_blockLocations.end() && !isBlock(it.value()))
+      {
+        m_blockLocations.erase(it);
+        it = m_blockLocations.end();
+      }
+      if(it == m_blockLocations.end())
+      {
+        for(const auto& [l, object] : m_board->tileObjects())
+        {
+          if(object->getPropertyValueString("id") == blockId)
+          {
+            it = m_blockLocations.insert(blockId, l);
+            break;
+          }
+        }
+        if(it == m_blockLocations.end())
+          return;
+      }
+      const TileLocation l = it.value();
+      if(auto itData = m_board->tileData().find(l); itData != m_board->tileData().end())
+        updateTiles(l.x, l.y, itData->second.width(), itData->second.height());
     });
 
   for(const auto& [l, object] : m_board->tileObjects())
@@ -122,14 +156,8 @@ void BoardAreaWidget::tileObjectAdded(int16_t x, int16_t y, const ObjectPtr& obj
   auto handler =
     [this, l]()
     {
-      try
-      {
-        const TileData& tileData = m_board->tileData().at(l);
-        update(updateTileRect(l.x - boardLeft(), l.y - boardTop(), tileData.width(), tileData.height(), getTileSize()));
-      }
-      catch(...)
-      {
-      }
+      if(auto it = m_board->tileData().find(l); it != m_board->tileData().end())
+        updateTiles(l.x, l.y, it->second.width(), it->second.height());
     };
 
   auto tryConnect =
@@ -166,6 +194,7 @@ void BoardAreaWidget::tileObjectAdded(int16_t x, int16_t y, const ObjectPtr& obj
       break;
 
     case TileId::RailBlock:
+      m_blockLocations.insert(object->getPropertyValueString("id"), l);
       tryConnect("name");
       tryConnect("state");
       tryConnect("sensor_states");
@@ -222,6 +251,11 @@ void BoardAreaWidget::tileObjectAdded(int16_t x, int16_t y, const ObjectPtr& obj
   }
 }
 
+void BoardAreaWidget::updateTiles(int16_t x, int16_t y, uint8_t width, uint8_t height)
+{
+  update(updateTileRect(x - boardLeft(), y - boardTop(), width, height, getTileSize()));
+}
+
 void BoardAreaWidget::setZoomLevel(int value)
 {
   value = std::clamp(value, zoomLevelMin, zoomLevelMax);
@@ -686,6 +720,12 @@ void BoardAreaWidget::paintEvent(QPaintEvent* event)
   const int tileSize = getTileSize();
   const int gridSize = tileSize - 1;
 
+  QElapsedTimer paintTimer;
+  if(boardPaint().isDebugEnabled())
+    paintTimer.start();
+
+  m_tileSprites.reset(tileSize, devicePixelRatioF(), *m_colorScheme);
+
   QPainter painter(this);
 
   const QRect viewport = rectToViewport(event->rect(), gridSize);
@@ -725,12 +765,11 @@ void BoardAreaWidget::paintEvent(QPaintEvent* event)
 
   painter.save();
 
-  for(auto it : m_board->tileData())
-    if(it.first.x + it.second.width() - 1 >= tiles.left() && it.first.x <= tiles.right() &&
-        it.first.y + it.second.height() - 1 >= tiles.top() && it.first.y <= tiles.bottom())
+  m_board->forEachTile(tiles.left(), tiles.top(), tiles.right(), tiles.bottom(),
+    [&](const std::pair<const TileLocation, TileData>& it)
     {
       if(it.first == m_mouseMoveHideTileLocation)
-        continue;
+        return;
 
       const TileId id = it.second.id();
       const TileRotate a = it.second.rotate();
@@ -739,6 +778,17 @@ void BoardAreaWidget::paintEvent(QPaintEvent* event)
       painter.setBrush(Qt::NoBrush);
 
       const QRectF r = drawTileRect(it.first.x - tileOriginX, it.first.y - tileOriginY, it.second.width(), it.second.height(), tileSize);
+
+      // single tiles that only depend on id, rotation and state are drawn from a sprite:
+      const auto drawSprite =
+        [&](uint32_t spriteState, auto&& draw)
+        {
+          if(it.second.width() == 1 && it.second.height() == 1) [[likely]]
+            painter.drawPixmap(r.topLeft(), m_tileSprites.get(TileSpriteCache::key(id, a, spriteState), draw));
+          else
+            draw(tilePainter, r);
+        };
+
       switch(id)
       {
         case TileId::RailStraight:
@@ -748,7 +798,11 @@ void BoardAreaWidget::paintEvent(QPaintEvent* event)
         case TileId::RailTunnel:
         case TileId::RailOneWay:
         case TileId::RailLink:
-          tilePainter.draw(id, r, a, isReserved);
+          drawSprite(isReserved,
+            [id, a, isReserved](TilePainter& p, const QRectF& sr)
+            {
+              p.draw(id, sr, a, isReserved);
+            });
           break;
 
         case TileId::RailTurnoutLeft45:
@@ -761,28 +815,55 @@ void BoardAreaWidget::paintEvent(QPaintEvent* event)
         case TileId::RailTurnout3Way:
         case TileId::RailTurnoutSingleSlip:
         case TileId::RailTurnoutDoubleSlip:
-          tilePainter.drawTurnout(id, r, a, static_cast<TurnoutPosition>(state), getTurnoutPosition(it.first));
+        {
+          const auto position = getTurnoutPosition(it.first);
+          drawSprite((static_cast<uint32_t>(state) << 8) | static_cast<uint32_t>(position),
+            [id, a, state, position](TilePainter& p, const QRectF& sr)
+            {
+              p.drawTurnout(id, sr, a, static_cast<TurnoutPosition>(state), position);
+            });
           break;
-
+        }
         case TileId::RailCross45:
         case TileId::RailCross90:
-          tilePainter.drawCross(id, r, a, static_cast<CrossState>(state));
+          drawSprite(state,
+            [id, a, state](TilePainter& p, const QRectF& sr)
+            {
+              p.drawCross(id, sr, a, static_cast<CrossState>(state));
+            });
           break;
 
         case TileId::RailBridge45Left:
         case TileId::RailBridge45Right:
         case TileId::RailBridge90:
-          tilePainter.drawBridge(id, r, a, state & 0x01, state & 0x02);
+          drawSprite(state & 0x03,
+            [id, a, state](TilePainter& p, const QRectF& sr)
+            {
+              p.drawBridge(id, sr, a, state & 0x01, state & 0x02);
+            });
           break;
 
         case TileId::RailSensor:
-          tilePainter.drawSensor(id, r, a, isReserved, getSensorState(it.first));
+        {
+          const auto sensorState = getSensorState(it.first);
+          drawSprite((static_cast<uint32_t>(sensorState) << 1) | (isReserved ? 1 : 0),
+            [id, a, isReserved, sensorState](TilePainter& p, const QRectF& sr)
+            {
+              p.drawSensor(id, sr, a, isReserved, sensorState);
+            });
           break;
-
+        }
         case TileId::RailSignal2Aspect:
         case TileId::RailSignal3Aspect:
-          tilePainter.drawSignal(id, r, a, isReserved, getSignalAspect(it.first));
+        {
+          const auto aspect = getSignalAspect(it.first);
+          drawSprite((static_cast<uint32_t>(aspect) << 1) | (isReserved ? 1 : 0),
+            [id, a, isReserved, aspect](TilePainter& p, const QRectF& sr)
+            {
+              p.drawSignal(id, sr, a, isReserved, aspect);
+            });
           break;
+        }
 
         case TileId::RailBlock:
         {
@@ -812,8 +893,15 @@ void BoardAreaWidget::paintEvent(QPaintEvent* event)
           break;
         }
         case TileId::RailDirectionControl:
-          tilePainter.drawDirectionControl(id, r, a, isReserved, getDirectionControlState(it.first));
+        {
+          const auto directionControlState = getDirectionControlState(it.first);
+          drawSprite((static_cast<uint32_t>(directionControlState) << 1) | (isReserved ? 1 : 0),
+            [id, a, isReserved, directionControlState](TilePainter& p, const QRectF& sr)
+            {
+              p.drawDirectionControl(id, sr, a, isReserved, directionControlState);
+            });
           break;
+        }
 
         case TileId::PushButton:
           if(auto button = m_board->getTileObject(it.first)) [[likely]]
@@ -830,8 +918,15 @@ void BoardAreaWidget::paintEvent(QPaintEvent* event)
           break;
 
         case TileId::RailDecoupler:
-          tilePainter.drawRailDecoupler(r, a, isReserved, getDecouplerState(it.first));
+        {
+          const auto decouplerState = getDecouplerState(it.first);
+          drawSprite((static_cast<uint32_t>(decouplerState) << 1) | (isReserved ? 1 : 0),
+            [a, isReserved, decouplerState](TilePainter& p, const QRectF& sr)
+            {
+              p.drawRailDecoupler(sr, a, isReserved, decouplerState);
+            });
           break;
+        }
 
         case TileId::RailNXButton:
           tilePainter.drawRailNX(r, a, isReserved, getNXButtonEnabled(it.first), getNXButtonPressed(it.first));
@@ -883,7 +978,7 @@ void BoardAreaWidget::paintEvent(QPaintEvent* event)
           assert(false);
           break;
       }
-    }
+    });
 
   painter.restore();
 
@@ -936,6 +1031,17 @@ void BoardAreaWidget::paintEvent(QPaintEvent* event)
     case MouseMoveAction::None:
       break;
   }
+
+  if(paintTimer.isValid())
+  {
+    m_paintTimeSum += paintTimer.nsecsElapsed();
+    if(++m_paintCount == 100)
+    {
+      qCDebug(boardPaint) << "average paint time:" << m_paintTimeSum / m_paintCount / 1000 << "us, sprites:" << m_tileSprites.size();
+      m_paintTimeSum = 0;
+      m_paintCount = 0;
+    }
+  }
 }
 
 void BoardAreaWidget::dragEnterEvent(QDragEnterEvent *event)
@@ -1038,6 +1144,7 @@ void BoardAreaWidget::settingsChanged()
   const auto& s = BoardSettings::instance();
 
   m_colorScheme = getBoardColorScheme(s.colorScheme.value());
+  m_tileSprites.clear(); // board settings change how tiles are drawn
 
   updateGrid();
 
@@ -23,6 +23,7 @@
 #define TRAINTASTIC_CLIENT_BOARD_BOARDAREAWIDGET_HPP
 
 #include <QWidget>
+#include <QHash>
 #include <traintastic/board/tileid.hpp>
 #include <traintastic/board/tilelocation.hpp>
 #include <traintastic/enum/tilerotate.hpp>
@@ -35,6 +36,7 @@
 #include <traintastic/enum/color.hpp>
 #include "boardareagrid.hpp"
 #include "boardcolorscheme.hpp"
+#include "tilespritecache.hpp"
 #include "../network/abstractproperty.hpp"
 #include "../network/objectptr.hpp"
 
@@ -71,8 +73,12 @@ class BoardAreaWidget : public QWidget
     AbstractProperty* m_boardBottom;
     BoardAreaGrid m_grid;
     int m_zoomLevel;
+    TileSpriteCache m_tileSprites;
+    qint64 m_paintTimeSum = 0; //!< ns, for paint time logging
+    int m_paintCount = 0;
 
     BlockHighlight& m_blockHighlight;
+    QHash<QString, TileLocation> m_blockLocations; //!< block id to tile location, for highlight repaints
 
     bool m_mouseLeftButtonPressed;
     TileLocation m_mouseLeftButtonPressedTileLocation;
@@ -99,7 +105,6 @@ class BoardAreaWidget : public QWidget
     inline int boardRight() const { return Q_LIKELY(m_boardRight) ? m_boardRight->toInt() + boardMargin: 0; }
     inline int boardBottom() const { return Q_LIKELY(m_boardBottom) ? m_boardBottom->toInt() + boardMargin: 0; }
 
-    static constexpr int getTileSize(int zoomLevel) { return 25 + zoomLevel * 5; }
     int getTileSize() const { return getTileSize(m_zoomLevel); }
     TurnoutPosition getTurnoutPosition(const TileLocation& l) const;
     SensorState getSensorState(const TileLocation& l) const;
@@ -135,6 +140,8 @@ class BoardAreaWidget : public QWidget
     static constexpr int zoomLevelMin = -2;
     static constexpr int zoomLevelMax = 15;
 
+    static constexpr int getTileSize(int zoomLevel) { return 25 + zoomLevel * 5; }
+
     BoardAreaWidget(std::shared_ptr<Board> board, QWidget* parent = nullptr);
 
     int zoomLevel() const { return m_zoomLevel; }
@@ -153,6 +160,7 @@ class BoardAreaWidget : public QWidget
 
   public slots:
     void tileObjectAdded(int16_t x, int16_t y, const ObjectPtr& object);
+    void updateTiles(int16_t x, int16_t y, uint8_t width, uint8_t height);
     void setZoomLevel(int value);
     void zoomIn() { setZoomLevel(zoomLevel() + 1); }
     void zoomOut() { setZoomLevel(zoomLevel() - 1); }
@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2020-2025 Reinder Feenstra
+ * Copyright (C) 2020-2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -355,6 +355,7 @@ BoardWidget::BoardWidget(std::shared_ptr<Board> object, QWidget* parent) :
     });
 
   connect(m_object.get(), &Board::tileDataChanged, this, [this](){ m_boardArea->update(); });
+  connect(m_object.get(), &Board::tileChanged, m_boardArea, &BoardAreaWidget::updateTiles);
   connect(m_object.get(), &Board::tileObjectAdded, m_boardArea, &BoardAreaWidget::tileObjectAdded);
   connect(m_boardArea, &BoardAreaWidget::zoomLevelChanged, this, &BoardWidget::zoomLevelChanged);
   connect(m_boardArea, &BoardAreaWidget::tileClicked, this, &BoardWidget::tileClicked);
@@ -0,0 +1,79 @@
+/**
+ * client/src/board/tileindex.cpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "tileindex.hpp"
+
+void TileIndex::clear()
+{
+  m_buckets.clear();
+}
+
+void TileIndex::insert(TileLocation l, uint8_t width, uint8_t height)
+{
+  const int right = l.x + std::max<int>(width, 1) - 1;
+  const int bottom = l.y + std::max<int>(height, 1) - 1;
+  for(int by = bucket(l.y); by <= bucket(bottom); by++)
+    for(int bx = bucket(l.x); bx <= bucket(right); bx++)
+      m_buckets[key(bx, by)].push_back({l, width, height});
+}
+
+void TileIndex::remove(TileLocation l, uint8_t width, uint8_t height)
+{
+  const int right = l.x + std::max<int>(width, 1) - 1;
+  const int bottom = l.y + std::max<int>(height, 1) - 1;
+  for(int by = bucket(l.y); by <= bucket(bottom); by++)
+  {
+    for(int bx = bucket(l.x); bx <= bucket(right); bx++)
+    {
+      auto it = m_buckets.find(key(bx, by));
+      if(it == m_buckets.end())
+        continue;
+
+      auto& entries = it->second;
+      std::erase_if(entries,
+        [l](const Entry& entry)
+        {
+          return entry.location == l;
+        });
+      if(entries.empty())
+        m_buckets.erase(it);
+    }
+  }
+}
+
+bool TileIndex::findOrigin(TileLocation& l) const
+{
+  auto it = m_buckets.find(key(bucket(l.x), bucket(l.y)));
+  if(it == m_buckets.end())
+    return false;
+
+  for(const Entry& entry : it->second)
+  {
+    if(l.x >= entry.location.x && l.x < entry.location.x + entry.width &&
+        l.y >= entry.location.y && l.y < entry.location.y + entry.height)
+    {
+      l = entry.location;
+      return true;
+    }
+  }
+  return false;
+}
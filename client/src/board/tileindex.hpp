@@ -0,0 +1,113 @@
+/**
+ * client/src/board/tileindex.hpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TRAINTASTIC_CLIENT_BOARD_TILEINDEX_HPP
+#define TRAINTASTIC_CLIENT_BOARD_TILEINDEX_HPP
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+#include <traintastic/board/tilelocation.hpp>
+
+/**
+ * \brief Spatial index of the tiles of a board
+ *
+ * The board is divided in square buckets, a tile is stored in every bucket
+ * it overlaps. An area query only visits the buckets that overlap the area,
+ * so the cost depends on the visible part of the board, not on its size.
+ */
+class TileIndex
+{
+  public:
+    static constexpr int bucketShift = 4; //!< 16x16 tiles per bucket
+
+  private:
+    struct Entry
+    {
+      TileLocation location;
+      uint8_t width;
+      uint8_t height;
+    };
+
+    std::unordered_map<uint32_t, std::vector<Entry>> m_buckets;
+
+    static constexpr int bucket(int value)
+    {
+      return value >> bucketShift; // rounds towards negative infinity
+    }
+
+    static constexpr uint32_t key(int bucketX, int bucketY)
+    {
+      return (static_cast<uint32_t>(static_cast<uint16_t>(bucketX)) << 16) | static_cast<uint16_t>(bucketY);
+    }
+
+  public:
+    void clear();
+    void insert(TileLocation l, uint8_t width, uint8_t height);
+    void remove(TileLocation l, uint8_t width, uint8_t height);
+
+    /**
+     * \brief Find the origin of the tile that covers a location
+     * \param[in,out] l Location, set to the tile origin if found
+     * \return \c true if a tile covers the location, \c false otherwise
+     */
+    bool findOrigin(TileLocation& l) const;
+
+    /**
+     * \brief Call \a func once for each tile that overlaps the area
+     *
+     * The area bounds are inclusive tile coordinates.
+     */
+    template<class Func>
+    void forEach(int left, int top, int right, int bottom, Func&& func) const
+    {
+      const int bucketLeft = bucket(left);
+      const int bucketTop = bucket(top);
+      const int bucketRight = bucket(right);
+      const int bucketBottom = bucket(bottom);
+
+      for(int by = bucketTop; by <= bucketBottom; by++)
+      {
+        for(int bx = bucketLeft; bx <= bucketRight; bx++)
+        {
+          auto it = m_buckets.find(key(bx, by));
+          if(it == m_buckets.end())
+            continue;
+
+          for(const Entry& entry : it->second)
+          {
+            if(entry.location.x + entry.width - 1 < left || entry.location.x > right ||
+                entry.location.y + entry.height - 1 < top || entry.location.y > bottom)
+              continue;
+
+            // a large tile is in multiple buckets, only report it in the first visited one:
+            if(bx != std::max(bucketLeft, bucket(entry.location.x)) || by != std::max(bucketTop, bucket(entry.location.y)))
+              continue;
+
+            func(entry.location);
+          }
+        }
+      }
+    }
+};
+
+#endif
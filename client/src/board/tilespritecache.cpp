@@ -0,0 +1,59 @@
+/**
+ * client/src/board/tilespritecache.cpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "tilespritecache.hpp"
+#include <cassert>
+#include <cmath>
+#include "boardcolorscheme.hpp"
+
+void TileSpriteCache::reset(int tileSize, qreal devicePixelRatio, const BoardColorScheme& colorScheme)
+{
+  if(m_tileSize != tileSize || m_devicePixelRatio != devicePixelRatio || m_colorScheme != &colorScheme)
+  {
+    m_sprites.clear();
+    m_tileSize = tileSize;
+    m_devicePixelRatio = devicePixelRatio;
+    m_colorScheme = &colorScheme;
+  }
+}
+
+void TileSpriteCache::clear()
+{
+  m_sprites.clear();
+}
+
+QPixmap TileSpriteCache::render(const std::function<void(TilePainter&, const QRectF&)>& draw) const
+{
+  assert(m_colorScheme);
+
+  const int size = static_cast<int>(std::ceil(m_tileSize * m_devicePixelRatio));
+  QPixmap sprite(size, size);
+  sprite.setDevicePixelRatio(m_devicePixelRatio);
+  sprite.fill(Qt::transparent);
+
+  QPainter painter(&sprite);
+  painter.setRenderHint(QPainter::Antialiasing, true);
+  TilePainter tilePainter{painter, m_tileSize, *m_colorScheme};
+  draw(tilePainter, QRectF(0, 0, m_tileSize, m_tileSize));
+
+  return sprite;
+}
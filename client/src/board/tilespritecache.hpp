@@ -0,0 +1,93 @@
+/**
+ * client/src/board/tilespritecache.hpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TRAINTASTIC_CLIENT_BOARD_TILESPRITECACHE_HPP
+#define TRAINTASTIC_CLIENT_BOARD_TILESPRITECACHE_HPP
+
+#include <functional>
+#include <unordered_map>
+#include <QPixmap>
+#include <QPainter>
+#include <traintastic/board/tileid.hpp>
+#include <traintastic/enum/tilerotate.hpp>
+#include "tilepainter.hpp"
+
+struct BoardColorScheme;
+
+/**
+ * \brief Pre-rendered single tile sprites
+ *
+ * A sprite is a tile drawn by TilePainter on a transparent pixmap, it only
+ * depends on the tile id, rotation and state, all other inputs (tile size,
+ * device pixel ratio, color scheme and board settings) are the same for all
+ * sprites. reset() drops all sprites if one of those changes.
+ */
+class TileSpriteCache
+{
+  public:
+    using Key = uint64_t;
+
+  private:
+    static constexpr size_t sizeMax = 4096; //!< all sprites are dropped if exceeded, normally never reached
+
+    std::unordered_map<Key, QPixmap> m_sprites;
+    const BoardColorScheme* m_colorScheme = nullptr;
+    int m_tileSize = 0;
+    qreal m_devicePixelRatio = 0;
+
+    QPixmap render(const std::function<void(TilePainter&, const QRectF&)>& draw) const;
+
+  public:
+    static constexpr Key key(TileId id, TileRotate rotate, uint32_t state)
+    {
+      return (static_cast<Key>(id) << 40) | (static_cast<Key>(rotate) << 32) | state;
+    }
+
+    inline size_t size() const
+    {
+      return m_sprites.size();
+    }
+
+    //! \brief Drop all sprites if one of the inputs changed
+    void reset(int tileSize, qreal devicePixelRatio, const BoardColorScheme& colorScheme);
+
+    //! \brief Drop all sprites, e.g. after a board setting change
+    void clear();
+
+    /**
+     * \brief Get the sprite for key, it is drawn using \a draw if it isn't cached yet
+     * \param[in] draw Draws the tile using the given painter in the given rectangle
+     */
+    template<class Draw>
+    const QPixmap& get(Key key, Draw&& draw)
+    {
+      if(auto it = m_sprites.find(key); it != m_sprites.end())
+        return it->second;
+
+      if(m_sprites.size() >= sizeMax)
+        m_sprites.clear();
+
+      return m_sprites.emplace(key, render(draw)).first->second;
+    }
+};
+
+#endif
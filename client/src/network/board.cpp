@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2020-2023 Reinder Feenstra
+ * Copyright (C) 2020-2023,2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -49,15 +49,7 @@ bool Board::getTileOrigin(TileLocation& l) const
   if(auto it = m_tileData.find(l); it != m_tileData.end())
     return true;
 
-  for(const auto& it : m_tileData)
-    if(l.x >= it.first.x && l.x < it.first.x + it.second.width() &&
-        l.y >= it.first.y && l.y < it.first.y + it.second.height())
-    {
-      l = it.first;
-      return true;
-    }
-
-  return false;
+  return m_tileIndex.findOrigin(l);
 }
 
 TileId Board::getTileId(TileLocation l) const
@@ -65,12 +57,9 @@ TileId Board::getTileId(TileLocation l) const
   if(auto it = m_tileData.find(l); it != m_tileData.end())
     return it->second.id();
 
-  for(const auto& it : m_tileData)
-    if(l.x >= it.first.x && l.x < it.first.x + it.second.width() &&
-        l.y >= it.first.y && l.y < it.first.y + it.second.height())
-    {
-      return it.second.id();
-    }
+  if(m_tileIndex.findOrigin(l))
+    if(auto it = m_tileData.find(l); it != m_tileData.end())
+      return it->second.id();
 
   return TileId::None;
 }
@@ -79,11 +68,8 @@ ObjectPtr Board::getTileObject(TileLocation l) const
 {
   auto itObject = m_tileObjects.find(l);
 
-  if(itObject == m_tileObjects.end())
-    for(const auto& itData : m_tileData)
-      if(l.x >= itData.first.x && l.x < itData.first.x + itData.second.width() &&
-          l.y >= itData.first.y && l.y < itData.first.y + itData.second.height())
-        itObject = m_tileObjects.find(itData.first);
+  if(itObject == m_tileObjects.end() && m_tileIndex.findOrigin(l))
+    itObject = m_tileObjects.find(l);
 
   if(itObject != m_tileObjects.end())
     return itObject->second;
@@ -119,7 +105,8 @@ void Board::getTileDataResponse(const Message& response)
   {
     TileLocation l = response.read<TileLocation>();
     TileData data = response.read<TileData>();
-    m_tileData.emplace(l, data);
+    if(m_tileData.emplace(l, data).second)
+      m_tileIndex.insert(l, data.width(), data.height());
     if(data.isActive())
       emit tileObjectAdded(l.x, l.y, m_tileObjects.emplace(l, m_connection->readObject(response)).first->second);
   }
@@ -135,14 +122,21 @@ void Board::processMessage(const Message& message)
     {
       TileLocation l = message.read<TileLocation>();
       TileData data = message.read<TileData>();
-      if(!data) // no tile
+      uint8_t width = data ? data.width() : 1;
+      uint8_t height = data ? data.height() : 1;
+      if(auto it = m_tileData.find(l); it != m_tileData.end())
       {
-        auto it = m_tileData.find(l);
-        if(it != m_tileData.end())
+        m_tileIndex.remove(l, it->second.width(), it->second.height());
+        width = std::max(width, it->second.width());
+        height = std::max(height, it->second.height());
+        if(!data) // no tile
           m_tileData.erase(it);
       }
-      else
+      if(data)
+      {
         m_tileData[l] = data;
+        m_tileIndex.insert(l, data.width(), data.height());
+      }
 
       if(data.isPassive())
       {
@@ -156,7 +150,7 @@ void Board::processMessage(const Message& message)
         emit tileObjectAdded(l.x, l.y, m_tileObjects[l]);
       }
 
-      emit tileDataChanged();
+      emit tileChanged(l.x, l.y, width, height);
       break;
     }
     default:
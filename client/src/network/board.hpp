@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2020-2023 Reinder Feenstra
+ * Copyright (C) 2020-2023,2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -31,6 +31,7 @@
 #include <traintastic/board/tilelocation.hpp>
 #include <traintastic/board/tiledata.hpp>
 #include "objectptr.hpp"
+#include "../board/tileindex.hpp"
 
 struct Error;
 
@@ -57,6 +58,7 @@ class Board final : public Object
   protected:
     TileDataMap m_tileData;
     TileObjectMap m_tileObjects;
+    TileIndex m_tileIndex;
     int m_getTileDataRequestId;
 
     void getTileDataResponse(const Message& response);
@@ -73,6 +75,18 @@ class Board final : public Object
 
     const TileObjectMap& tileObjects() const { return m_tileObjects; }
 
+    //! \brief Call \a func for each tile overlapping the area, bounds are inclusive tile coordinates
+    template<class Func>
+    void forEachTile(int left, int top, int right, int bottom, Func&& func) const
+    {
+      m_tileIndex.forEach(left, top, right, bottom,
+        [this, &func](TileLocation l)
+        {
+          if(auto it = m_tileData.find(l); it != m_tileData.end()) [[likely]]
+            func(*it);
+        });
+    }
+
     bool getTileOrigin(TileLocation& l) const;
     TileId getTileId(TileLocation l) const;
     ObjectPtr getTileObject(TileLocation l) const;
@@ -84,6 +98,8 @@ class Board final : public Object
 
   signals:
     void tileDataChanged();
+    //! \brief Single tile changed, the area covers both the old and the new tile
+    void tileChanged(int16_t x, int16_t y, uint8_t width, uint8_t height);
     void tileObjectAdded(int16_t x, int16_t y, const ObjectPtr& object);
 };
 
@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2019-2025 Reinder Feenstra
+ * Copyright (C) 2019-2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -147,13 +147,13 @@ Connection::Connection() :
   connect(m_socket, &QWebSocket::binaryMessageReceived,
     [this](const QByteArray& data)
     {
-      const Message::Header& header = *reinterpret_cast<const Message::Header*>(data.data());
-      auto message = std::make_shared<Message>(header);
-      if(header.dataSize != 0)
-      {
-        std::memcpy(message->data(), data.data() + sizeof(header), message->dataSize());
-      }
-      processMessage(message);
+      // a frame can contain multiple messages, see Message::capabilityCombinedFrames:
+      [[maybe_unused]] const size_t used = Message::splitFrame(std::span<const uint8_t>(reinterpret_cast<const uint8_t*>(data.data()), static_cast<size_t>(data.size())),
+        [this](std::span<const uint8_t> message)
+        {
+          processMessage(std::make_shared<Message>(message.data(), message.size()));
+        });
+      Q_ASSERT(used == static_cast<size_t>(data.size())); // messages never span multiple frames
     });
 }
 
@@ -227,6 +227,11 @@ void Connection::serverLog(ServerLogTableModel& model, bool enable)
 
   std::unique_ptr<Message> request{Message::newEvent(Message::Command::ServerLog)};
   request->write(enable);
+  if(enable)
+  {
+    request->write(model.m_logId);
+    request->write(model.m_nextSequence);
+  }
   send(request);
 }
 
@@ -713,6 +718,9 @@ ObjectPtr Connection::readObject(const Message& message)
         }
         message.readBlockEnd(); // end attributes
 
+        if(!message.endOfBlock()) // only if the server supports Message::capabilityItemIndex
+          item->m_index = message.read<uint16_t>();
+
         obj->m_interfaceItems.add(*item);
       }
       message.readBlockEnd(); // end item
@@ -809,12 +817,13 @@ void Connection::processMessage(const std::shared_ptr<Message> message)
         break;
       }
       case Message::Command::ObjectPropertyChanged:
+      case Message::Command::ObjectPropertyChangedByIndex:
         if(ObjectPtr object = m_objects.value(message->read<Handle>()).lock())
         {
-          const QString name = QString::fromLatin1(message->read<QByteArray>());
+          InterfaceItem* item = object->readInterfaceItem(*message);
           const ValueType valueType = message->read<ValueType>();
 
-          if(AbstractProperty* property = object->getProperty(name))
+          if(AbstractProperty* property = dynamic_cast<AbstractProperty*>(item))
           {
             switch(valueType)
             {
@@ -887,7 +896,7 @@ void Connection::processMessage(const std::shared_ptr<Message> message)
                 break;
             }
           }
-          else if(AbstractVectorProperty* vectorProperty = object->getVectorProperty(name))
+          else if(AbstractVectorProperty* vectorProperty = dynamic_cast<AbstractVectorProperty*>(item))
           {
             const int length = message->read<int>(); // read uint32_t as int, Qt uses int for length
 
@@ -902,9 +911,10 @@ void Connection::processMessage(const std::shared_ptr<Message> message)
         break;
 
       case Message::Command::ObjectAttributeChanged:
+      case Message::Command::ObjectAttributeChangedByIndex:
         if(ObjectPtr object = m_objects.value(message->read<Handle>()).lock())
         {
-          if(InterfaceItem* item = object->getInterfaceItem(QString::fromLatin1(message->read<QByteArray>())))
+          if(InterfaceItem* item = object->readInterfaceItem(*message))
           {
             AttributeName attributeName = message->read<AttributeName>();
             const ValueType type = message->read<ValueType>();
@@ -1031,8 +1041,6 @@ void Connection::processMessage(const std::shared_ptr<Message> message)
           const uint32_t rowMin = message->read<uint32_t>();
           const uint32_t rowMax = message->read<uint32_t>();
 
-          model->beginResetModel();
-
           TableModel::ColumnRow index;
           QByteArray data;
           for(index.second = rowMin; index.second <= rowMax; index.second++)
@@ -1042,11 +1050,17 @@ void Connection::processMessage(const std::shared_ptr<Message> message)
               model->m_texts[index] = Locale::instance->parse(QString::fromUtf8(data));
             }
 
-          model->endResetModel();
+          emit model->dataChanged(model->index(static_cast<int>(rowMin), static_cast<int>(columnMin)), model->index(static_cast<int>(rowMax), static_cast<int>(columnMax)));
         }
         break;
 
+      case Message::Command::TableModelRowRemoved:
+        if(TableModel* model = m_tableModels.value(message->read<Handle>(), nullptr))
+          model->removeRow(static_cast<int>(message->read<uint32_t>()));
+        break;
+
       case Message::Command::ObjectEventFired:
+      case Message::Command::ObjectEventFiredByIndex:
       case Message::Command::BoardTileDataChanged:
       {
         const auto handle = message->read<Handle>();
@@ -1077,6 +1091,7 @@ void Connection::socketConnected()
       {
         setState(State::CreatingSession);
         std::unique_ptr<Message> newSessionRequest{Message::newRequest(Message::Command::NewSession)};
+        newSessionRequest->write(Message::capabilityItemIndex | Message::capabilityCombinedFrames | Message::capabilityServerLogSequence | Message::capabilityTableModelRowRemoved);
         send(newSessionRequest,
           [this](const std::shared_ptr<Message> newSessionResonse)
           {
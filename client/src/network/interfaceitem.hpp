@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2019-2021,2024 Reinder Feenstra
+ * Copyright (C) 2019-2021,2024,2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -38,14 +38,18 @@ class InterfaceItem : public QObject
 
   protected:
     const QString m_name;
+    uint16_t m_index = noIndex; //!< server side index, if the server supports it
     QMap<AttributeName, QVariant> m_attributes;
 
   public:
+    static constexpr uint16_t noIndex = UINT16_MAX;
+
     explicit InterfaceItem(Object& object, const QString& name);
 
     const Object& object() const;
     Object& object();
     const QString& name() const { return m_name; }
+    uint16_t index() const { return m_index; }
     QString displayName() const;
     QString helpText() const;
 
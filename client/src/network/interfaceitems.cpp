@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2019-2025 Reinder Feenstra
+ * Copyright (C) 2019-2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -71,4 +71,10 @@ void InterfaceItems::add(InterfaceItem& item)
 {
   m_items.insert(item.name(), &item);
   m_itemOrder.append(item.name());
+  if(item.index() != InterfaceItem::noIndex)
+  {
+    if(item.index() >= m_itemsByIndex.size())
+      m_itemsByIndex.resize(item.index() + 1, nullptr);
+    m_itemsByIndex[item.index()] = &item;
+  }
 }
@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2019-2025 Reinder Feenstra
+ * Copyright (C) 2019-2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -23,6 +23,7 @@
 #ifndef TRAINTASTIC_CLIENT_NETWORK_INTERFACEITEMS_HPP
 #define TRAINTASTIC_CLIENT_NETWORK_INTERFACEITEMS_HPP
 
+#include <vector>
 #include <QMap>
 #include <QStringList>
 
@@ -33,6 +34,7 @@ class InterfaceItems
   protected:
     QMap<QString, InterfaceItem*> m_items;
     QStringList m_itemOrder;
+    std::vector<InterfaceItem*> m_itemsByIndex; //!< indexed by InterfaceItem::index()
 
   public:
     const QStringList& names() const { return m_itemOrder; }
@@ -44,6 +46,11 @@ class InterfaceItems
 
     inline InterfaceItem* find(const QString& name) const { return m_items.value(name, nullptr); }
 
+    inline InterfaceItem* findByIndex(uint16_t index) const
+    {
+      return index < m_itemsByIndex.size() ? m_itemsByIndex[index] : nullptr;
+    }
+
     void add(InterfaceItem& item);
 };
 
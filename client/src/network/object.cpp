@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2019-2024 Reinder Feenstra
+ * Copyright (C) 2019-2024,2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -58,6 +58,20 @@ AbstractProperty* Object::getProperty(const QString& name)
   return dynamic_cast<AbstractProperty*>(m_interfaceItems.find(name));
 }
 
+InterfaceItem* Object::readInterfaceItem(const Message& message)
+{
+  switch(message.command())
+  {
+    case Message::Command::ObjectPropertyChangedByIndex:
+    case Message::Command::ObjectAttributeChangedByIndex:
+    case Message::Command::ObjectEventFiredByIndex:
+      return m_interfaceItems.findByIndex(message.read<uint16_t>());
+
+    default:
+      return m_interfaceItems.find(QString::fromLatin1(message.read<QByteArray>()));
+  }
+}
+
 bool Object::getPropertyValueBool(const QString& name, bool defaultValue) const
 {
   if(const auto* property = getProperty(name); property && property->type() == ValueType::Boolean)
@@ -180,8 +194,9 @@ void Object::processMessage(const Message& message)
   switch(message.command())
   {
     case Message::Command::ObjectEventFired:
+    case Message::Command::ObjectEventFiredByIndex:
     {
-      if(Event* event = getEvent(QString::fromLatin1(message.read<QByteArray>())))
+      if(Event* event = dynamic_cast<Event*>(readInterfaceItem(message)))
       {
         const auto& argumentTypes = event->argumentTypes();
         const auto argumentCount = message.read<uint32_t>();
@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2019-2024 Reinder Feenstra
+ * Copyright (C) 2019-2024,2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -59,6 +59,9 @@ class Object : public QObject
     virtual void created() {}
     virtual void processMessage(const Message& message);
 
+    //! \brief Read item name or index, depending on the message command, and find the item
+    InterfaceItem* readInterfaceItem(const Message& message);
+
   public:
     explicit Object(std::shared_ptr<Connection> connection, Handle handle, const QString& classId);
     Object(const Object&) = delete;
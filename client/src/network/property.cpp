@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2019-2021,2023-2024 Reinder Feenstra
+ * Copyright (C) 2019-2021,2023-2024,2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -25,12 +25,20 @@
 #include "object.hpp"
 #include "error.hpp"
 
+static void writeItem(Message& message, const Property& property)
+{
+  if(property.index() != InterfaceItem::noIndex)
+    message.write(property.index());
+  else
+    message.write(property.name().toLatin1());
+}
+
 template<class T>
 static void setPropertyValue(Property& property, const T& value)
 {
-  auto event = Message::newEvent(Message::Command::ObjectSetProperty);
+  auto event = Message::newEvent(property.index() != InterfaceItem::noIndex ? Message::Command::ObjectSetPropertyByIndex : Message::Command::ObjectSetProperty);
   event->write(static_cast<Object*>(property.parent())->handle());
-  event->write(property.name().toLatin1());
+  writeItem(*event, property);
 
   if constexpr(std::is_same_v<T, bool>)
   {
@@ -61,9 +69,9 @@ static void setPropertyValue(Property& property, const T& value)
 template<class T>
 [[nodiscard]] static int setPropertyValue(Property& property, const T& value, std::function<void(std::optional<Error>)> callback)
 {
-  auto request = Message::newRequest(Message::Command::ObjectSetProperty);
+  auto request = Message::newRequest(property.index() != InterfaceItem::noIndex ? Message::Command::ObjectSetPropertyByIndex : Message::Command::ObjectSetProperty);
   request->write(static_cast<Object*>(property.parent())->handle());
-  request->write(property.name().toLatin1());
+  writeItem(*request, property);
 
   if constexpr(std::is_same_v<T, bool>)
   {
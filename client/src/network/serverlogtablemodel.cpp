@@ -38,12 +38,21 @@ ServerLogTableModel::ServerLogTableModel(std::shared_ptr<Connection> connection)
   , m_iconCritical{Theme::getIcon("log.critical")}
   , m_iconFatal{Theme::getIcon("log.fatal")}
 {
+  m_logId = s_cache.logId;
+  m_nextSequence = s_cache.nextSequence;
+  m_logs = std::move(s_cache.logs);
+  s_cache.logs.clear();
+
   m_connection->serverLog(*this, true);
 }
 
 ServerLogTableModel::~ServerLogTableModel()
 {
   m_connection->serverLog(*this, false);
+
+  s_cache.logId = m_logId;
+  s_cache.nextSequence = m_nextSequence;
+  s_cache.logs = std::move(m_logs);
 }
 
 int ServerLogTableModel::rowCount(const QModelIndex& parent) const
@@ -106,14 +115,29 @@ void ServerLogTableModel::processMessage(const Message& message)
 
   const auto logsSize = m_logs.size();
 
-  const int remove = message.read<int>();
-  for(int i = 0; i < remove; i++)
-    m_logs.removeFirst();
+  const auto logId = message.read<uint64_t>();
+  const auto firstSequence = message.read<uint64_t>(); // oldest log the server still has
+  auto sequence = message.read<uint64_t>();
+
+  if(logId != m_logId) // server restarted, can't resume
+  {
+    m_logs.clear();
+    m_logId = logId;
+  }
+
+  while(!m_logs.isEmpty() && (m_logs.first().sequence < firstSequence || m_logs.last().sequence >= sequence))
+  {
+    if(m_logs.first().sequence < firstSequence)
+      m_logs.removeFirst();
+    else
+      m_logs.removeLast();
+  }
 
-  const int added = message.read<int>();
-  for(int i = 0; i < added; i++)
+  const auto count = message.read<uint32_t>();
+  for(uint32_t i = 0; i < count; i++)
   {
     Log log;
+    log.sequence = sequence++;
     log.time = message.read<int64_t>();
     log.object = QString::fromLatin1(message.read<QByteArray>());
     log.code = message.read<LogMessage>();
@@ -123,6 +147,7 @@ void ServerLogTableModel::processMessage(const Message& message)
       log.message = log.message.arg(QString::fromUtf8(message.read<QByteArray>()));
     m_logs.append(log);
   }
+  m_nextSequence = sequence;
 
   endResetModel();
 
@@ -41,14 +41,27 @@ class ServerLogTableModel final : public QAbstractTableModel
   private:
     struct Log
     {
+      uint64_t sequence;
       int64_t time; //!< us since unix epoch
       QString object;
       LogMessage code;
       QString message;
     };
 
+    //! \brief Log of the last model, so a new model (e.g. after reconnecting) only needs what is missed
+    struct Cache
+    {
+      uint64_t logId = 0;
+      uint64_t nextSequence = 0;
+      QList<Log> logs;
+    };
+
+    inline static Cache s_cache;
+
     const std::array<QString, 4> m_columnHeaders;
     std::shared_ptr<Connection> m_connection;
+    uint64_t m_logId = 0; //!< identifies the server log the sequence numbers belong to
+    uint64_t m_nextSequence = 0;
     QList<Log> m_logs;
     int m_rowCount;
     QIcon m_iconDebug;
@@ -125,6 +125,33 @@ void TableModel::setRowCount(int value)
   }
 }
 
+void TableModel::removeRow(int row)
+{
+  Q_ASSERT(row >= 0 && row < m_rowCount);
+
+  beginRemoveRows(QModelIndex(), row, row);
+
+  // shift cached texts of rows below the removed row up:
+  QMap<ColumnRow, QString> texts;
+  for(auto it = m_texts.cbegin(); it != m_texts.cend(); ++it)
+  {
+    const int r = static_cast<int>(it.key().second);
+    if(r < row)
+      texts.insert(it.key(), it.value());
+    else if(r > row)
+      texts.insert(ColumnRow(it.key().first, it.key().second - 1), it.value());
+  }
+  m_texts = std::move(texts);
+  m_rowCount--;
+
+  endRemoveRows();
+
+  if(m_regionAll)
+  {
+    updateRegionAll();
+  }
+}
+
 void TableModel::updateRegionAll()
 {
   if(columnCount() == 0 || rowCount() == 0)
@@ -56,6 +56,7 @@ class TableModel final : public QAbstractTableModel
 
     void setColumnHeaders(const QVector<QString>& values);
     void setRowCount(int value);
+    void removeRow(int row);
 
     void updateRegionAll();
 
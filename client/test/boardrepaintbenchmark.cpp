@@ -0,0 +1,227 @@
+/**
+ * client/test/boardrepaintbenchmark.cpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/**
+ * \file
+ * \brief Offscreen board repaint benchmark
+ *
+ * Repaints areas of a large board into a QImage using TilePainter and
+ * TileSpriteCache like BoardAreaWidget does: track and turnouts are blitted
+ * from sprites, blocks are drawn directly. Each area is painted once by
+ * scanning all tiles (as the board area widget did before) and once through
+ * the TileIndex, at several zoom levels. The area sizes match a single tile
+ * change, a block highlight and a full viewport. Run manually, it prints
+ * the average time per repaint.
+ */
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <unordered_map>
+#include <vector>
+#include <QApplication>
+#include <QImage>
+#include <QPainter>
+#include "../src/board/boardareawidget.hpp"
+#include "../src/board/boardcolorscheme.hpp"
+#include "../src/board/tileindex.hpp"
+#include "../src/board/tilepainter.hpp"
+#include "../src/board/tilespritecache.hpp"
+
+namespace {
+
+constexpr int boardSize = 1000; //!< width and height in tiles
+constexpr int tileCount = 50000;
+constexpr int repaintCount = 200;
+constexpr QSize viewportSize{1280, 800}; //!< pixels
+
+struct Tile
+{
+  TileLocation location;
+  TileId id;
+  TileRotate rotate;
+  uint8_t width;
+  uint8_t height;
+};
+
+struct Area
+{
+  int left;
+  int top;
+  int right; //!< inclusive
+  int bottom; //!< inclusive
+};
+
+using TileMap = std::unordered_map<TileLocation, Tile, TileLocationHash>;
+
+//! \brief Same tile rectangle as BoardAreaWidget, excludes grid/border
+QRectF drawTileRect(int x, int y, int w, int h, int tileSize)
+{
+  return QRectF(x * (tileSize - 1), y * (tileSize - 1), 1 + w * (tileSize - 1), 1 + h * (tileSize - 1));
+}
+
+void drawTile(QPainter& painter, TilePainter& tilePainter, TileSpriteCache& sprites, const Tile& tile, const Area& area, int tileSize)
+{
+  const QRectF r = drawTileRect(tile.location.x - area.left, tile.location.y - area.top, tile.width, tile.height, tileSize);
+  const TileId id = tile.id;
+  const TileRotate a = tile.rotate;
+
+  switch(id)
+  {
+    case TileId::RailBlock:
+      tilePainter.drawBlock(id, r, a);
+      break;
+
+    case TileId::RailTurnoutLeft45:
+    case TileId::RailTurnoutRight45:
+      painter.drawPixmap(r.topLeft(), sprites.get(TileSpriteCache::key(id, a, 0),
+        [id, a](TilePainter& p, const QRectF& sr)
+        {
+          p.drawTurnout(id, sr, a);
+        }));
+      break;
+
+    default:
+      painter.drawPixmap(r.topLeft(), sprites.get(TileSpriteCache::key(id, a, 0),
+        [id, a](TilePainter& p, const QRectF& sr)
+        {
+          p.draw(id, sr, a);
+        }));
+      break;
+  }
+}
+
+template<class ForEachTile>
+void run(const char* name, int zoomLevel, int areaSize, const std::vector<Area>& areas, ForEachTile&& forEachTile)
+{
+  const int tileSize = BoardAreaWidget::getTileSize(zoomLevel);
+  const BoardColorScheme& colorScheme = BoardColorScheme::dark;
+  const QSize size = (areaSize == 0) ? viewportSize : QSize(areaSize * (tileSize - 1) + 1, areaSize * (tileSize - 1) + 1);
+  QImage image(size, QImage::Format_ARGB32_Premultiplied);
+  TileSpriteCache sprites;
+  sprites.reset(tileSize, 1.0, colorScheme);
+  size_t tilesDrawn = 0;
+
+  const auto start = std::chrono::steady_clock::now();
+  for(const Area& area : areas)
+  {
+    image.fill(colorScheme.background);
+    QPainter painter(&image);
+    painter.setRenderHint(QPainter::Antialiasing, true);
+    TilePainter tilePainter{painter, tileSize, colorScheme};
+    forEachTile(area,
+      [&](const Tile& tile)
+      {
+        drawTile(painter, tilePainter, sprites, tile, area, tileSize);
+        tilesDrawn++;
+      });
+  }
+  const auto elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+  std::printf("%-6s zoom %3d (%2d px) %4dx%-4d px: %10.1f us/repaint, %6.1f tiles/repaint, %3zu sprites\n",
+    name, zoomLevel, tileSize, size.width(), size.height(),
+    elapsed / static_cast<double>(areas.size()), static_cast<double>(tilesDrawn) / static_cast<double>(areas.size()), sprites.size());
+}
+
+}
+
+int main(int argc, char* argv[])
+{
+  if(qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+    qputenv("QT_QPA_PLATFORM", "offscreen");
+  QApplication app(argc, argv);
+
+  std::mt19937 random(42); // fixed seed, same board every run
+  std::uniform_int_distribution<int> position(0, boardSize - 1);
+  std::uniform_int_distribution<int> rotation(0, 3);
+  static constexpr std::array<TileId, 4> singleTileIds{TileId::RailStraight, TileId::RailCurve45, TileId::RailTurnoutLeft45, TileId::RailTurnoutRight45};
+
+  // mostly single tiles, some blocks:
+  TileMap tiles;
+  TileIndex index;
+  while(tiles.size() < static_cast<size_t>(tileCount))
+  {
+    const bool block = (tiles.size() % 20 == 0);
+    const TileLocation location{static_cast<int16_t>(position(random)), static_cast<int16_t>(position(random))};
+    const Tile tile{
+      location,
+      block ? TileId::RailBlock : singleTileIds[tiles.size() % singleTileIds.size()],
+      block ? TileRotate::Deg90 : static_cast<TileRotate>(rotation(random) * 2),
+      static_cast<uint8_t>(block ? 5 : 1),
+      1};
+    bool free = true;
+    index.forEach(tile.location.x, tile.location.y, tile.location.x + tile.width - 1, tile.location.y,
+      [&free](TileLocation)
+      {
+        free = false;
+      });
+    if(!free)
+      continue;
+    tiles.emplace(tile.location, tile);
+    index.insert(tile.location, tile.width, tile.height);
+  }
+
+  for(int zoomLevel : {BoardAreaWidget::zoomLevelMin, 0, 5, BoardAreaWidget::zoomLevelMax})
+  {
+    const int tileSize = BoardAreaWidget::getTileSize(zoomLevel);
+
+    for(int areaSize : {1, 5, 0}) // 0 is a full viewport
+    {
+      const int areaWidth = (areaSize == 0) ? viewportSize.width() / (tileSize - 1) + 1 : areaSize;
+      const int areaHeight = (areaSize == 0) ? viewportSize.height() / (tileSize - 1) + 1 : areaSize;
+      std::uniform_int_distribution<int> originX(0, boardSize - areaWidth);
+      std::uniform_int_distribution<int> originY(0, boardSize - areaHeight);
+      std::vector<Area> areas;
+      for(int i = 0; i < repaintCount; i++)
+      {
+        const int left = originX(random);
+        const int top = originY(random);
+        areas.push_back({left, top, left + areaWidth - 1, top + areaHeight - 1});
+      }
+
+      run("scan", zoomLevel, areaSize, areas,
+        [&tiles](const Area& area, auto&& draw)
+        {
+          for(const auto& [l, tile] : tiles)
+          {
+            if(l.x + tile.width - 1 < area.left || l.x > area.right || l.y + tile.height - 1 < area.top || l.y > area.bottom)
+              continue;
+            draw(tile);
+          }
+        });
+
+      run("index", zoomLevel, areaSize, areas,
+        [&tiles, &index](const Area& area, auto&& draw)
+        {
+          index.forEach(area.left, area.top, area.right, area.bottom,
+            [&](TileLocation l)
+            {
+              if(auto it = tiles.find(l); it != tiles.end())
+                draw(it->second);
+            });
+        });
+    }
+  }
+
+  return 0;
+}
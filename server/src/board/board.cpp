@@ -26,6 +26,7 @@
 #include "map/link.hpp"
 #include "tile/tiles.hpp"
 #include "tile/hidden/hiddencrossoverrailtile.hpp"
+#include "tile/rail/linkrailtile.hpp"
 #include "../core/method.tpp"
 #include "../core/objectproperty.tpp"
 #include "../world/world.hpp"
@@ -112,7 +113,7 @@ Board::Board(World& world, std::string_view _id) :
 
       tileDataChanged(*this, tile->location(), tile->data());
       updateSize();
-      m_modified = true;
+      addModified(tile->location(), tile->width, tile->height);
       return true;
     }},
   moveTile{*this, "move_tile",
@@ -164,6 +165,7 @@ Board::Board(World& world, std::string_view _id) :
           }
 
       // remove tile at tile origin
+      addModified(tile->location(), tile->width, tile->height);
       removeTile(tile->location().x, tile->location().y);
 
       // set new params
@@ -184,7 +186,7 @@ Board::Board(World& world, std::string_view _id) :
       tileDataChanged(*this, tile->location(), tile->data());
 
       updateSize();
-      m_modified = true;
+      addModified(tile->location(), tile->width, tile->height);
       return true;
     }},
   resizeTile{*this, "resize_tile",
@@ -233,7 +235,7 @@ Board::Board(World& world, std::string_view _id) :
       }
 
       tileDataChanged(*this, tile->location(), tile->data());
-      m_modified = true;
+      addModified(tile->location(), std::max(width, oldWidth), std::max(height, oldHeight));
       return true;
     }},
   deleteTile{*this, "delete_tile",
@@ -242,10 +244,10 @@ Board::Board(World& world, std::string_view _id) :
       auto tile = getTile({x, y});
       if(tile)
       {
+        addModified(tile->location(), tile->width, tile->height);
         removeTile(x, y);
         tile->destroy();
         updateSize();
-        m_modified = true;
       }
       return true;
     }},
@@ -367,8 +369,7 @@ void Board::loaded()
 {
   IdObject::loaded();
 
-  m_modified = true;
-  modified();
+  updateAllLinks();
 }
 
 void Board::modified()
@@ -376,97 +377,218 @@ void Board::modified()
   if(!m_modified)
     return;
 
-  auto updateLink =
-    [this](const std::shared_ptr<Tile>& startTile, const Connector& startConnector)
+  updateLinks(getModifiedNodeTiles());
+
+  m_modifiedLocations.clear();
+  m_modified = false;
+}
+
+void Board::tileModified(const Tile& tile)
+{
+  addModified(tile.location(), tile.width, tile.height);
+}
+
+void Board::addModified(TileLocation location, uint8_t width, uint8_t height)
+{
+  const int16_t x2 = location.x + width;
+  const int16_t y2 = location.y + height;
+  for(int16_t x = location.x; x < x2; x++)
+    for(int16_t y = location.y; y < y2; y++)
+      m_modifiedLocations.emplace(TileLocation{x, y});
+  m_modified = true;
+}
+
+std::vector<std::shared_ptr<Tile>> Board::getModifiedNodeTiles()
+{
+  std::vector<std::shared_ptr<Tile>> nodeTiles;
+  std::unordered_set<const Tile*> visited;
+  std::unordered_set<TileLocation, TileLocationHash> crossOvers;
+  std::vector<TileLocation> locations;
+  std::vector<Connector> connectors;
+
+  // a link can only change if it passes, or ends at, a modified location or one of its neighbours.
+  // neighbours are included as the crossover detection looks at the tiles next to the rail:
+  locations.reserve(m_modifiedLocations.size() * 9);
+  for(const auto& location : m_modifiedLocations)
+    for(int16_t dx = -1; dx <= 1; dx++)
+      for(int16_t dy = -1; dy <= 1; dy++)
+        locations.emplace_back(location.adjusted(dx, dy));
+
+  while(!locations.empty())
+  {
+    auto tile = getTile(locations.back());
+    locations.pop_back();
+
+    if(!tile || !visited.emplace(tile.get()).second)
+      continue;
+
+    if(tile->node())
     {
-      assert(startTile->node());
+      nodeTiles.emplace_back(std::move(tile));
+      continue;
+    }
 
-      std::vector<std::shared_ptr<Tile>> tiles;
-      std::vector<Connector> connectors;
-      connectors.reserve(2);
+    // follow the rail in both directions to find the nodes it links:
+    connectors.clear();
+    tile->getConnectors(connectors);
+    for(const auto& connector : connectors)
+    {
+      auto result = trace(*tile, connector);
+      for(const auto& t : result.tiles)
+        visited.emplace(t.get()); // same rail, no need to follow it again
 
-      Connector connector{startConnector.opposite()};
-      while(auto nextTile = getTile(connector.location))
+      if(result.tile)
       {
-        if(isIntercardinal(connector.direction)) // check for crossover
-        {
-          auto prevTile = getTile(TileLocation{nextTile->x, nextTile->y} + connector.direction);
-          assert(prevTile);
-          auto otherTile1 = getTile({prevTile->x, nextTile->y});
-          auto otherTile2 = getTile({nextTile->x, prevTile->y});
+        if(visited.emplace(result.tile.get()).second)
+          nodeTiles.emplace_back(std::move(result.tile));
+      }
+      else if(result.crossOver && crossOvers.emplace(*result.crossOver).second)
+      {
+        // the other rail of the crossover can create or remove it, so follow that one too:
+        locations.emplace_back(*result.crossOver);
+        locations.emplace_back(result.crossOver->adjusted(1, 0));
+        locations.emplace_back(result.crossOver->adjusted(0, 1));
+        locations.emplace_back(result.crossOver->adjusted(1, 1));
+      }
+    }
+  }
 
-          if(otherTile1 && otherTile2)
-          {
-            const auto perpendicular =
-              (connector.direction == Connector::Direction::NorthEast) || (connector.direction == Connector::Direction::SouthWest)
-              ? ~rotate90cw(connector.direction) : rotate90cw(connector.direction);
+  return nodeTiles;
+}
 
-            auto otherConnector1 = otherTile1->getConnector(perpendicular);
-            auto otherConnector2 = otherTile2->getConnector(~perpendicular);
+Board::Trace Board::trace(const Tile& startTile, const Connector& startConnector)
+{
+  Trace result;
+  std::vector<Connector> connectors;
+  connectors.reserve(2);
 
-            if(otherConnector1 && otherConnector2) // crossover found!
-            {
-              const TileLocation topLeft{std::min<int16_t>(prevTile->x, nextTile->x), std::min<int16_t>(prevTile->y, nextTile->y)};
-              auto it = m_railCrossOver.find(topLeft);
-              if(it == m_railCrossOver.end())
-              {
-                it = m_railCrossOver.emplace(topLeft, std::make_shared<HiddenCrossOverRailTile>(world())).first;
-                it->second->x.setValueInternal(topLeft.x);
-                it->second->y.setValueInternal(topLeft.y);
-              }
-              auto& crossOver = it->second;
-              auto crossOverConnector = crossOver->getConnector(connector.direction);
-              assert(crossOverConnector);
-
-              auto link = std::make_shared<Link>(std::move(tiles));
-              link->connect(*startTile->node(), startConnector, *crossOver->node(), *crossOverConnector);
-              return;
-            }
-          }
-        }
+  Connector connector{startConnector.opposite()};
+  while(auto nextTile = getTile(connector.location))
+  {
+    if(isIntercardinal(connector.direction)) // check for crossover
+    {
+      auto prevTile = getTile(TileLocation{nextTile->x, nextTile->y} + connector.direction);
+      assert(prevTile);
+      auto otherTile1 = getTile({prevTile->x, nextTile->y});
+      auto otherTile2 = getTile({nextTile->x, prevTile->y});
 
-        if(nextTile->node())
-        {
-          auto link = std::make_shared<Link>(std::move(tiles));
-          link->connect(*startTile->node(), startConnector, *nextTile->node(), connector);
-          return;
-        }
-        tiles.emplace_back(nextTile);
-        connectors.clear();
-        nextTile->getConnectors(connectors);
-        if(connectors.size() == 2)
-        {
-          assert(connectors[0] == connector || connectors[1] == connector);
-          connector = connectors[connectors[0] == connector ? 1 : 0].opposite();
-        }
-        else
+      if(otherTile1 && otherTile2)
+      {
+        const auto perpendicular =
+          (connector.direction == Connector::Direction::NorthEast) || (connector.direction == Connector::Direction::SouthWest)
+          ? ~rotate90cw(connector.direction) : rotate90cw(connector.direction);
+
+        auto otherConnector1 = otherTile1->getConnector(perpendicular);
+        auto otherConnector2 = otherTile2->getConnector(~perpendicular);
+
+        if(otherConnector1 && otherConnector2) // crossover found!
         {
-          assert(connectors.size() == 1);
-          assert(connectors[0] == connector);
-          break;
+          result.crossOver = TileLocation{std::min<int16_t>(prevTile->x, nextTile->x), std::min<int16_t>(prevTile->y, nextTile->y)};
+          result.connector = connector;
+          return result;
         }
       }
+    }
 
-      startTile->node()->get().disconnect(startConnector);
+    connectors.clear();
+    nextTile->getConnectors(connectors);
+    if(std::find(connectors.begin(), connectors.end(), connector) == connectors.end())
+      break; // tile isn't connected to the rail
+
+    if(nextTile->node())
+    {
+      result.tile = std::move(nextTile);
+      result.connector = connector;
+      return result;
+    }
+    if(nextTile.get() == &startTile) // rail loop without any node
+      break;
+    result.tiles.emplace_back(nextTile);
+    if(connectors.size() == 2)
+    {
+      connector = connectors[connectors[0] == connector ? 1 : 0].opposite();
+    }
+    else
+    {
+      assert(connectors.size() == 1);
+      break;
+    }
+  }
+
+  return result;
+}
+
+void Board::updateLink(const std::shared_ptr<Tile>& startTile, const Connector& startConnector)
+{
+  assert(startTile->node());
+
+  auto result = trace(*startTile, startConnector);
+
+  if(result.crossOver)
+  {
+    auto it = m_railCrossOver.find(*result.crossOver);
+    if(it == m_railCrossOver.end())
+    {
+      it = m_railCrossOver.emplace(*result.crossOver, std::make_shared<HiddenCrossOverRailTile>(world())).first;
+      it->second->x.setValueInternal(result.crossOver->x);
+      it->second->y.setValueInternal(result.crossOver->y);
+    }
+    auto& crossOver = it->second;
+    auto crossOverConnector = crossOver->getConnector(result.connector->direction);
+    assert(crossOverConnector);
+
+    auto link = std::make_shared<Link>(std::move(result.tiles));
+    link->connect(*startTile->node(), startConnector, *crossOver->node(), *crossOverConnector);
+  }
+  else if(result.tile)
+  {
+    auto link = std::make_shared<Link>(std::move(result.tiles));
+    link->connect(*startTile->node(), startConnector, *result.tile->node(), *result.connector);
+  }
+  else
+    startTile->node()->get().disconnect(startConnector);
+}
+
+void Board::updateLinks(const std::vector<std::shared_ptr<Tile>>& nodeTiles)
+{
+  // tiles to notify, a crossover is never notified, but the tiles it links:
+  std::vector<std::shared_ptr<Tile>> modifiedTiles;
+  const auto addModifiedTile =
+    [&modifiedTiles](Node& node)
+    {
+      if(node.tile().tileId == TileId::HiddenRailCrossOver)
+      {
+        for(const auto& link : node.links())
+          if(link && &link->getNext(node) != &node)
+            modifiedTiles.emplace_back(link->getNext(node).tile().shared_ptr<Tile>());
+      }
+      else
+        modifiedTiles.emplace_back(node.tile().shared_ptr<Tile>());
     };
 
   // check/rebuild links:
   {
     std::vector<Connector> connectors;
 
-    for(auto& [l, tile] : m_tiles)
+    for(const auto& tile : nodeTiles)
     {
-      if(auto node = tile->node(); node && l == tile->location())
-      {
-        connectors.clear();
+      auto& node = tile->node()->get();
 
-        tile->getConnectors(connectors);
+      // the currently linked nodes might lose their link:
+      for(const auto& link : node.links())
+        if(link)
+          addModifiedTile(link->getNext(node));
 
-        assert(!connectors.empty());
-        for(const auto connector : connectors)
-        {
-          updateLink(tile, connector);
-        }
+      modifiedTiles.emplace_back(tile);
+
+      connectors.clear();
+
+      tile->getConnectors(connectors);
+
+      assert(!connectors.empty());
+      for(const auto connector : connectors)
+      {
+        updateLink(tile, connector);
       }
     }
 
@@ -476,7 +598,8 @@ void Board::modified()
     {
       bool remove = false;
       assert(it->second->node());
-      for(const auto& link : (*it->second->node()).get().links())
+      auto& node = (*it->second->node()).get();
+      for(const auto& link : node.links())
       {
         if(!link)
         {
@@ -486,6 +609,7 @@ void Board::modified()
       }
       if(remove)
       {
+        addModifiedTile(node);
         it = m_railCrossOver.erase(it);
       }
       else
@@ -495,11 +619,66 @@ void Board::modified()
     }
   }
 
-  // notify board changed:
+  // notify tiles which depend on the modified links, a signal looks up to two blocks ahead,
+  // so the search continues through one block. Link tiles continue the search on another board.
+  static constexpr uint8_t blocksMax = 2;
+
+  std::unordered_map<const Node*, uint8_t> visited; // node -> least number of blocks passed
+  std::vector<std::pair<Node*, uint8_t>> queue;
+  for(const auto& tile : modifiedTiles)
+    if(auto node = tile->node(); node && visited.emplace(&node->get(), 0).second)
+      queue.emplace_back(&node->get(), 0);
+  const size_t modifiedNodeCount = queue.size();
+
+  std::vector<std::shared_ptr<Tile>> notify;
+  std::unordered_set<const Tile*> notified;
+  for(size_t i = 0; i < queue.size(); i++)
+  {
+    auto [node, blocks] = queue[i];
+    if(blocks > visited[node]) // also reached through less blocks
+      continue;
+
+    Tile& tile = node->tile();
+    if(tile.tileId != TileId::HiddenRailCrossOver && notified.emplace(&tile).second)
+      notify.emplace_back(tile.shared_ptr<Tile>());
+
+    if(i >= modifiedNodeCount && tile.tileId == TileId::RailBlock && ++blocks >= blocksMax)
+      continue;
+
+    const auto visit =
+      [&visited, &queue, blocks](Node& next)
+      {
+        auto [it, added] = visited.emplace(&next, blocks);
+        if(added || blocks < it->second)
+        {
+          it->second = blocks;
+          queue.emplace_back(&next, blocks);
+        }
+      };
+
+    for(const auto& link : node->links())
+      if(link)
+        visit(link->getNext(*node));
+
+    if(auto* linkTile = dynamic_cast<LinkRailTile*>(&tile); linkTile && linkTile->link)
+      if(auto linkNode = linkTile->link->node())
+        visit(linkNode->get());
+  }
+
+  for(const auto& tile : notify)
+    tile->boardModified();
+}
+
+void Board::updateAllLinks()
+{
+  std::vector<std::shared_ptr<Tile>> nodeTiles;
   for(auto& [l, tile] : m_tiles)
-    if(l == tile->location()) // check origin to notify each tile once
-      tile->boardModified();
+    if(tile->node() && l == tile->location()) // check origin to add each tile once
+      nodeTiles.emplace_back(tile);
+
+  updateLinks(nodeTiles);
 
+  m_modifiedLocations.clear();
   m_modified = false;
 }
 
@@ -25,7 +25,10 @@
 
 #include "../core/idobject.hpp"
 #include <unordered_map>
+#include <unordered_set>
+#include <optional>
 #include "../core/method.hpp"
+#include "map/connector.hpp"
 #include <traintastic/board/tilelocation.hpp>
 #include <traintastic/enum/tilerotate.hpp>
 
@@ -41,10 +44,25 @@ class Board : public IdObject
     using TileMap = std::unordered_map<TileLocation, std::shared_ptr<Tile>, TileLocationHash>;
 
   private:
+    struct Trace
+    {
+      std::vector<std::shared_ptr<Tile>> tiles; //!< tiles without node between start and end
+      std::shared_ptr<Tile> tile; //!< tile with node at the end, if any
+      std::optional<TileLocation> crossOver; //!< crossover at the end (top left), if any
+      std::optional<Connector> connector; //!< connector at the end, if tile or crossover is set
+    };
+
     bool m_modified = false;
+    std::unordered_set<TileLocation, TileLocationHash> m_modifiedLocations; //!< locations edited since last modified()
     std::unordered_map<TileLocation, std::shared_ptr<HiddenCrossOverRailTile>, TileLocationHash> m_railCrossOver;
 
     void modified();
+    void addModified(TileLocation location, uint8_t width, uint8_t height);
+    std::vector<std::shared_ptr<Tile>> getModifiedNodeTiles();
+    Trace trace(const Tile& startTile, const Connector& startConnector);
+    void updateLink(const std::shared_ptr<Tile>& startTile, const Connector& startConnector);
+    void updateLinks(const std::vector<std::shared_ptr<Tile>>& nodeTiles);
+    void updateAllLinks();
     void removeTile(int16_t x, int16_t y);
     void updateSize(bool allowShrink = false);
 
@@ -76,7 +94,7 @@ class Board : public IdObject
     Method<bool(int16_t, int16_t)> deleteTile;
     Method<void()> resizeToContents;
 
-    boost::signals2::signal<void (Board&, const TileLocation&, const TileData&)> tileDataChanged;
+    Signal<void (Board&, const TileLocation&, const TileData&)> tileDataChanged;
 
     Board(World& world, std::string_view _id);
 
@@ -104,11 +122,19 @@ class Board : public IdObject
       return {};
     }
 
+    //! \brief Mark tile as modified, its links are updated on the next modified().
+    void tileModified(const Tile& tile);
+
 #ifdef TRAINTASTIC_TEST
     const auto& railCrossOver() const
     {
       return m_railCrossOver;
     }
+
+    void rebuildLinks()
+    {
+      updateAllLinks();
+    }
 #endif
 };
 
@@ -73,25 +73,10 @@ void BoardList::worldEvent(WorldState state, WorldEvent event)
     const auto start = std::chrono::steady_clock::now();
 #endif
 
-    // due to link tile a change on one board might require an update on another board.
-    // for now update all board if one board is changed (should be improved!)
-    bool boardModified = false;
+    // only the links around the edited tiles are updated,
+    // tiles on other boards depending on them are notified through link tiles.
     for(auto& board : m_items)
-    {
-      if(board->m_modified)
-      {
-        boardModified = true;
-        break;
-      }
-    }
-    if(boardModified)
-    {
-      for(auto& board : m_items)
-      {
-        board->m_modified = true;
-        board->modified();
-      }
-    }
+      board->modified();
 
 #ifdef ENABLE_LOG_DEBUG
   const auto duration = std::chrono::steady_clock::now() - start;
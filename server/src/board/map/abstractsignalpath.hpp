@@ -26,7 +26,7 @@
 #include "path.hpp"
 #include "link.hpp"
 #include <map>
-#include <boost/signals2/connection.hpp>
+#include "../../core/signal.hpp"
 #include <traintastic/enum/blockstate.hpp>
 
 class BlockRailTile;
@@ -155,7 +155,7 @@ class AbstractSignalPath : public Path
   private:
     std::unique_ptr<const Item> m_root;
     bool m_requireReservation = false;
-    std::vector<boost::signals2::scoped_connection> m_connections;
+    std::vector<ScopedSignalConnection> m_connections;
 
     std::unique_ptr<const Item> findBlocks(const Node& node, const Link& link, size_t blocksAhead);
 
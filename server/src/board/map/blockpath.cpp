@@ -20,7 +20,7 @@
  */
 
 #include "blockpath.hpp"
-#include <queue>
+#include <limits>
 #include <traintastic/enum/crossstate.hpp>
 #include "node.hpp"
 #include "link.hpp"
@@ -38,15 +38,50 @@
 #include "../../core/objectproperty.tpp"
 #include "../../enum/bridgepath.hpp"
 
-template<class T1, typename T2>
-static bool contains(const std::vector<std::pair<std::weak_ptr<T1>, T2>>& values, const std::shared_ptr<T1>& value)
+/**
+ * \brief Step of the block path search
+ *
+ * The steps of all branches are stored in one table, a branch is a chain of
+ * parent indices. Forking a branch at a turnout only adds a step instead of
+ * copying the path so far.
+ */
+struct BlockPath::Step
 {
-  const auto it = std::find_if(values.begin(), values.end(),
-    [&value](const auto& item)
-    {
-      return item.first.lock() == value;
-    });
-  return it != values.end();
+  enum class Type : uint8_t
+  {
+    LinkTiles,
+    Tile,
+    Turnout,
+    DirectionControl,
+    Crossing,
+    CrossOver,
+    Bridge,
+    Signal,
+    NXButtonFrom,
+    NXButtonTo,
+  };
+
+  static constexpr uint32_t none = std::numeric_limits<uint32_t>::max();
+
+  uint32_t parent;
+  uint32_t prevJunction; //!< previous turnout, crossing or crossover step, only set for those
+  Type type;
+  uint8_t state; //!< turnout position, direction control state, cross state or bridge path
+  const Link* link; //!< link of which the tiles are passed, only for Type::LinkTiles
+  Tile* tile;
+};
+
+namespace {
+
+struct Branch
+{
+  BlockSide side;
+  uint32_t step;
+  uint32_t junction; //!< last turnout, crossing or crossover step
+  const Node* node;
+  const Link* link;
+};
+
 }
 
 template <typename T>
@@ -66,259 +101,308 @@ std::vector<std::shared_ptr<BlockPath>> BlockPath::find(BlockRailTile& startBloc
     return {};
   }
 
-  struct Position
-  {
-    std::shared_ptr<BlockPath> path;
-    const Node* node;
-    const Link* link;
-  };
-
+  std::vector<Step> steps;
+  std::vector<Branch> todo;
+  std::vector<uint32_t> chain;
   std::vector<std::shared_ptr<BlockPath>> paths;
 
-  std::queue<Position> todo;
+  const auto addStep =
+    [&steps](Branch& branch, Step::Type type, Tile& tile, uint8_t state = 0)
+    {
+      const bool junction = (type == Step::Type::Turnout || type == Step::Type::Crossing || type == Step::Type::CrossOver);
+      steps.emplace_back(Step{branch.step, junction ? branch.junction : Step::none, type, state, nullptr, &tile});
+      branch.step = static_cast<uint32_t>(steps.size() - 1);
+      if(junction)
+      {
+        branch.junction = branch.step;
+      }
+    };
+
+  const auto hasPassed =
+    [&steps](const Branch& branch, const Tile& tile)
+    {
+      for(uint32_t i = branch.junction; i != Step::none; i = steps[i].prevJunction)
+      {
+        if(steps[i].tile == &tile)
+        {
+          return true;
+        }
+      }
+      return false;
+    };
+
   if(linkA)
   {
-    todo.emplace(Position{std::make_shared<BlockPath>(startBlock, BlockSide::A), &node, linkA.get()});
+    todo.emplace_back(Branch{BlockSide::A, Step::none, Step::none, &node, linkA.get()});
   }
   if(linkB)
   {
-    todo.emplace(Position{std::make_shared<BlockPath>(startBlock, BlockSide::B), &node, linkB.get()});
+    todo.emplace_back(Branch{BlockSide::B, Step::none, Step::none, &node, linkB.get()});
   }
 
-  while(!todo.empty())
+  for(size_t i = 0; i < todo.size(); i++) // forks are added to the back, so todo can grow while iterating
   {
-    auto& current = todo.front();
-    if(!current.link)
-    {
-      todo.pop(); // drop it, dead end
-      continue;
-    }
-
-    for(const auto& tile : current.link->tiles()) // add passive tiles to reserve
-    {
-      current.path->m_tiles.emplace_back(std::static_pointer_cast<RailTile>(tile));
-    }
+    Branch current = todo[i];
+    bool done = false;
 
-    assert(current.node);
-    const auto& nextNode = current.link->getNext(*current.node);
-    auto& tile = nextNode.tile();
-
-    switch(tile.tileId.value())
+    while(!done)
     {
-      case TileId::RailBlock:
+      if(!current.link)
       {
-        if(current.node->tile().tileId == TileId::RailNXButton)
-        {
-          current.path->m_nxButtonTo = current.node->tile().shared_ptr<NXButtonRailTile>();
-        }
+        break; // dead end
+      }
 
-        auto& block = static_cast<BlockRailTile&>(tile);
-        current.path->m_toBlock = block.shared_ptr<BlockRailTile>();
-        current.path->m_toSide = nextNode.getLink(0).get() == current.link ? BlockSide::A : BlockSide::B;
-        paths.emplace_back(std::move(current.path));
-        todo.pop(); // complete
-        break;
+      if(!current.link->tiles().empty()) // add passive tiles to reserve
+      {
+        steps.emplace_back(Step{current.step, Step::none, Step::Type::LinkTiles, 0, current.link, nullptr});
+        current.step = static_cast<uint32_t>(steps.size() - 1);
       }
-      case TileId::RailTurnoutLeft45:
-      case TileId::RailTurnoutLeft90:
-      case TileId::RailTurnoutLeftCurved:
-      case TileId::RailTurnoutRight45:
-      case TileId::RailTurnoutRight90:
-      case TileId::RailTurnoutRightCurved:
-      case TileId::RailTurnoutWye:
-      case TileId::RailTurnout3Way:
-      case TileId::RailTurnoutSingleSlip:
-      case TileId::RailTurnoutDoubleSlip:
+
+      assert(current.node);
+      const auto& nextNode = current.link->getNext(*current.node);
+      auto& tile = nextNode.tile();
+
+      switch(tile.tileId.value())
       {
-        auto turnout = tile.shared_ptr<TurnoutRailTile>();
-        if(contains(current.path->m_turnouts, turnout))
+        case TileId::RailBlock:
         {
-          todo.pop(); // drop it, can't pass turnout twice
+          if(current.node->tile().tileId == TileId::RailNXButton)
+          {
+            addStep(current, Step::Type::NXButtonTo, current.node->tile());
+          }
+
+          auto path = std::make_shared<BlockPath>(startBlock, current.side);
+          path->m_toBlock = tile.shared_ptr<BlockRailTile>();
+          path->m_toSide = nextNode.getLink(0).get() == current.link ? BlockSide::A : BlockSide::B;
+          path->assign(steps, current.step, chain);
+          paths.emplace_back(std::move(path));
+          done = true; // complete
           break;
         }
-        auto links = getTurnoutLinks(*turnout, *current.link);
-        assert(!links.empty());
-
-        if(links.size() > 1)
+        case TileId::RailTurnoutLeft45:
+        case TileId::RailTurnoutLeft90:
+        case TileId::RailTurnoutLeftCurved:
+        case TileId::RailTurnoutRight45:
+        case TileId::RailTurnoutRight90:
+        case TileId::RailTurnoutRightCurved:
+        case TileId::RailTurnoutWye:
+        case TileId::RailTurnout3Way:
+        case TileId::RailTurnoutSingleSlip:
+        case TileId::RailTurnoutDoubleSlip:
         {
-          for(size_t i = 1; i < links.size(); ++i)
+          if(hasPassed(current, tile))
           {
-            auto path = std::make_shared<BlockPath>(*current.path); // "fork" path
-            path->m_turnouts.emplace_back(turnout, links[i].turnoutPosition);
-            todo.emplace(Position{std::move(path), &nextNode, nextNode.getLink(links[i].linkIndex).get()});
+            done = true; // drop it, can't pass turnout twice
+            break;
+          }
+          auto links = getTurnoutLinks(static_cast<TurnoutRailTile&>(tile), *current.link);
+          assert(!links.empty());
+
+          for(size_t j = 1; j < links.size(); ++j) // "fork" path
+          {
+            Branch fork{current.side, current.step, current.junction, &nextNode, nextNode.getLink(links[j].linkIndex).get()};
+            addStep(fork, Step::Type::Turnout, tile, static_cast<uint8_t>(links[j].turnoutPosition));
+            todo.emplace_back(fork);
           }
-        }
 
-        current.node = &nextNode;
-        current.link = nextNode.getLink(links[0].linkIndex).get();
-        current.path->m_turnouts.emplace_back(turnout, links[0].turnoutPosition);
-        break;
-      }
-      case TileId::RailOneWay:
-        //  1
-        //  |
-        //  ^
-        //  |
-        //  0
-        if(nextNode.getLink(0).get() == current.link) // 0 -> 1 = allowed
-        {
-          current.path->m_tiles.emplace_back(tile.shared_ptr<RailTile>());
           current.node = &nextNode;
-          current.link = nextNode.getLink(1).get();
-        }
-        else // 1 -> 0 = blocked
-        {
-          todo.pop(); // drop it, one way only
+          current.link = nextNode.getLink(links[0].linkIndex).get();
+          addStep(current, Step::Type::Turnout, tile, static_cast<uint8_t>(links[0].turnoutPosition));
+          break;
         }
-        break;
-
-      case TileId::RailDirectionControl:
-      {
-        //  1 B
-        //   |
-        //  ( )
-        //   |
-        //  0 A
-        const bool sideA = nextNode.getLink(0).get() == current.link;
-        current.node = &nextNode;
-        current.link = nextNode.getLink(sideA ? 1 : 0).get();
-        current.path->m_directionControls.emplace_back(tile.shared_ptr<DirectionControlRailTile>(), sideA ? DirectionControlState::AtoB : DirectionControlState::BtoA);
-        break;
-      }
-      case TileId::RailBridge45Left:
-      case TileId::RailBridge45Right:
-      case TileId::RailBridge90:
-        //     2      1 2      2 3
-        //     |       \|      |/
-        // 1 --+-- 3    |      |
-        //     |        |\    /|
-        //     0        0 3  1 0
-        for(size_t i = 0; i < 4; i++)
-        {
-          if(nextNode.getLink(i).get() == current.link)
+        case TileId::RailOneWay:
+          //  1
+          //  |
+          //  ^
+          //  |
+          //  0
+          if(nextNode.getLink(0).get() == current.link) // 0 -> 1 = allowed
           {
+            addStep(current, Step::Type::Tile, tile);
             current.node = &nextNode;
-            current.link = nextNode.getLink((i + 2) % 4).get(); // opposite
-            current.path->m_bridges.emplace_back(tile.shared_ptr<BridgeRailTile>(), i % 2 == 0 ? BridgePath::AC : BridgePath::BD);
-            break;
+            current.link = nextNode.getLink(1).get();
           }
-        }
-        break;
+          else // 1 -> 0 = blocked
+          {
+            done = true; // drop it, one way only
+          }
+          break;
 
-      case TileId::RailCross45:
-      case TileId::RailCross90:
-      {
-        //     2        2 3
-        //     |        |/
-        // 1 --+-- 3    |
-        //     |       /|
-        //     0      1 0
-        auto cross = tile.shared_ptr<CrossRailTile>();
-        if(contains(current.path->m_crossings, cross))
+        case TileId::RailDirectionControl:
         {
-          todo.pop(); // drop it, can't pass crossing twice
+          //  1 B
+          //   |
+          //  ( )
+          //   |
+          //  0 A
+          const bool sideA = nextNode.getLink(0).get() == current.link;
+          current.node = &nextNode;
+          current.link = nextNode.getLink(sideA ? 1 : 0).get();
+          addStep(current, Step::Type::DirectionControl, tile, static_cast<uint8_t>(sideA ? DirectionControlState::AtoB : DirectionControlState::BtoA));
           break;
         }
+        case TileId::RailBridge45Left:
+        case TileId::RailBridge45Right:
+        case TileId::RailBridge90:
+          //     2      1 2      2 3
+          //     |       \|      |/
+          // 1 --+-- 3    |      |
+          //     |        |\    /|
+          //     0        0 3  1 0
+          for(size_t j = 0; j < 4; j++)
+          {
+            if(nextNode.getLink(j).get() == current.link)
+            {
+              current.node = &nextNode;
+              current.link = nextNode.getLink((j + 2) % 4).get(); // opposite
+              addStep(current, Step::Type::Bridge, tile, static_cast<uint8_t>(j % 2 == 0 ? BridgePath::AC : BridgePath::BD));
+              break;
+            }
+          }
+          break;
 
-        for(size_t i = 0; i < 4; i++)
+        case TileId::RailCross45:
+        case TileId::RailCross90:
+        case TileId::HiddenRailCrossOver:
         {
-          if(nextNode.getLink(i).get() == current.link)
+          //     2        2 3      1 2
+          //     |        |/        X
+          // 1 --+-- 3    |        0 3
+          //     |       /|
+          //     0      1 0
+          if(hasPassed(current, tile))
           {
-            current.node = &nextNode;
-            current.link = nextNode.getLink((i + 2) % 4).get(); // opposite
-            current.path->m_crossings.emplace_back(cross, i % 2 == 0 ? CrossState::AC : CrossState::BD);
+            done = true; // drop it, can't pass crossing twice
             break;
           }
+
+          const auto type = (tile.tileId == TileId::HiddenRailCrossOver) ? Step::Type::CrossOver : Step::Type::Crossing;
+          for(size_t j = 0; j < 4; j++)
+          {
+            if(nextNode.getLink(j).get() == current.link)
+            {
+              current.node = &nextNode;
+              current.link = nextNode.getLink((j + 2) % 4).get(); // opposite
+              addStep(current, type, tile, static_cast<uint8_t>(j % 2 == 0 ? CrossState::AC : CrossState::BD));
+              break;
+            }
+          }
+          break;
         }
-        break;
-      }
-      case TileId::RailLink:
-      {
-        auto& linkTile = static_cast<LinkRailTile&>(tile);
-        if(linkTile.link) // is connected to another link
-        {
-          current.path->m_tiles.emplace_back(linkTile.shared_ptr<RailTile>());
-          current.path->m_tiles.emplace_back(linkTile.link->shared_ptr<RailTile>());
-          assert(linkTile.link->node());
-          auto& linkNode = linkTile.link->node()->get();
-          current.node = &linkNode;
-          current.link = linkNode.getLink(0).get();
-        }
-        else
+        case TileId::RailLink:
         {
-          todo.pop(); // drop it, no connection
+          auto& linkTile = static_cast<LinkRailTile&>(tile);
+          if(linkTile.link) // is connected to another link
+          {
+            addStep(current, Step::Type::Tile, linkTile);
+            addStep(current, Step::Type::Tile, *linkTile.link);
+            assert(linkTile.link->node());
+            auto& linkNode = linkTile.link->node()->get();
+            current.node = &linkNode;
+            current.link = linkNode.getLink(0).get();
+          }
+          else
+          {
+            done = true; // drop it, no connection
+          }
+          break;
         }
-        break;
+        case TileId::RailSignal2Aspect:
+        case TileId::RailSignal3Aspect:
+          current.node = &nextNode;
+          if(nextNode.getLink(0).get() == current.link) // 0 -> 1 = frontside of signal
+          {
+            current.link = nextNode.getLink(1).get();
+            addStep(current, Step::Type::Signal, tile);
+          }
+          else // 1 -> 0 = backside of signal, just pass
+          {
+            current.link = nextNode.getLink(0).get();
+            addStep(current, Step::Type::Tile, tile);
+          }
+          break;
+
+        case TileId::RailDecoupler:
+          addStep(current, Step::Type::Tile, tile);
+          current.node = &nextNode;
+          current.link = otherLink(nextNode, *current.link).get();
+          break;
+
+        case TileId::RailNXButton:
+          addStep(current, (&current.node->tile() == &startBlock) ? Step::Type::NXButtonFrom : Step::Type::Tile, tile);
+          current.node = &nextNode;
+          current.link = otherLink(nextNode, *current.link).get();
+          break;
+
+        default: // passive or non rail tiles
+          assert(false); // this should never happen
+          done = true; // drop it in case it does, however that is a bug!
+          break;
       }
-      case TileId::RailSignal2Aspect:
-      case TileId::RailSignal3Aspect:
-        current.node = &nextNode;
-        if(nextNode.getLink(0).get() == current.link) // 0 -> 1 = frontside of signal
-        {
-          current.link = nextNode.getLink(1).get();
-          current.path->m_signals.emplace_back(tile.shared_ptr<SignalRailTile>());
-        }
-        else // 1 -> 0 = backside of signal, just pass
+    }
+  }
+  return paths;
+}
+
+void BlockPath::assign(const std::vector<Step>& steps, uint32_t last, std::vector<uint32_t>& chain)
+{
+  chain.clear();
+  for(uint32_t i = last; i != Step::none; i = steps[i].parent)
+  {
+    chain.emplace_back(i);
+  }
+
+  for(auto it = chain.rbegin(); it != chain.rend(); ++it)
+  {
+    const auto& step = steps[*it];
+    switch(step.type)
+    {
+      case Step::Type::LinkTiles:
+        for(const auto& tile : step.link->tiles())
         {
-          current.link = nextNode.getLink(0).get();
-          current.path->m_tiles.emplace_back(tile.shared_ptr<RailTile>());
+          m_tiles.emplace_back(std::static_pointer_cast<RailTile>(tile));
         }
         break;
 
-      case TileId::RailDecoupler:
-        current.path->m_tiles.emplace_back(tile.shared_ptr<RailTile>());
-        current.node = &nextNode;
-        current.link = otherLink(nextNode, *current.link).get();
+      case Step::Type::Tile:
+        m_tiles.emplace_back(step.tile->shared_ptr<RailTile>());
         break;
 
-      case TileId::RailNXButton:
-        if(&current.node->tile() == &startBlock)
-        {
-          current.path->m_nxButtonFrom = tile.shared_ptr<NXButtonRailTile>();
-        }
-        else
-        {
-          current.path->m_tiles.emplace_back(tile.shared_ptr<RailTile>());
-        }
-        current.node = &nextNode;
-        current.link = otherLink(nextNode, *current.link).get();
+      case Step::Type::Turnout:
+        m_turnouts.emplace_back(step.tile->shared_ptr<TurnoutRailTile>(), static_cast<TurnoutPosition>(step.state));
         break;
 
-      case TileId::HiddenRailCrossOver:
-      {
-        // 1 2
-        //  X
-        // 0 3
-        auto crossOver = tile.shared_ptr<HiddenCrossOverRailTile>();
-        if(contains(current.path->m_crossOvers, crossOver))
-        {
-          todo.pop(); // drop it, can't pass crossover twice
-          break;
-        }
+      case Step::Type::DirectionControl:
+        m_directionControls.emplace_back(step.tile->shared_ptr<DirectionControlRailTile>(), static_cast<DirectionControlState>(step.state));
+        break;
 
-        for(size_t i = 0; i < 4; i++)
-        {
-          if(nextNode.getLink(i).get() == current.link)
-          {
-            current.node = &nextNode;
-            current.link = nextNode.getLink((i + 2) % 4).get(); // opposite
-            current.path->m_crossOvers.emplace_back(crossOver, i % 2 == 0 ? CrossState::AC : CrossState::BD);
-            break;
-          }
-        }
+      case Step::Type::Crossing:
+        m_crossings.emplace_back(step.tile->shared_ptr<CrossRailTile>(), static_cast<CrossState>(step.state));
+        break;
+
+      case Step::Type::CrossOver:
+        m_crossOvers.emplace_back(step.tile->shared_ptr<HiddenCrossOverRailTile>(), static_cast<CrossState>(step.state));
+        break;
+
+      case Step::Type::Bridge:
+        m_bridges.emplace_back(step.tile->shared_ptr<BridgeRailTile>(), static_cast<BridgePath>(step.state));
         break;
-      }
 
-      default: // passive or non rail tiles
-        assert(false); // this should never happen
-        todo.pop(); // drop it in case it does, however that is a bug!
+      case Step::Type::Signal:
+        m_signals.emplace_back(step.tile->shared_ptr<SignalRailTile>());
+        break;
+
+      case Step::Type::NXButtonFrom:
+        m_nxButtonFrom = step.tile->shared_ptr<NXButtonRailTile>();
+        break;
+
+      case Step::Type::NXButtonTo:
+        m_nxButtonTo = step.tile->shared_ptr<NXButtonRailTile>();
         break;
     }
   }
-  return paths;
 }
 
-
 BlockPath::BlockPath(BlockRailTile& block, BlockSide side)
   : m_fromBlock{block}
   , m_fromSide{side}
@@ -329,28 +413,6 @@ BlockPath::BlockPath(BlockRailTile& block, BlockSide side)
 {
 }
 
-BlockPath::BlockPath(const BlockPath &other)
-  : Path(other)
-  , std::enable_shared_from_this<BlockPath>() // NOLINT(readability-redundant-member-init) -Wextra requires this
-  , m_fromBlock(other.m_fromBlock)
-  , m_fromSide(other.m_fromSide)
-  , m_toBlock(other.m_toBlock)
-  , m_toSide(other.m_toSide)
-  , m_tiles(other.m_tiles)
-  , m_turnouts(other.m_turnouts)
-  , m_directionControls(other.m_directionControls)
-  , m_crossings(other.m_crossings)
-  , m_bridges(other.m_bridges)
-  , m_signals(other.m_signals)
-  , m_nxButtonFrom(other.m_nxButtonFrom)
-  , m_nxButtonTo(other.m_nxButtonTo)
-  , m_delayReleaseTimer{EventLoop::ioContext()}
-  , m_isReserved(false)
-  , m_delayedReleaseScheduled(false)
-{
-
-}
-
 bool BlockPath::operator ==(const BlockPath& other) const noexcept
 {
   return
@@ -362,6 +424,7 @@ bool BlockPath::operator ==(const BlockPath& other) const noexcept
     (m_turnouts == other.m_turnouts) &&
     (m_directionControls == other.m_directionControls) &&
     (m_crossings == other.m_crossings) &&
+    (m_crossOvers == other.m_crossOvers) &&
     (m_bridges == other.m_bridges) &&
     (m_signals == other.m_signals) &&
     (m_nxButtonFrom == other.m_nxButtonFrom) &&
@@ -399,6 +462,11 @@ bool BlockPath::isReady() const
   return true;
 }
 
+bool BlockPath::isAvailable(const std::shared_ptr<Train>& train) const
+{
+  return !m_isReserved && canReserve(train);
+}
+
 std::shared_ptr<NXButtonRailTile> BlockPath::nxButtonFrom() const
 {
   return m_nxButtonFrom.lock();
@@ -409,24 +477,18 @@ std::shared_ptr<NXButtonRailTile> BlockPath::nxButtonTo() const
   return m_nxButtonTo.lock();
 }
 
-bool BlockPath::reserve(const std::shared_ptr<Train>& train, bool dryRun)
+bool BlockPath::canReserve(const std::shared_ptr<Train>& train) const
 {
-  if(!dryRun && !reserve(train, true)) // dry run first, to make sure it will succeed (else we need rollback support)
+  // the tiles don't use the path on a dry run, so no shared_from_this() is needed:
+  if(!m_fromBlock.reserve(nullptr, train, m_fromSide, true))
   {
     return false;
   }
 
-  if(!m_fromBlock.reserve(shared_from_this(), train, m_fromSide, dryRun))
-  {
-    assert(dryRun);
-    return false;
-  }
-
   if(auto toBlock = m_toBlock.lock()) /*[[likely]]*/
   {
-    if(!toBlock->reserve(shared_from_this(), train, m_toSide, dryRun))
+    if(!toBlock->reserve(nullptr, train, m_toSide, true))
     {
-      assert(dryRun);
       return false;
     }
   }
@@ -437,129 +499,160 @@ bool BlockPath::reserve(const std::shared_ptr<Train>& train, bool dryRun)
 
   for(const auto& [turnoutWeak, position] : m_turnouts)
   {
-    if(auto turnout = turnoutWeak.lock())
-    {
-      if(!turnout->reserve(shared_from_this(), position, dryRun))
-      {
-        assert(dryRun);
-        return false;
-      }
-    }
-    else /*[[unlikely]]*/
+    auto turnout = turnoutWeak.lock();
+    if(!turnout || !turnout->reserve(nullptr, position, true))
     {
-      assert(dryRun);
       return false;
     }
   }
 
   for(const auto& [directionControlWeak, state] : m_directionControls)
   {
-    if(auto directionControl = directionControlWeak.lock())
-    {
-      if(!directionControl->reserve(state, dryRun))
-      {
-        assert(dryRun);
-        return false;
-      }
-    }
-    else /*[[unlikely]]*/
+    auto directionControl = directionControlWeak.lock();
+    if(!directionControl || !directionControl->reserve(state, true))
     {
-      assert(dryRun);
       return false;
     }
   }
 
   for(const auto& [crossWeak, state] : m_crossings)
   {
-    if(auto cross = crossWeak.lock())
+    auto cross = crossWeak.lock();
+    if(!cross || !cross->reserve(state, true))
     {
-      if(!cross->reserve(state, dryRun))
-      {
-        assert(dryRun);
-        return false;
-      }
+      return false;
     }
-    else /*[[unlikely]]*/
+  }
+
+  for(const auto& [crossOverWeak, state] : m_crossOvers)
+  {
+    auto crossOver = crossOverWeak.lock();
+    if(!crossOver || !crossOver->reserve(state, true))
     {
-      assert(dryRun);
       return false;
     }
   }
 
-  for(const auto& [crossOverWeak, state] : m_crossOvers)
+  for(const auto& [bridgeWeak, path] : m_bridges)
   {
-    if(auto crossOver = crossOverWeak.lock())
+    auto bridge = bridgeWeak.lock();
+    if(!bridge || !bridge->reserve(path, true))
     {
-      if(!crossOver->reserve(state, dryRun))
-      {
-        assert(dryRun);
-        return false;
-      }
+      return false;
     }
-    else /*[[unlikely]]*/
+  }
+
+  for(const auto& signalWeak : m_signals)
+  {
+    auto signal = signalWeak.lock();
+    if(!signal || !signal->reserve(nullptr, true))
     {
-      assert(dryRun);
       return false;
     }
   }
 
-  for(const auto& [bridgeWeak, path] : m_bridges)
+  return true;
+}
+
+bool BlockPath::reserve(const std::shared_ptr<Train>& train, bool dryRun)
+{
+  if(!canReserve(train)) // check first, to make sure it will succeed (else we need rollback support)
+  {
+    return false;
+  }
+
+  if(dryRun)
+  {
+    return true;
+  }
+
+  const auto self = shared_from_this();
+
+  if(!m_fromBlock.reserve(self, train, m_fromSide, false))
+  {
+    assert(false);
+    return false;
+  }
+
+  if(!m_toBlock.lock()->reserve(self, train, m_toSide, false))
+  {
+    assert(false);
+    return false;
+  }
+
+  for(const auto& [turnoutWeak, position] : m_turnouts)
   {
-    if(auto bridge = bridgeWeak.lock())
+    if(!turnoutWeak.lock()->reserve(self, position, false))
     {
-      if(!bridge->reserve(path, dryRun))
-      {
-        assert(dryRun);
-        return false;
-      }
+      assert(false);
+      return false;
     }
-    else /*[[unlikely]]*/
+  }
+
+  for(const auto& [directionControlWeak, state] : m_directionControls)
+  {
+    if(!directionControlWeak.lock()->reserve(state, false))
     {
-      assert(dryRun);
+      assert(false);
       return false;
     }
   }
 
-  for(const auto& signalWeak : m_signals)
+  for(const auto& [crossWeak, state] : m_crossings)
   {
-    if(auto signal = signalWeak.lock())
+    if(!crossWeak.lock()->reserve(state, false))
     {
-      if(!signal->reserve(shared_from_this(), dryRun))
-      {
-        assert(dryRun);
-        return false;
-      }
+      assert(false);
+      return false;
     }
-    else /*[[unlikely]]*/
+  }
+
+  for(const auto& [crossOverWeak, state] : m_crossOvers)
+  {
+    if(!crossOverWeak.lock()->reserve(state, false))
     {
-      assert(dryRun);
+      assert(false);
       return false;
     }
   }
 
-  if(!dryRun)
+  for(const auto& [bridgeWeak, path] : m_bridges)
   {
-    for(const auto& tileWeak : m_tiles)
+    if(!bridgeWeak.lock()->reserve(path, false))
     {
-      if(auto tile = tileWeak.lock()) /*[[likely]]*/
-      {
-        static_cast<RailTile&>(*tile).reserve();
-      }
+      assert(false);
+      return false;
     }
+  }
 
-    if(auto nxButton = m_nxButtonFrom.lock())
+  for(const auto& signalWeak : m_signals)
+  {
+    if(!signalWeak.lock()->reserve(self, false))
     {
-      nxButton->reserve();
+      assert(false);
+      return false;
     }
+  }
 
-    if(auto nxButton = m_nxButtonTo.lock())
+  for(const auto& tileWeak : m_tiles)
+  {
+    if(auto tile = tileWeak.lock()) /*[[likely]]*/
     {
-      nxButton->reserve();
+      static_cast<RailTile&>(*tile).reserve();
     }
   }
 
-  if(!dryRun)
-    m_isReserved = true;
+  if(auto nxButton = m_nxButtonFrom.lock())
+  {
+    nxButton->reserve();
+  }
+
+  if(auto nxButton = m_nxButtonTo.lock())
+  {
+    nxButton->reserve();
+  }
+
+  m_isReserved = true;
 
   return true;
 }
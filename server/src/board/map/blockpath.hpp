@@ -53,6 +53,8 @@ class Train;
 class BlockPath : public Path, public std::enable_shared_from_this<BlockPath>
 {
   private:
+    struct Step;
+
     BlockRailTile& m_fromBlock;
     const BlockSide m_fromSide;
     std::weak_ptr<BlockRailTile> m_toBlock;
@@ -71,17 +73,26 @@ class BlockPath : public Path, public std::enable_shared_from_this<BlockPath>
     bool m_isReserved;
     bool m_delayedReleaseScheduled;
 
+    void assign(const std::vector<Step>& steps, uint32_t last, std::vector<uint32_t>& chain);
+
   public:
     static std::vector<std::shared_ptr<BlockPath>> find(BlockRailTile& block);
 
     BlockPath(BlockRailTile& block, BlockSide side);
-    BlockPath(const BlockPath& other);
+    BlockPath(const BlockPath&) = delete;
+    BlockPath& operator =(const BlockPath&) = delete;
 
     bool operator ==(const BlockPath& other) const noexcept;
 
     //! \return \c true if all turnouts are in position and direction controls are allowed to pass.
     bool isReady() const;
 
+    //! \return \c true if the path can be reserved for the train now, see reserve().
+    bool isAvailable(const std::shared_ptr<Train>& train) const;
+
+    //! \return \c true if all tiles of the path can be reserved for the train, doesn't check if the path itself is reserved.
+    bool canReserve(const std::shared_ptr<Train>& train) const;
+
     bool hasNXButtons() const
     {
       return !m_nxButtonFrom.expired() && !m_nxButtonTo.expired();
@@ -92,6 +103,11 @@ class BlockPath : public Path, public std::enable_shared_from_this<BlockPath>
       return m_fromBlock;
     }
 
+    BlockRailTile& fromBlock()
+    {
+      return m_fromBlock;
+    }
+
     BlockSide fromSide() const
     {
       return m_fromSide;
@@ -20,12 +20,47 @@
  */
 
 #include "trainpathfinder.hpp"
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <queue>
+#include <unordered_map>
 #include <traintastic/enum/blocktraindirection.hpp>
+#include "trainroute.hpp"
 #include "../map/blockpath.hpp"
 #include "../../core/method.tpp"
 #include "../../core/objectproperty.tpp"
 #include "../../board/tile/rail/blockrailtile.hpp"
+#include "../../train/train.hpp"
 #include "../../train/trainblockstatus.hpp"
+#include "../../zone/blockzonelist.hpp"
+
+namespace {
+
+constexpr double noRoute = std::numeric_limits<double>::infinity();
+constexpr double speedDefault = 100.0 / 3.6; // m/s, used if the train maximum speed is unknown
+constexpr double blockLengthDefault = 1.0; // m, used if the block length is unknown
+
+//! \brief Estimated time in seconds to travel through a block, \c noRoute if it can't be passed
+double blockCost(const BlockRailTile& block, double speedMax)
+{
+  double speed = speedMax;
+  for(const auto& zone : *block.zones)
+  {
+    if(zone->speedLimit.hasLimit())
+    {
+      speed = std::min(speed, zone->speedLimit.getValue(SpeedUnit::MeterPerSecond));
+    }
+  }
+  if(speed <= 0)
+  {
+    return noRoute;
+  }
+  const double length = block.length.getValue(LengthUnit::Meter);
+  return ((length > 0) ? length : blockLengthDefault) / speed;
+}
+
+}
 
 TrainPathFinder::TrainPathFinder(Object& parent_, std::string_view parentPropertyName)
   : PathFinder(parent_, parentPropertyName)
@@ -42,23 +77,124 @@ TrainPathFinder::TrainPathFinder(Object& parent_, std::string_view parentPropert
 
         // FIXME: for now only support block to block (direct path only)
 
-        for(const auto& path : fromBlock->paths())
+        if(auto path = fromBlock->getPath(fromSide, *toBlock, toSide))
         {
-          if(path->fromSide() == fromSide && path->toBlock() == toBlock && path->toSide() == toSide)
-          {
-            const auto train =
-              (fromDirection == BlockTrainDirection::TowardsB)
-                ? fromBlock->trains.back()->train.value()
-                : fromBlock->trains.front()->train.value();
-
-            return path->reserve(train);
-          }
+          const auto train =
+            (fromDirection == BlockTrainDirection::TowardsB)
+              ? fromBlock->trains.back()->train.value()
+              : fromBlock->trains.front()->train.value();
+
+          return path->reserve(train);
         }
 
         return false;
       }}
+  , findRoute{*this, "find_route", MethodFlags::ScriptCallable,
+      [](const std::shared_ptr<BlockRailTile>& fromBlock, BlockTrainDirection fromDirection, const std::shared_ptr<BlockRailTile>& toBlock) -> std::shared_ptr<TrainRoute>
+      {
+        if(!fromBlock || !isKnown(fromDirection) || !toBlock || fromBlock == toBlock) [[unlikely]]
+        {
+          return {};
+        }
+
+        std::shared_ptr<Train> train;
+        if(!fromBlock->trains.empty())
+        {
+          const auto& status = (fromDirection == BlockTrainDirection::TowardsB) ? fromBlock->trains.back() : fromBlock->trains.front();
+          train = status->train.value();
+        }
+
+        return find(*fromBlock, fromDirection, *toBlock, train);
+      }}
 {
   m_interfaceItems.add(reserve);
+  m_interfaceItems.add(findRoute);
+}
+
+std::shared_ptr<TrainRoute> TrainPathFinder::find(BlockRailTile& fromBlock, BlockTrainDirection fromDirection, const BlockRailTile& toBlock, const std::shared_ptr<Train>& train)
+{
+  // Dijkstra over the block graph, a vertex is a block and the side the train leaves it:
+  struct Vertex
+  {
+    double cost = noRoute;
+    BlockPath* path = nullptr; //!< path used to reach the node
+    bool done = false;
+  };
+
+  struct Item
+  {
+    double cost;
+    BlockRailTile* block;
+    BlockSide side;
+
+    bool operator >(const Item& other) const
+    {
+      return cost > other.cost;
+    }
+  };
+
+  double speedMax = train ? train->speedMax.getValue(SpeedUnit::MeterPerSecond) : 0;
+  if(speedMax <= 0)
+  {
+    speedMax = speedDefault;
+  }
+
+  std::unordered_map<const BlockRailTile*, std::array<Vertex, 2>> vertices; // index is BlockSide
+  std::priority_queue<Item, std::vector<Item>, std::greater<Item>> queue;
+
+  const auto fromSide = (fromDirection == BlockTrainDirection::TowardsA) ? BlockSide::A : BlockSide::B;
+  vertices[&fromBlock][static_cast<uint8_t>(fromSide)].cost = 0;
+  queue.emplace(Item{0, &fromBlock, fromSide});
+
+  while(!queue.empty())
+  {
+    const auto item = queue.top();
+    queue.pop();
+
+    auto& vertex = vertices[item.block][static_cast<uint8_t>(item.side)];
+    if(vertex.done)
+    {
+      continue; // already reached with lower cost
+    }
+    vertex.done = true;
+
+    if(item.block == &toBlock) // found, collect the paths from destination to source:
+    {
+      std::vector<std::shared_ptr<BlockPath>> paths;
+      for(BlockPath* path = vertex.path; path; path = vertices[&path->fromBlock()][static_cast<uint8_t>(path->fromSide())].path)
+      {
+        paths.emplace_back(path->shared_from_this());
+      }
+      std::reverse(paths.begin(), paths.end());
+      return std::make_shared<TrainRoute>(std::move(paths), item.cost);
+    }
+
+    for(const auto& path : item.block->paths())
+    {
+      if(path->fromSide() != item.side)
+      {
+        continue;
+      }
+
+      auto block = path->toBlock();
+      if(!block || block->state != BlockState::Free || !path->isAvailable(train))
+      {
+        continue;
+      }
+
+      const double cost = item.cost + blockCost(*block, speedMax);
+      const auto side = (path->toSide() == BlockSide::A) ? BlockSide::B : BlockSide::A; // train leaves at the other side
+      auto& next = vertices[block.get()][static_cast<uint8_t>(side)];
+      if(cost < next.cost)
+      {
+        next.cost = cost;
+        next.path = path.get();
+        queue.emplace(Item{cost, block.get(), side});
+      }
+    }
+  }
+
+  return {};
 }
 
 
@@ -26,6 +26,8 @@
 #include "../../core/method.hpp"
 
 class BlockRailTile;
+class Train;
+class TrainRoute;
 enum class BlockTrainDirection : uint8_t;
 
 class TrainPathFinder : public PathFinder
@@ -34,8 +36,21 @@ class TrainPathFinder : public PathFinder
 
 public:
   Method<bool(const std::shared_ptr<BlockRailTile>&, BlockTrainDirection, const std::shared_ptr<BlockRailTile>&, BlockTrainDirection)> reserve;
+  Method<std::shared_ptr<TrainRoute>(const std::shared_ptr<BlockRailTile>&, BlockTrainDirection, const std::shared_ptr<BlockRailTile>&)> findRoute;
 
   TrainPathFinder(Object& parent_, std::string_view parentPropertyName);
+
+  /**
+   * \brief Find the fastest route from one block to another
+   *
+   * Only paths that can be reserved now are used: all blocks on the route
+   * must be free and no path may be blocked by reserved turnouts, crossings,
+   * bridges or direction controls. One way tiles are respected by the paths.
+   *
+   * \param[in] train Train to find the route for, may be \c nullptr if the from block is free.
+   * \return The route or \c nullptr if there is no route.
+   */
+  static std::shared_ptr<TrainRoute> find(BlockRailTile& fromBlock, BlockTrainDirection fromDirection, const BlockRailTile& toBlock, const std::shared_ptr<Train>& train = {});
 };
 
 #endif
\ No newline at end of file
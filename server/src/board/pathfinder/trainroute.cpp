@@ -0,0 +1,42 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "trainroute.hpp"
+#include <cassert>
+#include "../map/blockpath.hpp"
+#include "../tile/rail/blockrailtile.hpp"
+#include "../../core/objectvectorproperty.tpp"
+
+TrainRoute::TrainRoute(std::vector<std::shared_ptr<BlockPath>> paths, double cost_)
+  : m_paths{std::move(paths)}
+  , blocks{*this, "blocks", {}, PropertyFlags::ReadOnly | PropertyFlags::NoStore | PropertyFlags::ScriptReadOnly}
+  , cost{this, "cost", cost_, PropertyFlags::ReadOnly | PropertyFlags::NoStore | PropertyFlags::ScriptReadOnly}
+{
+  assert(!m_paths.empty());
+  blocks.appendInternal(m_paths.front()->fromBlock().shared_ptr<BlockRailTile>());
+  for(const auto& path : m_paths)
+  {
+    blocks.appendInternal(path->toBlock());
+  }
+
+  m_interfaceItems.add(blocks);
+  m_interfaceItems.add(cost);
+}
@@ -0,0 +1,52 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TRAINTASTIC_SERVER_BOARD_PATHFINDER_TRAINROUTE_HPP
+#define TRAINTASTIC_SERVER_BOARD_PATHFINDER_TRAINROUTE_HPP
+
+#include "../../core/nonpersistentobject.hpp"
+#include "../../core/property.hpp"
+#include "../../core/objectvectorproperty.hpp"
+
+class BlockRailTile;
+class BlockPath;
+
+//! \brief Sequence of block paths from one block to another, found by the TrainPathFinder
+class TrainRoute final : public NonPersistentObject
+{
+  CLASS_ID("train_route")
+
+private:
+  std::vector<std::shared_ptr<BlockPath>> m_paths;
+
+public:
+  ObjectVectorProperty<BlockRailTile> blocks; //!< All blocks of the route, including the from and to block
+  Property<double> cost; //!< Estimated time to travel the route in seconds
+
+  TrainRoute(std::vector<std::shared_ptr<BlockPath>> paths, double cost_);
+
+  const std::vector<std::shared_ptr<BlockPath>>& paths() const
+  {
+    return m_paths;
+  }
+};
+
+#endif
@@ -622,7 +622,17 @@ void BlockRailTile::setRotate(TileRotate value)
 
 void BlockRailTile::boardModified()
 {
-  updatePaths(); //! \todo improvement: only update if a connected tile is changed
+  updatePaths(); // only called if links near the block are changed
+}
+
+std::shared_ptr<BlockPath> BlockRailTile::getPath(BlockSide fromSide, const BlockRailTile& toBlock, BlockSide toSide) const
+{
+  // the block pointer is only a key, a removed block is checked for:
+  if(auto it = m_pathIndex.find({fromSide, &toBlock, toSide}); it != m_pathIndex.end() && it->second->toBlock().get() == &toBlock)
+  {
+    return it->second;
+  }
+  return {};
 }
 
 std::shared_ptr<TrainBlockStatus> BlockRailTile::getBlockTrainStatus(const std::shared_ptr<Train>& train)
@@ -673,6 +683,12 @@ void BlockRailTile::updatePaths()
     path->toBlock()->m_pathsIn.emplace_back(path);
     m_paths.emplace_back(std::move(path));
   }
+
+  m_pathIndex.clear();
+  for(const auto& path : m_paths)
+  {
+    m_pathIndex.emplace(PathKey{path->fromSide(), path->toBlock().get(), path->toSide()}, path); // keeps the first
+  }
 }
 
 void BlockRailTile::updateHeightWidthMax()
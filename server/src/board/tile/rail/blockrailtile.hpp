@@ -25,6 +25,8 @@
 
 #include "railtile.hpp"
 #include <array>
+#include <map>
+#include <tuple>
 #include <traintastic/enum/blocktraindirection.hpp>
 #include "../../map/node.hpp"
 #include "../../../core/lengthproperty.hpp"
@@ -51,10 +53,12 @@ class BlockRailTile : public RailTile
 
   private:
     using Paths = std::vector<std::shared_ptr<BlockPath>>;
+    using PathKey = std::tuple<BlockSide, const BlockRailTile*, BlockSide>; //!< from side, to block, to side
 
     Node m_node;
     Paths m_paths; //!< Paths from this block to other block
     Paths m_pathsIn; //!< Paths from other blocks to this block
+    std::map<PathKey, std::shared_ptr<BlockPath>> m_pathIndex; //!< First path of m_paths per target, see getPath()
     std::array<std::weak_ptr<BlockPath>, 2> m_reservedPaths; // index is BlockSide
 
     std::shared_ptr<TrainBlockStatus> getBlockTrainStatus(const std::shared_ptr<Train>& train);
@@ -81,7 +85,7 @@ class BlockRailTile : public RailTile
     void setState(BlockState value);
 
   public:
-    boost::signals2::signal<void (const BlockRailTile&, BlockState)> stateChanged;
+    Signal<void (const BlockRailTile&, BlockState)> stateChanged;
 
     Property<std::string> name;
     LengthProperty length;
@@ -111,6 +115,10 @@ class BlockRailTile : public RailTile
       return m_paths;
     }
 
+    //! \brief Get path from this block to another block
+    //! \return Path or \c nullptr if there is no such path
+    std::shared_ptr<BlockPath> getPath(BlockSide fromSide, const BlockRailTile& toBlock, BlockSide toSide) const;
+
     void inputItemValueChanged(BlockInputMapItem& item);
     void identificationEvent(BlockInputMapItem& item, IdentificationEventType eventType, uint16_t identifier, Direction direction, uint8_t category);
 
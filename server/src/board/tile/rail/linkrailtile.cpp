@@ -27,6 +27,7 @@
 #include "../../../core/objectproperty.tpp"
 #include "../../../utils/displayname.hpp"
 #include "../../../world/world.hpp"
+#include "../../board.hpp"
 
 LinkRailTile::LinkRailTile(World& world, std::string_view _id)
   : RailTile(world, _id, TileId::RailLink)
@@ -38,10 +39,14 @@ LinkRailTile::LinkRailTile(World& world, std::string_view _id)
         if(newValue.get() == this)
           return false;
 
+        // link changes affect the block paths on both boards:
+        getBoard().tileModified(*this);
+
         if(link)
         {
           assert(link->link.value().get() == this);
           link->link.setValueInternal(nullptr);
+          link->getBoard().tileModified(*link);
         }
 
         if(newValue)
@@ -50,8 +55,10 @@ LinkRailTile::LinkRailTile(World& world, std::string_view _id)
           {
             assert(newValue->link->link.value() == newValue);
             newValue->link->link.setValueInternal(nullptr);
+            newValue->link->getBoard().tileModified(*newValue->link);
           }
           newValue->link.setValueInternal(shared_ptr<LinkRailTile>());
+          newValue->getBoard().tileModified(*newValue);
         }
 
         return true;
@@ -66,7 +66,7 @@ class SignalRailTile : public StraightRailTile
   public:
     static std::optional<OutputActionValue> getDefaultActionValue(SignalAspect signalAspect, OutputType outputType, size_t outputIndex);
 
-    boost::signals2::signal<void (const SignalRailTile&, SignalAspect)> aspectChanged;
+    Signal<void (const SignalRailTile&, SignalAspect)> aspectChanged;
 
     Property<std::string> name;
     Property<AutoYesNo> requireReservation;
@@ -59,7 +59,7 @@ class TurnoutRailTile : public RailTile
     void connectOutputMap();
 
   public:
-    boost::signals2::signal<void (const TurnoutRailTile&, TurnoutPosition)> positionChanged;
+    Signal<void (const TurnoutRailTile&, TurnoutPosition)> positionChanged;
 
     Property<std::string> name;
     Property<TurnoutPosition> position;
@@ -28,6 +28,7 @@
 #include "time.hpp"
 #include "../core/property.hpp"
 #include "../core/event.hpp"
+#include <boost/signals2/signal.hpp>
 
 class Clock : public SubObject
 {
@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2021-2022 Reinder Feenstra
+ * Copyright (C) 2021-2022,2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -28,6 +28,7 @@ AbstractEvent::AbstractEvent(Object& object, std::string_view name, EventFlags f
   : InterfaceItem(object, name)
   , m_flags{flags}
 {
+  m_kind = itemKind;
 }
 
 AbstractEvent::~AbstractEvent()
@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2021-2022,2025 Reinder Feenstra
+ * Copyright (C) 2021-2022,2025-2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -42,6 +42,8 @@ class AbstractEvent : public InterfaceItem
     void fire(const Arguments& args);
 
   public:
+    static constexpr InterfaceItemKind itemKind = InterfaceItemKind::Event;
+
     AbstractEvent(Object& object, std::string_view name, EventFlags m_flags);
     ~AbstractEvent() override;
 
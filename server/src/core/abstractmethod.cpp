@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2019-2021 Reinder Feenstra
+ * Copyright (C) 2019-2021,2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -26,4 +26,5 @@ AbstractMethod::AbstractMethod(Object& object, std::string_view name, MethodFlag
   : InterfaceItem(object, name)
   , m_flags{flags}
 {
+  m_kind = itemKind;
 }
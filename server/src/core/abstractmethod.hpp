@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2019-2022,2025 Reinder Feenstra
+ * Copyright (C) 2019-2022,2025-2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -99,6 +99,8 @@ class AbstractMethod : public InterfaceItem
 
     using Result = std::variant<std::monostate, bool, int64_t, double, std::string, ObjectPtr>;
 
+    static constexpr InterfaceItemKind itemKind = InterfaceItemKind::Method;
+
     AbstractMethod(Object& object, std::string_view name, MethodFlags m_flags = noMethodFlags);
 
     inline bool isScriptCallable() const
@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2019-2020 Reinder Feenstra
+ * Copyright (C) 2019-2020,2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -28,9 +28,12 @@
 class AbstractObjectProperty : public AbstractProperty
 {
   public:
+    static constexpr InterfaceItemKind itemKind = InterfaceItemKind::ObjectProperty;
+
     AbstractObjectProperty(Object* object, std::string_view name, PropertyFlags flags) :
       AbstractProperty(*object, name, ValueType::Object, flags)
     {
+      m_kind = itemKind;
     }
 
     std::string_view enumName() const final
@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2019-2021 Reinder Feenstra
+ * Copyright (C) 2019-2021,2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -32,9 +32,12 @@ class AbstractProperty : public BaseProperty
     AbstractProperty(Object& object, std::string_view name, ValueType type, PropertyFlags flags) :
       BaseProperty{object, name, type, flags}
     {
+      m_kind = itemKind;
     }
 
   public:
+    static constexpr InterfaceItemKind itemKind = InterfaceItemKind::Property;
+
     virtual bool toBool() const = 0;
     virtual int64_t toInt64() const = 0;
     virtual double toDouble() const = 0;
@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2019-2020 Reinder Feenstra
+ * Copyright (C) 2019-2020,2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -30,9 +30,12 @@
 class AbstractUnitProperty : public AbstractProperty
 {
   public:
+    static constexpr InterfaceItemKind itemKind = InterfaceItemKind::UnitProperty;
+
     AbstractUnitProperty(Object& object, std::string_view name, ValueType type, PropertyFlags flags) :
       AbstractProperty(object, name, type, flags)
     {
+      m_kind = itemKind;
     }
 
     virtual std::string_view unitName() const = 0;
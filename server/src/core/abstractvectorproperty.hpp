@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2021,2023,2025 Reinder Feenstra
+ * Copyright (C) 2021,2023,2025-2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -33,9 +33,12 @@ class AbstractVectorProperty : public BaseProperty
     AbstractVectorProperty(Object& object, std::string_view name, ValueType type, PropertyFlags flags) :
       BaseProperty{object, name, type, flags}
     {
+      m_kind = itemKind;
     }
 
   public:
+    static constexpr InterfaceItemKind itemKind = InterfaceItemKind::VectorProperty;
+
     inline bool empty() const { return size() == 0; }
     virtual size_t size() const = 0;
 
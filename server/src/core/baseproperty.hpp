@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2021,2023 Reinder Feenstra
+ * Copyright (C) 2021,2023,2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -35,11 +35,17 @@ class BaseProperty : public InterfaceItem
     const ValueType m_type;
     const PropertyFlags m_flags;
 
+  public:
+    static constexpr InterfaceItemKind itemKind = InterfaceItemKind::BaseProperty;
+
+  protected:
+
     BaseProperty(Object& object, std::string_view name, ValueType type, PropertyFlags flags) :
       InterfaceItem{object, name},
       m_type{type},
       m_flags{flags}
     {
+      m_kind = itemKind;
       assert(type != ValueType::Invalid);
       assert(is_access_valid(flags));
       assert(is_store_valid(flags));
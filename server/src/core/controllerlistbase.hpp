@@ -36,7 +36,7 @@ class ControllerListBase : public AbstractObjectList
 
   private:
     std::vector<ObjectPtr> m_items;
-    std::unordered_map<Object*, boost::signals2::connection> m_propertyChanged;
+    std::unordered_map<Object*, SignalConnection> m_propertyChanged;
     std::vector<ControllerListBaseTableModel*> m_models;
 
     void rowCountChanged();
@@ -24,6 +24,7 @@
 #define TRAINTASTIC_SERVER_CORE_EVENT_HPP
 
 #include "abstractevent.hpp"
+#include "signal.hpp"
 
 template<class... Args>
 class Event : public AbstractEvent
@@ -31,7 +32,7 @@ class Event : public AbstractEvent
   friend class Object;
 
   public:
-    using Signal = typename boost::signals2::signal<void (Args...)>;
+    using Signal = ::Signal<void (Args...)>;
 
   private:
     Signal m_signal;
@@ -72,9 +73,9 @@ class Event : public AbstractEvent
       return {typeInfoArray<Args...>};
     }
 
-    inline auto connect(const typename Signal::slot_type& slot, boost::signals2::connect_position position = boost::signals2::at_back)
+    inline SignalConnection connect(typename Signal::SlotFunction slot)
     {
-      return m_signal.connect(slot, position);
+      return m_signal.connect(std::move(slot));
     }
 };
 
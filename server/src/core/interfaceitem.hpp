@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2019-2022,2025 Reinder Feenstra
+ * Copyright (C) 2019-2022,2025-2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -23,6 +23,7 @@
 #ifndef TRAINTASTIC_SERVER_CORE_INTERFACEITEM_HPP
 #define TRAINTASTIC_SERVER_CORE_INTERFACEITEM_HPP
 
+#include <cstdint>
 #include <unordered_map>
 #include <string>
 #include <memory>
@@ -34,6 +35,19 @@
 class Object;
 class AbstractValuesAttribute;
 
+//! \brief Kind of interface item, a derived kind includes the bits of its base
+enum class InterfaceItemKind : uint8_t
+{
+  Unknown = 0,
+  Method = 0x01, //!< AbstractMethod
+  Event = 0x02, //!< AbstractEvent
+  BaseProperty = 0x04, //!< BaseProperty
+  Property = BaseProperty | 0x08, //!< AbstractProperty
+  ObjectProperty = Property | 0x10, //!< AbstractObjectProperty
+  UnitProperty = Property | 0x20, //!< AbstractUnitProperty
+  VectorProperty = BaseProperty | 0x40, //!< AbstractVectorProperty
+};
+
 class InterfaceItem
 {
   friend struct Attributes;
@@ -44,6 +58,7 @@ class InterfaceItem
   protected:
     Object& m_object;
     std::string_view m_name;
+    InterfaceItemKind m_kind = InterfaceItemKind::Unknown; //!< set by the constructor of each abstract item class
     Attributes m_attributes;
 
     template<typename T>
@@ -132,6 +147,17 @@ class InterfaceItem
       return m_name;
     }
 
+    InterfaceItemKind kind() const
+    {
+      return m_kind;
+    }
+
+    //! \brief Check if item is a \a kind, e.g. an ObjectProperty is also a Property
+    bool isKind(InterfaceItemKind kind) const
+    {
+      return (static_cast<uint8_t>(m_kind) & static_cast<uint8_t>(kind)) == static_cast<uint8_t>(kind);
+    }
+
     const Attributes& attributes() const
     {
       return m_attributes;
@@ -163,4 +189,17 @@ class InterfaceItem
     const AbstractValuesAttribute* tryGetValuesAttribute(AttributeName name) const;
 };
 
+//! \brief Cast to \a T using the item kind instead of RTTI, \c nullptr if the item isn't a \a T
+template<class T>
+inline T* interfaceItemCast(InterfaceItem* item)
+{
+  return (item && item->isKind(T::itemKind)) ? static_cast<T*>(item) : nullptr;
+}
+
+template<class T>
+inline const T* interfaceItemCast(const InterfaceItem* item)
+{
+  return (item && item->isKind(T::itemKind)) ? static_cast<const T*>(item) : nullptr;
+}
+
 #endif
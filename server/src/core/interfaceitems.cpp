@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2019-2021 Reinder Feenstra
+ * Copyright (C) 2019-2021,2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -23,13 +23,16 @@
 #include "interfaceitems.hpp"
 #include "interfaceitem.hpp"
 #include <algorithm>
+#include <memory>
+#include <string>
+#include <unordered_map>
 
 #ifndef NDEBUG
 #include "abstractproperty.hpp"
 
 static void check(const InterfaceItem& item)
 {
-  if(const AbstractProperty* property = dynamic_cast<const AbstractProperty*>(&item))
+  if(const AbstractProperty* property = interfaceItemCast<AbstractProperty>(&item))
   {
     if(property->type() == ValueType::Enum)
       assert(property->attributes().find(AttributeName::Values) != property->attributes().cend()); // enum property must have a Values attribute
@@ -37,10 +40,74 @@ static void check(const InterfaceItem& item)
 }
 #endif
 
-InterfaceItem* InterfaceItems::find(std::string_view name) const
+struct InterfaceItems::Layout
 {
-  auto it = m_items.find(name);
-  return (it != m_items.end()) ? &it->second : nullptr;
+  std::unordered_map<std::string_view, uint16_t> slots; //!< keys point into the layout registry key
+};
+
+void InterfaceItems::bind() const
+{
+  // objects with generated item names would each get their own layout, stop sharing if there are that many:
+  static constexpr size_t layoutsMax = 4096;
+  static std::unordered_map<std::string, std::unique_ptr<const Layout>> layouts; // key: names, NUL separated
+
+  m_bound = true;
+  m_layout = nullptr;
+
+  if(m_items.size() >= noSlot)
+    return;
+
+  std::string key;
+  for(const auto* item : m_items)
+    key.append(item->name()).push_back('\0');
+
+  if(auto it = layouts.find(key); it != layouts.end())
+  {
+    m_layout = it->second.get();
+    return;
+  }
+
+  if(layouts.size() >= layoutsMax)
+    return;
+
+  auto layout = std::make_unique<Layout>();
+  auto it = layouts.emplace(std::move(key), nullptr).first;
+  std::string_view names = it->first;
+  layout->slots.reserve(m_items.size());
+  for(uint16_t i = 0; i < m_items.size(); i++)
+  {
+    const auto name = names.substr(0, m_items[i]->name().size());
+    layout->slots.emplace(name, i); // first one wins if a name is used twice
+    names.remove_prefix(name.size() + 1);
+  }
+  it->second = std::move(layout);
+  m_layout = it->second.get();
+}
+
+uint16_t InterfaceItems::slot(std::string_view name) const
+{
+  if(!m_bound)
+    bind();
+
+  if(m_layout)
+  {
+    auto it = m_layout->slots.find(name);
+    return (it != m_layout->slots.end()) ? it->second : noSlot;
+  }
+
+  for(size_t i = 0; i < m_items.size(); i++)
+    if(m_items[i]->name() == name)
+      return static_cast<uint16_t>(i);
+  return noSlot;
+}
+
+InterfaceItem* InterfaceItems::find(std::string_view name, uint16_t& cachedSlot) const
+{
+  if(cachedSlot < m_items.size() && m_items[cachedSlot]->name() == name) [[likely]]
+    return m_items[cachedSlot];
+
+  cachedSlot = slot(name);
+  return (cachedSlot != noSlot) ? m_items[cachedSlot] : nullptr;
 }
 
 void InterfaceItems::add(InterfaceItem& item)
@@ -48,8 +115,8 @@ void InterfaceItems::add(InterfaceItem& item)
 #ifndef NDEBUG
   check(item);
 #endif
-  m_items.emplace(item.name(), item);
-  m_itemOrder.push_back(item.name());
+  m_items.push_back(&item);
+  m_bound = false;
 }
 
 void InterfaceItems::insertBefore(InterfaceItem& item, const InterfaceItem& before)
@@ -57,6 +124,6 @@ void InterfaceItems::insertBefore(InterfaceItem& item, const InterfaceItem& befo
 #ifndef NDEBUG
   check(item);
 #endif
-  m_items.emplace(item.name(), item);
-  m_itemOrder.insert(std::find(m_itemOrder.begin(), m_itemOrder.end(), before.name()), item.name());
+  m_items.insert(std::find(m_items.begin(), m_items.end(), &before), &item);
+  m_bound = false;
 }
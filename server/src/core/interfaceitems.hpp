@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2019-2021 Reinder Feenstra
+ * Copyright (C) 2019-2021,2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -23,32 +23,62 @@
 #ifndef TRAINTASTIC_SERVER_CORE_INTERFACEITEMS_HPP
 #define TRAINTASTIC_SERVER_CORE_INTERFACEITEMS_HPP
 
-#include <unordered_map>
-#include <list>
+#include <cstdint>
 #include <string_view>
+#include <vector>
 
 class InterfaceItem;
 
+/**
+ * \brief Interface items of an object in order
+ *
+ * The items are stored in a flat vector, the index of an item is its slot.
+ * The name to slot table is shared by all objects with the same items,
+ * which in practice is all objects of a class, it is built by the first
+ * lookup of the first object. Adding an item after that rebinds the object.
+ *
+ * Must only be used from the event loop.
+ */
 class InterfaceItems
 {
-  protected:
-    std::unordered_map<std::string_view, InterfaceItem&> m_items;
-    std::list<std::string_view> m_itemOrder;
+  private:
+    struct Layout;
+
+    std::vector<InterfaceItem*> m_items;
+    mutable const Layout* m_layout = nullptr; //!< \c nullptr if there is no shared table, a linear search is used then
+    mutable bool m_bound = false;
+
+    void bind() const;
 
   public:
-    using const_iterator = std::unordered_map<std::string_view, InterfaceItem&>::const_iterator;
+    using const_iterator = std::vector<InterfaceItem*>::const_iterator;
+
+    static constexpr uint16_t noSlot = UINT16_MAX;
 
     inline const_iterator begin() const { return m_items.cbegin(); }
     inline const_iterator end() const { return m_items.cend(); }
+    inline size_t size() const { return m_items.size(); }
+
+    inline InterfaceItem& operator[](uint16_t slot) const { return *m_items[slot]; }
 
-    const std::list<std::string_view>& names() const { return m_itemOrder; }
+    uint16_t slot(std::string_view name) const;
 
-    InterfaceItem* find(std::string_view name) const;
+    inline InterfaceItem* find(std::string_view name) const
+    {
+      const auto n = slot(name);
+      return (n != noSlot) ? m_items[n] : nullptr;
+    }
+
+    /**
+     * \brief Find item using a cached slot
+     *
+     * If the item in \a cachedSlot has the name the table lookup is skipped,
+     * else \a cachedSlot is updated. A stale or foreign cache is harmless.
+     */
+    InterfaceItem* find(std::string_view name, uint16_t& cachedSlot) const;
 
     void add(InterfaceItem& item);
     void insertBefore(InterfaceItem& item, const InterfaceItem& before);
-
-    inline InterfaceItem& operator[](std::string_view name) const { return m_items.at(name); }
 };
 
 #endif
@@ -60,64 +60,64 @@ InterfaceItem* Object::getItem(std::string_view name)
 
 const AbstractMethod* Object::getMethod(std::string_view name) const
 {
-  return dynamic_cast<const AbstractMethod*>(getItem(name));
+  return interfaceItemCast<AbstractMethod>(getItem(name));
 }
 
 AbstractMethod* Object::getMethod(std::string_view name)
 {
-  return dynamic_cast<AbstractMethod*>(getItem(name));
+  return interfaceItemCast<AbstractMethod>(getItem(name));
 }
 
 const AbstractProperty* Object::getProperty(std::string_view name) const
 {
-  return dynamic_cast<const AbstractProperty*>(getItem(name));
+  return interfaceItemCast<AbstractProperty>(getItem(name));
 }
 
 AbstractProperty* Object::getProperty(std::string_view name)
 {
-  return dynamic_cast<AbstractProperty*>(getItem(name));
+  return interfaceItemCast<AbstractProperty>(getItem(name));
 }
 
 const AbstractObjectProperty* Object::getObjectProperty(std::string_view name) const
 {
-  return dynamic_cast<const AbstractObjectProperty*>(getItem(name));
+  return interfaceItemCast<AbstractObjectProperty>(getItem(name));
 }
 
 AbstractObjectProperty* Object::getObjectProperty(std::string_view name)
 {
-  return dynamic_cast<AbstractObjectProperty*>(getItem(name));
+  return interfaceItemCast<AbstractObjectProperty>(getItem(name));
 }
 
 const AbstractVectorProperty* Object::getVectorProperty(std::string_view name) const
 {
-  return dynamic_cast<const AbstractVectorProperty*>(getItem(name));
+  return interfaceItemCast<AbstractVectorProperty>(getItem(name));
 }
 
 AbstractVectorProperty* Object::getVectorProperty(std::string_view name)
 {
-  return dynamic_cast<AbstractVectorProperty*>(getItem(name));
+  return interfaceItemCast<AbstractVectorProperty>(getItem(name));
 }
 
 const AbstractEvent* Object::getEvent(std::string_view name) const
 {
-  return dynamic_cast<const AbstractEvent*>(getItem(name));
+  return interfaceItemCast<AbstractEvent>(getItem(name));
 }
 
 AbstractEvent* Object::getEvent(std::string_view name)
 {
-  return dynamic_cast<AbstractEvent*>(getItem(name));
+  return interfaceItemCast<AbstractEvent>(getItem(name));
 }
 
 void Object::load(WorldLoader& loader, const nlohmann::json& data)
 {
   for(auto& [name, value] : data.items())
-    if(auto* baseProperty = dynamic_cast<BaseProperty*>(getItem(name)))
+    if(auto* baseProperty = interfaceItemCast<BaseProperty>(getItem(name)))
       loadJSON(loader, *baseProperty, value);
 
   // state values (optional):
   nlohmann::json state = loader.getState(getObjectId());
   for(auto& [name, value] : state.items())
-    if(auto* baseProperty = dynamic_cast<BaseProperty*>(getItem(name)))
+    if(auto* baseProperty = interfaceItemCast<BaseProperty>(getItem(name)))
       loadJSON(loader, *baseProperty, value);
 }
 
@@ -125,8 +125,8 @@ void Object::save(WorldSaver& saver, nlohmann::json& data, nlohmann::json& state
 {
   data["class_id"] = getClassId();
 
-  for(const auto& item : interfaceItems())
-    if(BaseProperty* baseProperty = dynamic_cast<BaseProperty*>(&item.second))
+  for(auto* item : interfaceItems())
+    if(BaseProperty* baseProperty = interfaceItemCast<BaseProperty>(item))
     {
       if(baseProperty->isStoreable())
       {
@@ -141,14 +141,14 @@ void Object::save(WorldSaver& saver, nlohmann::json& data, nlohmann::json& state
 
 void Object::loaded()
 {
-  for(const auto& it : m_interfaceItems)
+  for(auto* item : m_interfaceItems)
   {
-    if(AbstractProperty* property = dynamic_cast<AbstractProperty*>(&it.second);
+    if(AbstractProperty* property = interfaceItemCast<AbstractProperty>(item);
         property && contains(property->flags(), PropertyFlags::SubObject))
     {
       property->toObject()->loaded();
     }
-    else if(AbstractVectorProperty* vectorProperty = dynamic_cast<AbstractVectorProperty*>(&it.second);
+    else if(AbstractVectorProperty* vectorProperty = interfaceItemCast<AbstractVectorProperty>(item);
         vectorProperty && contains(vectorProperty->flags(), PropertyFlags::SubObject))
     {
       const size_t size = vectorProperty->size();
@@ -160,9 +160,9 @@ void Object::loaded()
 
 void Object::worldEvent(WorldState state, WorldEvent event)
 {
-  for(const auto& it : m_interfaceItems)
+  for(auto* item : m_interfaceItems)
   {
-    if(AbstractProperty* property = dynamic_cast<AbstractProperty*>(&it.second);
+    if(AbstractProperty* property = interfaceItemCast<AbstractProperty>(item);
         property && contains(property->flags(), PropertyFlags::SubObject))
     {
       if(auto object = property->toObject())
@@ -170,7 +170,7 @@ void Object::worldEvent(WorldState state, WorldEvent event)
         object->worldEvent(state, event);
       }
     }
-    else if(AbstractVectorProperty* vectorProperty = dynamic_cast<AbstractVectorProperty*>(&it.second);
+    else if(AbstractVectorProperty* vectorProperty = interfaceItemCast<AbstractVectorProperty>(item);
         vectorProperty && contains(vectorProperty->flags(), PropertyFlags::SubObject))
     {
       const size_t size = vectorProperty->size();
@@ -187,9 +187,9 @@ void Object::worldEvent(WorldState state, WorldEvent event)
 
 void Object::worldFeaturesChanged(WorldFeatures features, WorldFeature changed)
 {
-  for(const auto& it : m_interfaceItems)
+  for(auto* item : m_interfaceItems)
   {
-    if(AbstractProperty* property = dynamic_cast<AbstractProperty*>(&it.second);
+    if(AbstractProperty* property = interfaceItemCast<AbstractProperty>(item);
         property && contains(property->flags(), PropertyFlags::SubObject))
     {
       if(auto object = property->toObject())
@@ -197,7 +197,7 @@ void Object::worldFeaturesChanged(WorldFeatures features, WorldFeature changed)
         object->worldFeaturesChanged(features, changed);
       }
     }
-    else if(AbstractVectorProperty* vectorProperty = dynamic_cast<AbstractVectorProperty*>(&it.second);
+    else if(AbstractVectorProperty* vectorProperty = interfaceItemCast<AbstractVectorProperty>(item);
         vectorProperty && contains(vectorProperty->flags(), PropertyFlags::SubObject))
     {
       const size_t size = vectorProperty->size();
@@ -216,7 +216,7 @@ nlohmann::json Object::toJSON(WorldSaver& saver, const BaseProperty& basePropert
 {
   if(baseProperty.type() == ValueType::Object)
   {
-    if(const AbstractProperty* property = dynamic_cast<const AbstractProperty*>(&baseProperty))
+    if(const AbstractProperty* property = interfaceItemCast<AbstractProperty>(&baseProperty))
     {
       if(ObjectPtr value = property->toObject())
       {
@@ -235,7 +235,7 @@ nlohmann::json Object::toJSON(WorldSaver& saver, const BaseProperty& basePropert
       return nullptr;
     }
 
-    if(const AbstractVectorProperty* vectorProperty = dynamic_cast<const AbstractVectorProperty*>(&baseProperty))
+    if(const AbstractVectorProperty* vectorProperty = interfaceItemCast<AbstractVectorProperty>(&baseProperty))
     {
       nlohmann::json values(nlohmann::json::value_t::array);
 
@@ -264,7 +264,7 @@ nlohmann::json Object::toJSON(WorldSaver& saver, const BaseProperty& basePropert
 
 void Object::loadJSON(WorldLoader& loader, BaseProperty& baseProperty, const nlohmann::json& value)
 {
-  if(auto* property = dynamic_cast<AbstractProperty*>(&baseProperty))
+  if(auto* property = interfaceItemCast<AbstractProperty>(&baseProperty))
   {
     if(property->type() == ValueType::Object)
     {
@@ -283,7 +283,7 @@ void Object::loadJSON(WorldLoader& loader, BaseProperty& baseProperty, const nlo
     else
       property->loadJSON(value);
   }
-  else if(auto* vectorProperty = dynamic_cast<AbstractVectorProperty*>(&baseProperty))
+  else if(auto* vectorProperty = interfaceItemCast<AbstractVectorProperty>(&baseProperty))
   {
     if(vectorProperty->type() == ValueType::Object)
     {
@@ -23,7 +23,7 @@
 #define TRAINTASTIC_SERVER_CORE_OBJECT_HPP
 
 #include "objectptr.hpp"
-#include <boost/signals2/signal.hpp>
+#include "signal.hpp"
 #include <nlohmann/json.hpp>
 #include "interfaceitems.hpp"
 #include "argument.hpp"
@@ -98,10 +98,10 @@ class Object : public std::enable_shared_from_this<Object>
     Object(const Object&) = delete;
     Object& operator =(const Object&) = delete;
 
-    boost::signals2::signal<void (Object&)> onDestroying;
-    boost::signals2::signal<void (BaseProperty&)> propertyChanged;
-    boost::signals2::signal<void (AbstractAttribute&)> attributeChanged;
-    boost::signals2::signal<void (const AbstractEvent&, const Arguments&)> onEventFired;
+    Signal<void (Object&)> onDestroying;
+    Signal<void (BaseProperty&)> propertyChanged;
+    Signal<void (AbstractAttribute&)> attributeChanged;
+    Signal<void (const AbstractEvent&, const Arguments&)> onEventFired;
 
     Object();
     virtual ~Object() = default;
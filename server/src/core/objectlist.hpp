@@ -25,6 +25,8 @@
 
 #include "abstractobjectlist.hpp"
 #include <cassert>
+#include <limits>
+#include <unordered_map>
 #include "idobject.hpp"
 #include "subobject.hpp"
 
@@ -41,8 +43,11 @@ class ObjectList : public AbstractObjectList
     using const_iterator = typename Items::const_iterator;
 
   protected:
+    static constexpr uint32_t invalidRow = std::numeric_limits<uint32_t>::max();
+
     Items m_items;
-    std::unordered_map<Object*, boost::signals2::scoped_connection> m_propertyChanged;
+    std::unordered_map<const Object*, uint32_t> m_rows; //!< object to row index
+    std::unordered_map<Object*, ScopedSignalConnection> m_propertyChanged;
     std::vector<ObjectListTableModel<T>*> m_models;
 
     void deleteMethodHandler(const std::shared_ptr<T>& object)
@@ -69,6 +74,7 @@ class ObjectList : public AbstractObjectList
     void setItems(const std::vector<ObjectPtr>& items)
     {
       m_propertyChanged.clear();
+      m_rows.clear();
       m_items.clear();
       m_items.reserve(items.size());
       for(auto& item : items)
@@ -82,19 +88,30 @@ class ObjectList : public AbstractObjectList
 
     virtual bool isListedProperty(std::string_view name) = 0;
 
+    uint32_t getRow(const Object& object) const
+    {
+      const auto it = m_rows.find(&object);
+      return it != m_rows.end() ? it->second : invalidRow;
+    }
+
+    //! \brief Update object to row index
+    //! Must be called after items are reordered.
+    void updateRows(uint32_t first, uint32_t last)
+    {
+      assert(last < m_items.size());
+      for(uint32_t row = first; row <= last; row++)
+        m_rows[m_items[row].get()] = row;
+    }
+
     virtual void propertyChanged(BaseProperty& property)
     {
       if(!m_models.empty() && isListedProperty(property.name()))
       {
-        ObjectPtr obj = property.object().shared_from_this();
-        const uint32_t rows = static_cast<uint32_t>(m_items.size());
-        for(uint32_t row = 0; row < rows; row++)
-          if(m_items[row] == obj)
-          {
-            for(auto& model : m_models)
-              model->propertyChanged(property, row);
-            break;
-          }
+        if(const uint32_t row = getRow(property.object()); row != invalidRow)
+        {
+          for(auto& model : m_models)
+            model->propertyChanged(property, row);
+        }
       }
     }
 
@@ -108,6 +125,7 @@ class ObjectList : public AbstractObjectList
 
     void rowsChanged(uint32_t first, uint32_t last)
     {
+      updateRows(first, last);
       for(auto& model : m_models)
       {
         model->rowsChanged(first, last);
@@ -143,12 +161,13 @@ class ObjectList : public AbstractObjectList
 
     bool containsObject(const std::shared_ptr<T>& object)
     {
-      return std::find(m_items.begin(), m_items.end(), object) != m_items.end();
+      return m_rows.contains(object.get());
     }
 
     void addObject(std::shared_ptr<T> object)
     {
       m_propertyChanged.emplace(object.get(), object->propertyChanged.connect(std::bind(&ObjectList<T>::propertyChanged, this, std::placeholders::_1)));
+      m_rows.emplace(object.get(), static_cast<uint32_t>(m_items.size()));
       m_items.emplace_back(std::move(object));
       objectAdded(m_items.back());
       rowCountChanged();
@@ -156,20 +175,19 @@ class ObjectList : public AbstractObjectList
 
     void removeObject(const std::shared_ptr<T>& object)
     {
-      auto it = std::find(m_items.begin(), m_items.end(), object);
-      if(it != m_items.end())
+      if(auto it = m_rows.find(object.get()); it != m_rows.end())
       {
-        const uint32_t row = std::distance(m_items.begin(), it);
-        m_propertyChanged[object.get()].disconnect();
-        m_propertyChanged.erase(object.get());
-        m_items.erase(it);
+        const uint32_t row = it->second;
+        m_rows.erase(it);
+        m_propertyChanged.erase(object.get()); // disconnects
+        m_items.erase(m_items.begin() + row);
+        if(row < m_items.size())
+          updateRows(row, static_cast<uint32_t>(m_items.size() - 1));
         objectRemoved(object);
-        rowCountChanged();
-        
+
+        length.setValueInternal(static_cast<uint32_t>(m_items.size()));
         for(auto& model : m_models)
-        {
-          model->rowRemovedHack(row);
-        }
+          model->removeRow(row);
       }
     }
 };
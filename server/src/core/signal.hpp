@@ -0,0 +1,273 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TRAINTASTIC_SERVER_CORE_SIGNAL_HPP
+#define TRAINTASTIC_SERVER_CORE_SIGNAL_HPP
+
+#include <memory>
+#include <vector>
+#include <functional>
+#include <algorithm>
+#include <cassert>
+
+namespace Detail {
+
+struct SignalState;
+
+struct SignalSlotBase
+{
+  SignalState* state;
+  bool connected = true;
+
+  explicit SignalSlotBase(SignalState* state_)
+    : state{state_}
+  {
+  }
+};
+
+//! Slot list of a signal, shared with running emits so the signal may be destroyed by a slot
+struct SignalState
+{
+  std::vector<std::shared_ptr<SignalSlotBase>> slots;
+  uint32_t emitDepth = 0;
+  bool hasDisconnectedSlots = false;
+
+  void slotDisconnected()
+  {
+    if(emitDepth == 0)
+      removeDisconnectedSlots();
+    else
+      hasDisconnectedSlots = true;
+  }
+
+  void removeDisconnectedSlots()
+  {
+    std::erase_if(slots, [](const auto& slot) { return !slot->connected; });
+    hasDisconnectedSlots = false;
+  }
+};
+
+}
+
+/**
+ * \brief Lightweight signal for use on the event loop thread only.
+ *
+ * Unlike boost::signals2 emitting doesn't lock or allocate, the slot list is
+ * only modified on connect and cleaned up after the outermost emit.
+ * Slots may connect and disconnect (any slot) while the signal is emitted,
+ * slots connected during an emit are called from the next emit on.
+ * A slot may also destroy the signal (or its owner), the running emit keeps
+ * the slot list alive and calls no further slots.
+ */
+class SignalBase
+{
+  protected:
+    std::shared_ptr<Detail::SignalState> m_state; //!< created on first connect
+
+    struct EmitGuard
+    {
+      const std::shared_ptr<Detail::SignalState> state;
+
+      explicit EmitGuard(std::shared_ptr<Detail::SignalState> state_)
+        : state{std::move(state_)}
+      {
+        state->emitDepth++;
+      }
+
+      ~EmitGuard()
+      {
+        if(--state->emitDepth == 0 && state->hasDisconnectedSlots)
+          state->removeDisconnectedSlots();
+      }
+    };
+
+    Detail::SignalState& state()
+    {
+      if(!m_state)
+        m_state = std::make_shared<Detail::SignalState>();
+      return *m_state;
+    }
+
+    SignalBase() = default;
+
+    ~SignalBase()
+    {
+      if(!m_state)
+        return;
+      for(auto& slot : m_state->slots)
+      {
+        slot->state = nullptr;
+        slot->connected = false;
+      }
+    }
+
+  public:
+    SignalBase(const SignalBase&) = delete;
+    SignalBase& operator =(const SignalBase&) = delete;
+
+    bool empty() const
+    {
+      return !m_state || std::none_of(m_state->slots.begin(), m_state->slots.end(), [](const auto& slot) { return slot->connected; });
+    }
+};
+
+class SignalConnection
+{
+  private:
+    std::weak_ptr<Detail::SignalSlotBase> m_slot;
+
+  public:
+    SignalConnection() = default;
+
+    explicit SignalConnection(std::weak_ptr<Detail::SignalSlotBase> slot)
+      : m_slot{std::move(slot)}
+    {
+    }
+
+    bool connected() const
+    {
+      const auto slot = m_slot.lock();
+      return slot && slot->connected;
+    }
+
+    void disconnect()
+    {
+      if(auto slot = m_slot.lock(); slot && slot->connected)
+      {
+        slot->connected = false;
+        if(slot->state)
+          slot->state->slotDisconnected();
+      }
+      m_slot.reset();
+    }
+};
+
+//! Disconnects the connection when destroyed or assigned a new one
+class ScopedSignalConnection
+{
+  private:
+    SignalConnection m_connection;
+
+  public:
+    ScopedSignalConnection() = default;
+
+    ScopedSignalConnection(SignalConnection connection)
+      : m_connection{std::move(connection)}
+    {
+    }
+
+    ScopedSignalConnection(ScopedSignalConnection&& other) noexcept
+      : m_connection{std::exchange(other.m_connection, {})}
+    {
+    }
+
+    ScopedSignalConnection(const ScopedSignalConnection&) = delete;
+
+    ~ScopedSignalConnection()
+    {
+      m_connection.disconnect();
+    }
+
+    ScopedSignalConnection& operator =(SignalConnection connection)
+    {
+      m_connection.disconnect();
+      m_connection = std::move(connection);
+      return *this;
+    }
+
+    ScopedSignalConnection& operator =(ScopedSignalConnection&& other) noexcept
+    {
+      if(this != &other)
+      {
+        m_connection.disconnect();
+        m_connection = std::exchange(other.m_connection, {});
+      }
+      return *this;
+    }
+
+    ScopedSignalConnection& operator =(const ScopedSignalConnection&) = delete;
+
+    bool connected() const
+    {
+      return m_connection.connected();
+    }
+
+    void disconnect()
+    {
+      m_connection.disconnect();
+    }
+
+    SignalConnection release()
+    {
+      return std::exchange(m_connection, {});
+    }
+};
+
+template<class Signature>
+class Signal;
+
+template<class... Args>
+class Signal<void(Args...)> : public SignalBase
+{
+  private:
+    struct Slot : Detail::SignalSlotBase
+    {
+      std::function<void(Args...)> function;
+
+      Slot(Detail::SignalState* state_, std::function<void(Args...)> function_)
+        : Detail::SignalSlotBase(state_)
+        , function{std::move(function_)}
+      {
+      }
+    };
+
+  public:
+    using SlotFunction = std::function<void(Args...)>;
+
+    Signal() = default;
+
+    SignalConnection connect(SlotFunction function)
+    {
+      assert(function);
+      auto& state = this->state();
+      return SignalConnection(state.slots.emplace_back(std::make_shared<Slot>(&state, std::move(function))));
+    }
+
+    void operator()(Args... args)
+    {
+      if(!m_state)
+        return;
+      // the guard shares the slot list, a slot may destroy this signal:
+      EmitGuard guard{m_state};
+      auto& slots = guard.state->slots;
+      // slots connected during emit are appended, they are not called until the next emit:
+      const size_t count = slots.size();
+      for(size_t i = 0; i < count; i++)
+      {
+        // the vector can reallocate if a slot connects, so don't keep references across calls:
+        auto* slot = static_cast<Slot*>(slots[i].get());
+        if(slot->connected)
+          slot->function(args...);
+      }
+    }
+};
+
+#endif
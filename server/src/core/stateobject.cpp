@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2023 Reinder Feenstra
+ * Copyright (C) 2023,2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -42,8 +42,8 @@ StateObject::StateObject(std::string id)
 void StateObject::save(WorldSaver& saver, nlohmann::json& data, nlohmann::json& state) const
 {
 #ifndef NDEBUG
-  for(const auto& it : m_interfaceItems)
-    if(const auto* p = dynamic_cast<const BaseProperty*>(&it.second))
+  for(const auto* item : m_interfaceItems)
+    if(const auto* p = interfaceItemCast<BaseProperty>(item))
       assert(!p->isStoreable()); // A StateObject may no have storable properties
 #endif
   Object::save(saver, data, state);
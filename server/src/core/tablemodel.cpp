@@ -68,14 +68,37 @@ void TableModel::rowsChanged(uint32_t first, uint32_t last)
   }
 }
 
-void TableModel::rowRemovedHack(uint32_t row)
+void TableModel::removeRow(uint32_t row)
 {
-  //Hack, tell clients to refresh from row onwards
-  Region update = m_region;
-  if(update.rowMin <= row && update.rowMax >= row)
+  assert(row < m_rowCount);
+  m_rowCount--;
+  if(rowRemoved)
   {
-    update.rowMin = row;
-    updateRegion(shared_ptr<TableModel>(), update);
+    rowRemoved(shared_ptr<TableModel>(), row);
+
+    // the client shifts the rows below up, the row moving into the bottom of the region must be sent:
+    if(updateRegion && m_region.isValid() && row <= m_region.rowMax && m_region.rowMax < m_rowCount)
+    {
+      Region update = m_region;
+      update.columnMax = std::min(update.columnMax, static_cast<uint32_t>(m_columnHeaders.size()) - 1);
+      update.rowMin = update.rowMax;
+      updateRegion(shared_ptr<TableModel>(), update);
+    }
+  }
+  else
+  {
+    // the client doesn't know about row removal, send the new row count and the rows that moved up:
+    if(rowCountChanged)
+      rowCountChanged(shared_ptr<TableModel>());
+
+    if(updateRegion && m_region.isValid() && row <= m_region.rowMax && std::max(row, m_region.rowMin) < m_rowCount)
+    {
+      Region update = m_region;
+      update.columnMax = std::min(update.columnMax, static_cast<uint32_t>(m_columnHeaders.size()) - 1);
+      update.rowMin = std::max(row, update.rowMin);
+      update.rowMax = std::min(update.rowMax, m_rowCount - 1);
+      updateRegion(shared_ptr<TableModel>(), update);
+    }
   }
 }
 
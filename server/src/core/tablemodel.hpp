@@ -98,6 +98,7 @@ class TableModel : public Object
     std::function<void(const TableModelPtr&)> columnHeadersChanged;
     std::function<void(const TableModelPtr&)> rowCountChanged;
     std::function<void(const TableModelPtr&, const Region& region)> updateRegion;
+    std::function<void(const TableModelPtr&, uint32_t row)> rowRemoved; //!< if not set, removal is sent as row count change and region update
 
     TableModel();
 
@@ -112,7 +113,7 @@ class TableModel : public Object
     void setRegion(const Region& value);
 
     void rowsChanged(uint32_t first, uint32_t last);
-    void rowRemovedHack(uint32_t row);
+    void removeRow(uint32_t row);
 };
 
 #endif
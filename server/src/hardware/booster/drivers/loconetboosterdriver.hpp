@@ -46,7 +46,7 @@ protected:
   virtual void updateEnabled(bool editable, bool online);
 
 private:
-  boost::signals2::connection m_interfacePropertyChanged;
+  SignalConnection m_interfacePropertyChanged;
 
   void interfacePropertyChanged(BaseProperty& property);
 };
@@ -78,9 +78,21 @@ Decoder::Decoder(World& world, std::string_view _id) :
     {
       protocolChanged();
       updateEditable();
+      if(interface)
+        interface->decoderAddressChanged(*this);
+    }},
+  address{this, "address", 0, PropertyFlags::ReadWrite | PropertyFlags::Store,
+    [this](const uint16_t& /*value*/)
+    {
+      if(interface)
+        interface->decoderAddressChanged(*this);
+    }},
+  mfxUID{this, "mfx_uid", 0, PropertyFlags::ReadWrite | PropertyFlags::Store,
+    [this](const uint32_t& /*value*/)
+    {
+      if(interface)
+        interface->decoderAddressChanged(*this);
     }},
-  address{this, "address", 0, PropertyFlags::ReadWrite | PropertyFlags::Store},
-  mfxUID{this, "mfx_uid", 0, PropertyFlags::ReadWrite | PropertyFlags::Store},
   emergencyStop{this, "emergency_stop", false, PropertyFlags::ReadWrite,
     [this](const bool& /*value*/)
     {
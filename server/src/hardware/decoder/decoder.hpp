@@ -24,6 +24,7 @@
 #define TRAINTASTIC_SERVER_HARDWARE_DECODER_DECODER_HPP
 
 #include <type_traits>
+#include <boost/signals2/signal.hpp>
 #include "../../core/idobject.hpp"
 #include "../../core/objectproperty.hpp"
 #include <traintastic/enum/decoderprotocol.hpp>
@@ -99,10 +99,13 @@ std::span<const uint8_t> DecoderController::decoderSpeedSteps(DecoderProtocol pr
 
 bool DecoderController::addDecoder(Decoder& decoder)
 {
-  if(findDecoder(decoder) != m_decoders.end())
+  if(m_decoderKeys.contains(&decoder))
     return false;
 
-  m_decoders.emplace_back(decoder.shared_ptr<Decoder>());
+  const auto keys = getKeys(decoder);
+  const auto& ptr = m_decoders.emplace_back(decoder.shared_ptr<Decoder>());
+  m_decoderKeys.emplace(&decoder, keys);
+  addToIndex(ptr, keys);
   decoders->addObject(decoder.shared_ptr<Decoder>());
   return true;
 }
@@ -112,6 +115,8 @@ bool DecoderController::removeDecoder(Decoder& decoder)
   auto it = findDecoder(decoder);
   if(it != m_decoders.end())
   {
+    removeFromIndex(decoder, m_decoderKeys.at(&decoder));
+    m_decoderKeys.erase(&decoder);
     m_decoders.erase(it);
     decoders->removeObject(decoder.shared_ptr<Decoder>());
     return true;
@@ -121,13 +126,41 @@ bool DecoderController::removeDecoder(Decoder& decoder)
 
 const std::shared_ptr<Decoder>& DecoderController::getDecoder(DecoderProtocol protocol, uint16_t address)
 {
-  auto it = findDecoder(protocol, address);
-  if(it != m_decoders.end())
-    return *it;
+  if(protocol == DecoderProtocol::MFX)
+    return Decoder::null;
+
+  if(auto it = m_decodersByAddress.find(addressKey(protocol, address)); it != m_decodersByAddress.end())
+    return it->second;
+
+  return Decoder::null;
+}
+
+const std::shared_ptr<Decoder>& DecoderController::getDecoderMFX(uint32_t mfxUID)
+{
+  if(mfxUID == 0)
+    return Decoder::null;
+
+  if(auto it = m_decodersByMFXUID.find(mfxUID); it != m_decodersByMFXUID.end())
+    return it->second;
 
   return Decoder::null;
 }
 
+void DecoderController::decoderAddressChanged(const Decoder& decoder)
+{
+  auto it = m_decoderKeys.find(&decoder);
+  if(it == m_decoderKeys.end()) // not (yet) added
+    return;
+
+  const auto keys = getKeys(decoder);
+  if(keys.address == it->second.address && keys.mfxUID == it->second.mfxUID)
+    return;
+
+  const auto oldKeys = std::exchange(it->second, keys);
+  removeFromIndex(decoder, oldKeys);
+  addToIndex(*findDecoder(decoder), keys);
+}
+
 void DecoderController::addToWorld()
 {
   auto& object = interface();
@@ -156,35 +189,69 @@ DecoderController::DecoderVector::iterator DecoderController::findDecoder(const
     });
 }
 
-DecoderController::DecoderVector::iterator DecoderController::findDecoder(DecoderProtocol protocol, uint16_t address)
+void DecoderController::restoreDecoderSpeed()
 {
-  if(protocol == DecoderProtocol::MFX)
-    return m_decoders.end();
-
-  return std::find_if(m_decoders.begin(), m_decoders.end(),
-    [protocol, address](const auto& it)
-    {
-      return it->protocol == protocol && it->address == address;
-    });
+  for(const auto& decoder : m_decoders)
+    if(!decoder->emergencyStop && !almostZero(decoder->throttle.value()))
+      decoderChanged(*decoder, DecoderChangeFlags::Throttle, 0);
 }
 
-DecoderController::DecoderVector::iterator DecoderController::findDecoderMFX(uint32_t mfxUID)
+DecoderController::DecoderKeys DecoderController::getKeys(const Decoder& decoder)
 {
-  if(mfxUID == 0)
-    return m_decoders.end();
+  if(decoder.protocol == DecoderProtocol::MFX)
+    return {noAddressKey, decoder.mfxUID.value()};
+  return {addressKey(decoder.protocol, decoder.address), 0};
+}
 
-  return std::find_if(m_decoders.begin(), m_decoders.end(),
-    [mfxUID](const auto& it)
+void DecoderController::addToIndex(const std::shared_ptr<Decoder>& decoder, const DecoderKeys& keys)
+{
+  // if multiple decoders share a key, the one that was added first is used:
+  const auto add =
+    [this, &decoder](auto& index, uint32_t key)
     {
-      return it->protocol == DecoderProtocol::MFX && it->mfxUID == mfxUID;
-    });
+      auto [it, added] = index.try_emplace(key, decoder);
+      if(!added && it->second != decoder)
+      {
+        const auto first = std::find_if(m_decoders.begin(), m_decoders.end(),
+          [&decoder, &current=it->second](const auto& item)
+          {
+            return item == decoder || item == current;
+          });
+        it->second = *first;
+      }
+    };
+
+  if(keys.address != noAddressKey)
+    add(m_decodersByAddress, keys.address);
+  if(keys.mfxUID != 0)
+    add(m_decodersByMFXUID, keys.mfxUID);
 }
 
-void DecoderController::restoreDecoderSpeed()
+void DecoderController::removeFromIndex(const Decoder& decoder, const DecoderKeys& keys)
 {
-  for(const auto& decoder : m_decoders)
-    if(!decoder->emergencyStop && !almostZero(decoder->throttle.value()))
-      decoderChanged(*decoder, DecoderChangeFlags::Throttle, 0);
+  // if another decoder uses the same key, it takes over the index entry:
+  const auto remove =
+    [this, &decoder](auto& index, uint32_t key, uint32_t DecoderKeys::* member)
+    {
+      auto it = index.find(key);
+      if(it == index.end() || it->second.get() != &decoder)
+        return;
+
+      const auto next = std::find_if(m_decoders.begin(), m_decoders.end(),
+        [this, &decoder, key, member](const auto& item)
+        {
+          return item.get() != &decoder && m_decoderKeys.at(item.get()).*member == key;
+        });
+      if(next != m_decoders.end())
+        it->second = *next;
+      else
+        index.erase(it);
+    };
+
+  if(keys.address != noAddressKey)
+    remove(m_decodersByAddress, keys.address, &DecoderKeys::address);
+  if(keys.mfxUID != 0)
+    remove(m_decodersByMFXUID, keys.mfxUID, &DecoderKeys::mfxUID);
 }
 
 IdObject& DecoderController::interface()
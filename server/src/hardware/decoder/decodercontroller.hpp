@@ -24,9 +24,11 @@
 #define TRAINTASTIC_SERVER_HARDWARE_DECODER_DECODERCONTROLLER_HPP
 
 #include <cstdint>
+#include <limits>
 #include <vector>
 #include <memory>
 #include <span>
+#include <unordered_map>
 #include "../../core/objectproperty.hpp"
 
 #ifdef interface
@@ -46,10 +48,30 @@ class DecoderController
     using DecoderVector = std::vector<std::shared_ptr<Decoder>>;
 
   private:
+    struct DecoderKeys
+    {
+      uint32_t address;
+      uint32_t mfxUID;
+    };
+
+    static constexpr uint32_t noAddressKey = std::numeric_limits<uint32_t>::max();
+
     DecoderVector m_decoders;
+    std::unordered_map<const Decoder*, DecoderKeys> m_decoderKeys;
+    std::unordered_map<uint32_t, std::shared_ptr<Decoder>> m_decodersByAddress;
+    std::unordered_map<uint32_t, std::shared_ptr<Decoder>> m_decodersByMFXUID;
 
     IdObject& interface();
 
+    static constexpr uint32_t addressKey(DecoderProtocol protocol, uint16_t address)
+    {
+      return (static_cast<uint32_t>(protocol) << 16) | address;
+    }
+
+    static DecoderKeys getKeys(const Decoder& decoder);
+    void addToIndex(const std::shared_ptr<Decoder>& decoder, const DecoderKeys& keys);
+    void removeFromIndex(const Decoder& decoder, const DecoderKeys& keys);
+
   protected:
     DecoderController(IdObject& interface, DecoderListColumn columns);
 
@@ -57,8 +79,6 @@ class DecoderController
     void destroying();
 
     DecoderVector::iterator findDecoder(const Decoder& decoder);
-    DecoderVector::iterator findDecoder(DecoderProtocol protocol, uint16_t address);
-    DecoderVector::iterator findDecoderMFX(uint32_t mfxUID);
 
     /// \brief restore speed of all decoders that are not (emergency) stopped
     void restoreDecoderSpeed();
@@ -86,6 +106,10 @@ class DecoderController
     [[nodiscard]] bool removeDecoder(Decoder& decoder);
 
     const std::shared_ptr<Decoder>& getDecoder(DecoderProtocol protocol, uint16_t address);
+    const std::shared_ptr<Decoder>& getDecoderMFX(uint32_t mfxUID);
+
+    //! \brief Update lookup index, must be called when decoder protocol, address or MFX UID changes
+    void decoderAddressChanged(const Decoder& decoder);
 
     virtual void decoderChanged(const Decoder& decoder, DecoderChangeFlags changes, uint32_t functionNumber) = 0;
 };
@@ -23,7 +23,7 @@
 #define TRAINTASTIC_SERVER_HARDWARE_INPUT_INPUTCONSUMER_HPP
 
 #include <boost/asio/steady_timer.hpp>
-#include <boost/signals2/connection.hpp>
+#include "../../core/signal.hpp"
 #include "../../core/property.hpp"
 #include "../../core/objectproperty.hpp"
 
@@ -43,8 +43,8 @@ private:
   Object& m_object;
   boost::asio::steady_timer m_inputFilterTimer;
   std::shared_ptr<Input> m_input;
-  boost::signals2::connection m_inputDestroying;
-  boost::signals2::connection m_inputValueChanged;
+  SignalConnection m_inputDestroying;
+  SignalConnection m_inputValueChanged;
 
   void setInput(std::shared_ptr<Input> value);
   void releaseInput();
@@ -39,8 +39,8 @@ class BlockInputMapItem final : public InputMapItem, public InputConsumer
   private:
     BlockInputMap& m_parent;
     const uint32_t m_itemId;
-    boost::signals2::connection m_identificationDestroying;
-    boost::signals2::connection m_identificationEvent;
+    SignalConnection m_identificationDestroying;
+    SignalConnection m_identificationEvent;
     SensorState m_value;
 
     void connectIdentification(Identification& object);
@@ -38,6 +38,7 @@
 #include "../../core/objectproperty.tpp"
 #include "../../log/log.hpp"
 #include "../../log/logmessageexception.hpp"
+#include "../../utils/category.hpp"
 #include "../../utils/displayname.hpp"
 #include "../../utils/inrange.hpp"
 #include "../../utils/makearray.hpp"
@@ -65,6 +66,8 @@ DCCEXInterface::DCCEXInterface(World& world, std::string_view _id)
   , hostname{this, "hostname", "", PropertyFlags::ReadWrite | PropertyFlags::Store}
   , port{this, "port", 2560, PropertyFlags::ReadWrite | PropertyFlags::Store}
   , dccex{this, "dccex", nullptr, PropertyFlags::ReadOnly | PropertyFlags::Store | PropertyFlags::SubObject}
+  , eventBatchSize{this, "event_batch_size", 0, PropertyFlags::ReadOnly | PropertyFlags::NoStore}
+  , eventBatchSizeMax{this, "event_batch_size_max", 0, PropertyFlags::ReadOnly | PropertyFlags::NoStore}
 {
   name = "DCC-EX";
   dccex.setValueInternal(std::make_shared<DCCEX::Settings>(*this, dccex.name()));
@@ -104,6 +107,12 @@ DCCEXInterface::DCCEXInterface(World& world, std::string_view _id)
 
   m_interfaceItems.insertBefore(outputs, notes);
 
+  Attributes::addCategory(eventBatchSize, Category::info);
+  m_interfaceItems.insertBefore(eventBatchSize, notes);
+
+  Attributes::addCategory(eventBatchSizeMax, Category::info);
+  m_interfaceItems.insertBefore(eventBatchSizeMax, notes);
+
   m_dccexPropertyChanged = dccex->propertyChanged.connect(
     [this](BaseProperty& property)
     {
@@ -274,6 +283,16 @@ bool DCCEXInterface::setOnline(bool& value, bool simulation)
       m_kernel->setDecoderController(this);
       m_kernel->setInputController(this);
       m_kernel->setOutputController(this);
+
+      m_kernel->setOnEventQueueStatistics(
+        [this, kernel=m_kernel.get()](const KernelEventQueue::Statistics& statistics)
+        {
+          if(m_kernel.get() != kernel) // delivered after the kernel was stopped, statistics are reset already
+            return;
+          eventBatchSize.setValueInternal(statistics.lastBatchSize);
+          eventBatchSizeMax.setValueInternal(statistics.maxBatchSize);
+        });
+
       m_kernel->start();
 
       Attributes::setEnabled({type, device, baudrate, hostname, port}, false);
@@ -292,6 +311,9 @@ bool DCCEXInterface::setOnline(bool& value, bool simulation)
     m_kernel->stop();
     EventLoop::deleteLater(m_kernel.release());
 
+    eventBatchSize.setValueInternal(0);
+    eventBatchSizeMax.setValueInternal(0);
+
     if(status->state != InterfaceState::Error)
     {
       setState(InterfaceState::Offline);
@@ -52,7 +52,7 @@ class DCCEXInterface final
 
   private:
     std::unique_ptr<DCCEX::Kernel> m_kernel;
-    boost::signals2::connection m_dccexPropertyChanged;
+    SignalConnection m_dccexPropertyChanged;
 
     void addToWorld() final;
     void loaded() final;
@@ -76,6 +76,8 @@ class DCCEXInterface final
     Property<std::string> hostname;
     Property<uint16_t> port;
     ObjectProperty<DCCEX::Settings> dccex;
+    Property<uint32_t> eventBatchSize;
+    Property<uint32_t> eventBatchSizeMax;
 
     DCCEXInterface(World& world, std::string_view _id);
     ~DCCEXInterface() final;
@@ -37,6 +37,7 @@
 #include "../../core/objectproperty.tpp"
 #include "../../log/log.hpp"
 #include "../../log/logmessageexception.hpp"
+#include "../../utils/category.hpp"
 #include "../../utils/displayname.hpp"
 #include "../../utils/inrange.hpp"
 #include "../../utils/makearray.hpp"
@@ -57,6 +58,8 @@ ECoSInterface::ECoSInterface(World& world, std::string_view _id)
   , OutputController(static_cast<IdObject&>(*this))
   , hostname{this, "hostname", "", PropertyFlags::ReadWrite | PropertyFlags::Store}
   , ecos{this, "ecos", nullptr, PropertyFlags::ReadOnly | PropertyFlags::Store | PropertyFlags::SubObject}
+  , eventBatchSize{this, "event_batch_size", 0, PropertyFlags::ReadOnly | PropertyFlags::NoStore}
+  , eventBatchSizeMax{this, "event_batch_size_max", 0, PropertyFlags::ReadOnly | PropertyFlags::NoStore}
 {
   name = "ECoS";
   ecos.setValueInternal(std::make_shared<ECoS::Settings>(*this, ecos.name()));
@@ -72,6 +75,12 @@ ECoSInterface::ECoSInterface(World& world, std::string_view _id)
   m_interfaceItems.insertBefore(inputs, notes);
 
   m_interfaceItems.insertBefore(outputs, notes);
+
+  Attributes::addCategory(eventBatchSize, Category::info);
+  m_interfaceItems.insertBefore(eventBatchSize, notes);
+
+  Attributes::addCategory(eventBatchSizeMax, Category::info);
+  m_interfaceItems.insertBefore(eventBatchSizeMax, notes);
 }
 
 ECoSInterface::~ECoSInterface() = default;
@@ -230,6 +239,16 @@ bool ECoSInterface::setOnline(bool& value, bool simulation)
       m_kernel->setDecoderController(this);
       m_kernel->setInputController(this);
       m_kernel->setOutputController(this);
+
+      m_kernel->setOnEventQueueStatistics(
+        [this, kernel=m_kernel.get()](const KernelEventQueue::Statistics& statistics)
+        {
+          if(m_kernel.get() != kernel) // delivered after the kernel was stopped, statistics are reset already
+            return;
+          eventBatchSize.setValueInternal(statistics.lastBatchSize);
+          eventBatchSizeMax.setValueInternal(statistics.maxBatchSize);
+        });
+
       m_kernel->start();
 
       m_ecosPropertyChanged = ecos->propertyChanged.connect(
@@ -260,6 +279,9 @@ bool ECoSInterface::setOnline(bool& value, bool simulation)
     m_kernel->stop(simulation ? nullptr : &m_simulation);
     EventLoop::deleteLater(m_kernel.release());
 
+    eventBatchSize.setValueInternal(0);
+    eventBatchSizeMax.setValueInternal(0);
+
     setState(InterfaceState::Offline);
   }
   return true;
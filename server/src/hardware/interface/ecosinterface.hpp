@@ -51,7 +51,7 @@ class ECoSInterface final
 
   private:
     std::unique_ptr<ECoS::Kernel> m_kernel;
-    boost::signals2::connection m_ecosPropertyChanged;
+    SignalConnection m_ecosPropertyChanged;
     ECoS::Simulation m_simulation;
     std::vector<uint16_t> m_outputECoSObjectIds;
     std::vector<std::string> m_outputECoSObjectNames;
@@ -72,6 +72,8 @@ class ECoSInterface final
   public:
     Property<std::string> hostname;
     ObjectProperty<ECoS::Settings> ecos;
+    Property<uint32_t> eventBatchSize;
+    Property<uint32_t> eventBatchSizeMax;
 
     ECoSInterface(World& world, std::string_view _id);
     ~ECoSInterface() final;
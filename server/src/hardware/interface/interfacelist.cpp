@@ -89,14 +89,10 @@ void InterfaceList::statusPropertyChanged(BaseProperty& property)
 {
   if(!m_models.empty() && property.name() == "state")
   {
-    ObjectPtr obj = static_cast<SubObject&>(property.object()).parent().shared_from_this();
-    const uint32_t rows = static_cast<uint32_t>(m_items.size());
-    for(uint32_t row = 0; row < rows; row++)
-      if(m_items[row] == obj)
-      {
-        for(auto& model : m_models)
-          static_cast<InterfaceListTableModel*>(model)->changed(row, InterfaceListTableModel::columnStatus);
-        break;
-      }
+    if(const uint32_t row = getRow(static_cast<SubObject&>(property.object()).parent()); row != invalidRow)
+    {
+      for(auto& model : m_models)
+        static_cast<InterfaceListTableModel*>(model)->changed(row, InterfaceListTableModel::columnStatus);
+    }
   }
 }
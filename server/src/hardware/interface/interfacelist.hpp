@@ -30,7 +30,7 @@
 class InterfaceList final : public ObjectList<Interface>
 {
   private:
-    std::unordered_map<Object*, boost::signals2::scoped_connection> m_statusPropertyChanged;
+    std::unordered_map<Object*, ScopedSignalConnection> m_statusPropertyChanged;
 
     void statusPropertyChanged(BaseProperty& property);
 
@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2019-2025 Reinder Feenstra
+ * Copyright (C) 2019-2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -44,9 +44,11 @@
 #include "../../core/objectproperty.tpp"
 #include "../../log/log.hpp"
 #include "../../log/logmessageexception.hpp"
+#include "../../utils/category.hpp"
 #include "../../utils/displayname.hpp"
 #include "../../utils/inrange.hpp"
 #include "../../utils/makearray.hpp"
+#include "../../utils/unit.hpp"
 #include "../../world/world.hpp"
 
 constexpr auto decoderListColumns = DecoderListColumn::Id | DecoderListColumn::Name | DecoderListColumn::Address;
@@ -73,6 +75,12 @@ LocoNetInterface::LocoNetInterface(World& world, std::string_view _id)
   , hostname{this, "hostname", "", PropertyFlags::ReadWrite | PropertyFlags::Store}
   , port{this, "port", 5550, PropertyFlags::ReadWrite | PropertyFlags::Store}
   , loconet{this, "loconet", nullptr, PropertyFlags::ReadOnly | PropertyFlags::Store | PropertyFlags::SubObject}
+  , sendQueueDepth{this, "send_queue_depth", 0, PropertyFlags::ReadOnly | PropertyFlags::NoStore}
+  , sendQueueDepthMax{this, "send_queue_depth_max", 0, PropertyFlags::ReadOnly | PropertyFlags::NoStore}
+  , sendLatency{this, "send_latency", 0, PropertyFlags::ReadOnly | PropertyFlags::NoStore}
+  , sendSuperseded{this, "send_superseded", 0, PropertyFlags::ReadOnly | PropertyFlags::NoStore}
+  , eventBatchSize{this, "event_batch_size", 0, PropertyFlags::ReadOnly | PropertyFlags::NoStore}
+  , eventBatchSizeMax{this, "event_batch_size_max", 0, PropertyFlags::ReadOnly | PropertyFlags::NoStore}
 {
   name = "LocoNet";
   loconet.setValueInternal(std::make_shared<LocoNet::Settings>(*this, loconet.name()));
@@ -118,6 +126,25 @@ LocoNetInterface::LocoNetInterface(World& world, std::string_view _id)
 
   m_interfaceItems.insertBefore(identifications, notes);
 
+  Attributes::addCategory(sendQueueDepth, Category::info);
+  m_interfaceItems.insertBefore(sendQueueDepth, notes);
+
+  Attributes::addCategory(sendQueueDepthMax, Category::info);
+  m_interfaceItems.insertBefore(sendQueueDepthMax, notes);
+
+  Attributes::addCategory(sendLatency, Category::info);
+  Attributes::addUnit(sendLatency, Unit::milliSeconds);
+  m_interfaceItems.insertBefore(sendLatency, notes);
+
+  Attributes::addCategory(sendSuperseded, Category::info);
+  m_interfaceItems.insertBefore(sendSuperseded, notes);
+
+  Attributes::addCategory(eventBatchSize, Category::info);
+  m_interfaceItems.insertBefore(eventBatchSize, notes);
+
+  Attributes::addCategory(eventBatchSizeMax, Category::info);
+  m_interfaceItems.insertBefore(eventBatchSizeMax, notes);
+
   typeChanged();
 }
 
@@ -373,6 +400,25 @@ bool LocoNetInterface::setOnline(bool& value, bool simulation)
           if(auto* programmer = lncvProgrammer())
             programmer->readResponse(success, lncv, lncvValue);
         });
+      m_kernel->setOnSendQueueStatistics(
+        [this, kernel=m_kernel.get()](const LocoNet::Kernel::SendQueueStatistics& statistics)
+        {
+          if(m_kernel.get() != kernel) // posted before the kernel was stopped, statistics are reset already
+            return;
+          sendQueueDepth.setValueInternal(statistics.depth);
+          sendQueueDepthMax.setValueInternal(statistics.depthMax);
+          sendLatency.setValueInternal(statistics.latency);
+          sendSuperseded.setValueInternal(statistics.superseded);
+        });
+
+      m_kernel->setOnEventQueueStatistics(
+        [this, kernel=m_kernel.get()](const KernelEventQueue::Statistics& statistics)
+        {
+          if(m_kernel.get() != kernel) // delivered after the kernel was stopped, statistics are reset already
+            return;
+          eventBatchSize.setValueInternal(statistics.lastBatchSize);
+          eventBatchSizeMax.setValueInternal(statistics.maxBatchSize);
+        });
 
       m_kernel->start();
 
@@ -410,6 +456,14 @@ bool LocoNetInterface::setOnline(bool& value, bool simulation)
     m_kernel->stop();
     EventLoop::deleteLater(m_kernel.release());
 
+    eventBatchSize.setValueInternal(0);
+    eventBatchSizeMax.setValueInternal(0);
+
+    sendQueueDepth.setValueInternal(0);
+    sendQueueDepthMax.setValueInternal(0);
+    sendLatency.setValueInternal(0);
+    sendSuperseded.setValueInternal(0);
+
     if(status->state != InterfaceState::Error)
       setState(InterfaceState::Offline);
   }
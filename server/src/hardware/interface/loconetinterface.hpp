@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2019-2025 Reinder Feenstra
+ * Copyright (C) 2019-2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -57,7 +57,7 @@ class LocoNetInterface final
 
   private:
     std::unique_ptr<LocoNet::Kernel> m_kernel;
-    boost::signals2::connection m_loconetPropertyChanged;
+    SignalConnection m_loconetPropertyChanged;
 
     void addToWorld() final;
     void loaded() final;
@@ -77,6 +77,12 @@ class LocoNetInterface final
     Property<std::string> hostname;
     Property<uint16_t> port;
     ObjectProperty<LocoNet::Settings> loconet;
+    Property<uint32_t> sendQueueDepth;
+    Property<uint32_t> sendQueueDepthMax;
+    Property<uint32_t> sendLatency; //!< ms
+    Property<uint32_t> sendSuperseded;
+    Property<uint32_t> eventBatchSize;
+    Property<uint32_t> eventBatchSizeMax;
 
     LocoNetInterface(World& world, std::string_view _id);
     ~LocoNetInterface() final;
@@ -131,17 +131,8 @@ void MarklinCANLocomotiveList::import(const MarklinCAN::LocomotiveList::Locomoti
   std::shared_ptr<Decoder> decoder;
 
   // 1. try to find by MFX UID:
-  if(locomotive.protocol == DecoderProtocol::MFX && locomotive.mfxUID != 0)
-  {
-    auto it = std::find_if(decoders.begin(), decoders.end(),
-      [&locomotive](const auto& item)
-      {
-        return item->protocol == DecoderProtocol::MFX && item->mfxUID == locomotive.mfxUID;
-      });
-
-    if(it != decoders.end())
-      decoder = *it;
-  }
+  if(locomotive.protocol == DecoderProtocol::MFX)
+    decoder = interface().getDecoderMFX(locomotive.mfxUID);
 
   // 2. try to find by name:
   if(!decoder)
@@ -40,6 +40,7 @@
 #include "../../core/objectproperty.tpp"
 #include "../../log/log.hpp"
 #include "../../log/logmessageexception.hpp"
+#include "../../utils/category.hpp"
 #include "../../utils/displayname.hpp"
 #include "../../utils/inrange.hpp"
 #include "../../utils/makearray.hpp"
@@ -66,6 +67,8 @@ MarklinCANInterface::MarklinCANInterface(World& world, std::string_view _id)
   , marklinCAN{this, "marklin_can", nullptr, PropertyFlags::ReadOnly | PropertyFlags::Store | PropertyFlags::SubObject}
   , marklinCANNodeList{this, "marklin_can_node_list", nullptr, PropertyFlags::ReadOnly | PropertyFlags::NoStore | PropertyFlags::SubObject}
   , marklinCANLocomotiveList{this, "marklin_can_locomotive_list", nullptr, PropertyFlags::ReadOnly | PropertyFlags::NoStore | PropertyFlags::SubObject}
+  , eventBatchSize{this, "event_batch_size", 0, PropertyFlags::ReadOnly | PropertyFlags::NoStore}
+  , eventBatchSizeMax{this, "event_batch_size_max", 0, PropertyFlags::ReadOnly | PropertyFlags::NoStore}
 {
   name = "M\u00E4rklin CAN";
   marklinCAN.setValueInternal(std::make_shared<MarklinCAN::Settings>(*this, marklinCAN.name()));
@@ -115,6 +118,12 @@ MarklinCANInterface::MarklinCANInterface(World& world, std::string_view _id)
 
   m_interfaceItems.insertBefore(outputs, notes);
 
+  Attributes::addCategory(eventBatchSize, Category::info);
+  m_interfaceItems.insertBefore(eventBatchSize, notes);
+
+  Attributes::addCategory(eventBatchSizeMax, Category::info);
+  m_interfaceItems.insertBefore(eventBatchSizeMax, notes);
+
   typeChanged();
 }
 
@@ -236,6 +245,15 @@ bool MarklinCANInterface::setOnline(bool& value, bool simulation)
       m_kernel->setInputController(this);
       m_kernel->setOutputController(this);
 
+      m_kernel->setOnEventQueueStatistics(
+        [this, kernel=m_kernel.get()](const KernelEventQueue::Statistics& statistics)
+        {
+          if(m_kernel.get() != kernel) // delivered after the kernel was stopped, statistics are reset already
+            return;
+          eventBatchSize.setValueInternal(statistics.lastBatchSize);
+          eventBatchSizeMax.setValueInternal(statistics.maxBatchSize);
+        });
+
       m_kernel->start();
 
       m_marklinCANPropertyChanged = marklinCAN->propertyChanged.connect(
@@ -266,6 +284,9 @@ bool MarklinCANInterface::setOnline(bool& value, bool simulation)
     m_kernel->stop();
     EventLoop::deleteLater(m_kernel.release());
 
+    eventBatchSize.setValueInternal(0);
+    eventBatchSizeMax.setValueInternal(0);
+
     if(status->state != InterfaceState::Error)
       setState(InterfaceState::Offline);
   }
@@ -52,7 +52,7 @@ class MarklinCANInterface final
 
   private:
     std::unique_ptr<MarklinCAN::Kernel> m_kernel;
-    boost::signals2::connection m_marklinCANPropertyChanged;
+    SignalConnection m_marklinCANPropertyChanged;
 
     void addToWorld() final;
     void loaded() final;
@@ -74,6 +74,8 @@ class MarklinCANInterface final
     ObjectProperty<MarklinCAN::Settings> marklinCAN;
     ObjectProperty<MarklinCANNodeList> marklinCANNodeList;
     ObjectProperty<MarklinCANLocomotiveList> marklinCANLocomotiveList;
+    Property<uint32_t> eventBatchSize;
+    Property<uint32_t> eventBatchSizeMax;
 
     MarklinCANInterface(World& world, std::string_view _id);
 
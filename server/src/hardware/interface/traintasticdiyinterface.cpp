@@ -34,6 +34,7 @@
 #include "../../core/objectproperty.tpp"
 #include "../../log/log.hpp"
 #include "../../log/logmessageexception.hpp"
+#include "../../utils/category.hpp"
 #include "../../utils/displayname.hpp"
 #include "../../utils/inrange.hpp"
 #include "../../utils/makearray.hpp"
@@ -59,6 +60,8 @@ TraintasticDIYInterface::TraintasticDIYInterface(World& world, std::string_view
   , hostname{this, "hostname", "192.168.1.203", PropertyFlags::ReadWrite | PropertyFlags::Store}
   , port{this, "port", 5550, PropertyFlags::ReadWrite | PropertyFlags::Store}
   , traintasticDIY{this, "traintastic_diy", nullptr, PropertyFlags::ReadOnly | PropertyFlags::Store | PropertyFlags::SubObject}
+  , eventBatchSize{this, "event_batch_size", 0, PropertyFlags::ReadOnly | PropertyFlags::NoStore}
+  , eventBatchSizeMax{this, "event_batch_size_max", 0, PropertyFlags::ReadOnly | PropertyFlags::NoStore}
 {
   name = "Traintastic DIY";
   traintasticDIY.setValueInternal(std::make_shared<TraintasticDIY::Settings>(*this, traintasticDIY.name()));
@@ -99,6 +102,12 @@ TraintasticDIYInterface::TraintasticDIYInterface(World& world, std::string_view
 
   m_interfaceItems.insertBefore(outputs, notes);
 
+  Attributes::addCategory(eventBatchSize, Category::info);
+  m_interfaceItems.insertBefore(eventBatchSize, notes);
+
+  Attributes::addCategory(eventBatchSizeMax, Category::info);
+  m_interfaceItems.insertBefore(eventBatchSizeMax, notes);
+
   updateVisible();
 }
 
@@ -187,6 +196,16 @@ bool TraintasticDIYInterface::setOnline(bool& value, bool simulation)
         });
       m_kernel->setInputController(this);
       m_kernel->setOutputController(this);
+
+      m_kernel->setOnEventQueueStatistics(
+        [this, kernel=m_kernel.get()](const KernelEventQueue::Statistics& statistics)
+        {
+          if(m_kernel.get() != kernel) // delivered after the kernel was stopped, statistics are reset already
+            return;
+          eventBatchSize.setValueInternal(statistics.lastBatchSize);
+          eventBatchSizeMax.setValueInternal(statistics.maxBatchSize);
+        });
+
       m_kernel->start();
 
       m_traintasticDIYPropertyChanged = traintasticDIY->propertyChanged.connect(
@@ -213,6 +232,9 @@ bool TraintasticDIYInterface::setOnline(bool& value, bool simulation)
     m_kernel->stop();
     EventLoop::deleteLater(m_kernel.release());
 
+    eventBatchSize.setValueInternal(0);
+    eventBatchSizeMax.setValueInternal(0);
+
     setState(InterfaceState::Offline);
   }
   return true;
@@ -50,7 +50,7 @@ class TraintasticDIYInterface final
 
   private:
     std::unique_ptr<TraintasticDIY::Kernel> m_kernel;
-    boost::signals2::connection m_traintasticDIYPropertyChanged;
+    SignalConnection m_traintasticDIYPropertyChanged;
 
     void addToWorld() final;
     void loaded() final;
@@ -69,6 +69,8 @@ class TraintasticDIYInterface final
     Property<std::string> hostname;
     Property<uint16_t> port;
     ObjectProperty<TraintasticDIY::Settings> traintasticDIY;
+    Property<uint32_t> eventBatchSize;
+    Property<uint32_t> eventBatchSizeMax;
 
     TraintasticDIYInterface(World& world, std::string_view _id);
     ~TraintasticDIYInterface() final;
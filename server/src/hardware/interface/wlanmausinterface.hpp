@@ -42,7 +42,7 @@ class WlanMausInterface : public Interface
 
   private:
     std::unique_ptr<Z21::ServerKernel> m_kernel;
-    boost::signals2::connection m_z21PropertyChanged;
+    SignalConnection m_z21PropertyChanged;
 
   protected:
     void worldEvent(WorldState state, WorldEvent event) final;
@@ -53,7 +53,7 @@ class XpressNetInterface final
 
   private:
     std::unique_ptr<XpressNet::Kernel> m_kernel;
-    boost::signals2::connection m_xpressnetPropertyChanged;
+    SignalConnection m_xpressnetPropertyChanged;
 
     void addToWorld() final;
     void loaded() final;
@@ -76,6 +76,8 @@ class XpressNetInterface final
     Property<uint8_t> s88StartAddress;
     Property<uint8_t> s88ModuleCount;
     ObjectProperty<XpressNet::Settings> xpressnet;
+    Property<uint32_t> eventBatchSize;
+    Property<uint32_t> eventBatchSizeMax;
 
     XpressNetInterface(World& world, std::string_view _id);
     ~XpressNetInterface() final;
@@ -59,6 +59,8 @@ Z21Interface::Z21Interface(World& world, std::string_view _id)
   , hardwareType{this, "hardware_type", "", PropertyFlags::ReadOnly | PropertyFlags::NoStore}
   , serialNumber{this, "serial_number", "", PropertyFlags::ReadOnly | PropertyFlags::NoStore}
   , firmwareVersion{this, "firmware_version", "", PropertyFlags::ReadOnly | PropertyFlags::NoStore}
+  , eventBatchSize{this, "event_batch_size", 0, PropertyFlags::ReadOnly | PropertyFlags::NoStore}
+  , eventBatchSizeMax{this, "event_batch_size_max", 0, PropertyFlags::ReadOnly | PropertyFlags::NoStore}
 {
   name = "Z21";
   z21.setValueInternal(std::make_shared<Z21::ClientSettings>(*this, z21.name()));
@@ -88,6 +90,12 @@ Z21Interface::Z21Interface(World& world, std::string_view _id)
 
   Attributes::addCategory(firmwareVersion, Category::info);
   m_interfaceItems.insertBefore(firmwareVersion, notes);
+
+  Attributes::addCategory(eventBatchSize, Category::info);
+  m_interfaceItems.insertBefore(eventBatchSize, notes);
+
+  Attributes::addCategory(eventBatchSizeMax, Category::info);
+  m_interfaceItems.insertBefore(eventBatchSizeMax, notes);
 }
 
 Z21Interface::~Z21Interface() = default;
@@ -250,6 +258,15 @@ bool Z21Interface::setOnline(bool& value, bool simulation)
       m_kernel->setInputController(this);
       m_kernel->setOutputController(this);
 
+      m_kernel->setOnEventQueueStatistics(
+        [this, kernel=m_kernel.get()](const KernelEventQueue::Statistics& statistics)
+        {
+          if(m_kernel.get() != kernel) // delivered after the kernel was stopped, statistics are reset already
+            return;
+          eventBatchSize.setValueInternal(statistics.lastBatchSize);
+          eventBatchSizeMax.setValueInternal(statistics.maxBatchSize);
+        });
+
       m_kernel->start();
 
       m_z21PropertyChanged = z21->propertyChanged.connect(
@@ -289,6 +306,9 @@ bool Z21Interface::setOnline(bool& value, bool simulation)
     m_kernel->stop();
     EventLoop::deleteLater(m_kernel.release());
 
+    eventBatchSize.setValueInternal(0);
+    eventBatchSizeMax.setValueInternal(0);
+
     setState(InterfaceState::Offline);
     hardwareType.setValueInternal("");
     serialNumber.setValueInternal("");
@@ -49,7 +49,7 @@ class Z21Interface final
 
   private:
     std::unique_ptr<Z21::ClientKernel> m_kernel;
-    boost::signals2::connection m_z21PropertyChanged;
+    SignalConnection m_z21PropertyChanged;
 
     void addToWorld() final;
     void destroying() final;
@@ -67,6 +67,8 @@ class Z21Interface final
     Property<std::string> hardwareType;
     Property<std::string> serialNumber;
     Property<std::string> firmwareVersion;
+    Property<uint32_t> eventBatchSize;
+    Property<uint32_t> eventBatchSizeMax;
 
     Z21Interface(World& world, std::string_view _id);
     ~Z21Interface() final;
@@ -686,7 +686,7 @@ OutputMap::OutputConnectionPair OutputMap::getOutput(OutputChannel ch, uint32_t
   if(!output)
     return {};
 
-  boost::signals2::connection conn = output->onValueChangedGeneric.connect([this](const std::shared_ptr<Output>&){ updateStateFromOutput(); });
+  SignalConnection conn = output->onValueChangedGeneric.connect([this](const std::shared_ptr<Output>&){ updateStateFromOutput(); });
   return {output, conn};
 }
 
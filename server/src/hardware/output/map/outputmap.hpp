@@ -43,14 +43,14 @@ class OutputMap : public SubObject
 {
   public:
     using Items = std::vector<std::shared_ptr<OutputMapItem>>;
-    using OutputConnectionPair = std::pair<std::shared_ptr<Output>, boost::signals2::connection>;
+    using OutputConnectionPair = std::pair<std::shared_ptr<Output>, SignalConnection>;
     using Outputs = std::vector<OutputConnectionPair>;
 
   private:
     static constexpr size_t addressesSizeMin = 1;
     static constexpr size_t addressesSizeMax = 8;
 
-    boost::signals2::scoped_connection m_interfaceDestroying;
+    ScopedSignalConnection m_interfaceDestroying;
     boost::signals2::scoped_connection m_outputECoSObjectsChanged;
 
     void addOutput(OutputChannel ch, uint32_t id);
@@ -24,6 +24,7 @@
 #define TRAINTASTIC_SERVER_HARDWARE_PROTOCOL_DCCEX_CONFIG_HPP
 
 #include <cstdint>
+#include <traintastic/enum/pcapoutput.hpp>
 
 namespace DCCEX {
 
@@ -34,6 +35,8 @@ struct Config
   uint8_t speedSteps;
   uint16_t startupDelay;
   bool debugLogRXTX;
+  bool pcap;
+  PCAPOutput pcapOutput;
 };
 
 }
@@ -0,0 +1,60 @@
+/**
+ * server/src/hardware/protocol/dccex/iohandler/replayiohandler.hpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TRAINTASTIC_SERVER_HARDWARE_PROTOCOL_DCCEX_IOHANDLER_REPLAYIOHANDLER_HPP
+#define TRAINTASTIC_SERVER_HARDWARE_PROTOCOL_DCCEX_IOHANDLER_REPLAYIOHANDLER_HPP
+
+#include "iohandler.hpp"
+#include "../../../../pcap/pcapreplayiohandler.hpp"
+
+namespace DCCEX {
+
+/**
+ * \brief Feeds a recorded PCAP capture into the kernel
+ *
+ * Sent commands are discarded.
+ */
+class ReplayIOHandler final : public PCAPReplayIOHandler<IOHandler>
+{
+  protected:
+    void receive(const std::byte* data, size_t size) final;
+
+  public:
+    /**
+     * \param[in] kernel The kernel
+     * \param[in] filename PCAP capture of the kernel
+     * \param[in] speed Replay speed factor, see PCAPReplay
+     * \param[in] onFinished Called in the kernel's IO context after the last record is replayed
+     */
+    ReplayIOHandler(Kernel& kernel, const std::filesystem::path& filename, double speed = 1, std::function<void()> onFinished = {});
+
+    void start() final;
+
+    bool send(std::string_view /*message*/) final
+    {
+      return true;
+    }
+};
+
+}
+
+#endif
@@ -55,6 +55,8 @@ void Kernel::setConfig(const Config& config)
   m_ioContext.post(
     [this, newConfig=config]()
     {
+      setPCAP(newConfig.pcap, newConfig.pcapOutput, PCAPLinkType::DCCEX);
+
       if(newConfig.speedSteps != m_config.speedSteps)
         send(Messages::setSpeedSteps(newConfig.speedSteps));
 
@@ -83,6 +85,8 @@ void Kernel::start()
   m_ioContext.post(
     [this]()
     {
+      setPCAP(m_config.pcap, m_config.pcapOutput, PCAPLinkType::DCCEX);
+
       try
       {
         m_ioHandler->start();
@@ -112,6 +116,7 @@ void Kernel::stop()
       m_startupDelayTimer.cancel();
 
       m_ioHandler->stop();
+      m_pcap.reset();
     });
 
   m_ioContext.stop();
@@ -133,6 +138,8 @@ void Kernel::started()
 
 void Kernel::receive(std::string_view message)
 {
+  writePCAP(message.data(), message.size());
+
   if(m_config.debugLogRXTX)
     EventLoop::call(
       [this, msg=std::string(rtrim(message, '\n'))]()
@@ -159,11 +166,7 @@ void Kernel::receive(std::string_view message)
 
           if(value != TriState::Undefined)
           {
-            EventLoop::call(
-              [this, id, value]()
-              {
-                m_outputController->updateOutputValue(OutputChannel::Turnout, id, value);
-              });
+            m_events.pushOutput(*m_outputController, OutputChannel::Turnout, id, value);
           }
         }
         break;
@@ -212,11 +215,7 @@ void Kernel::receive(std::string_view message)
             {
               m_inputValues[id] = value;
 
-              EventLoop::call(
-                [this, id, value]()
-                {
-                  m_inputController->updateInputValue(InputChannel::Input, id, toTriState(value));
-                });
+              m_events.pushInput(*m_inputController, InputChannel::Input, id, toTriState(value));
             }
           }
         }
@@ -237,11 +236,7 @@ void Kernel::receive(std::string_view message)
 
           if(value != TriState::Undefined)
           {
-            EventLoop::call(
-              [this, id, value]()
-              {
-                m_outputController->updateOutputValue(OutputChannel::Output, id, value);
-              });
+            m_events.pushOutput(*m_outputController, OutputChannel::Output, id, value);
           }
         }
         break;
@@ -326,11 +321,7 @@ bool Kernel::setOutput(OutputChannel channel, uint16_t address, OutputValue valu
           send(Messages::setAccessory(address, std::get<OutputPairValue>(value) == OutputPairValue::Second));
 
           // no response for accessory command, assume it succeeds:
-          EventLoop::call(
-            [this, address, value]()
-            {
-              m_outputController->updateOutputValue(OutputChannel::Accessory, address, value);
-            });
+          m_events.pushOutput(*m_outputController, OutputChannel::Accessory, address, value);
         });
       return true;
 
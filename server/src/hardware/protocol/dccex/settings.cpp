@@ -31,6 +31,12 @@ Settings::Settings(Object& _parent, std::string_view parentPropertyName)
   , speedSteps{this, "speed_steps", 128, PropertyFlags::ReadWrite | PropertyFlags::Store}
   , startupDelay{this, "startup_delay", startupDelayDefault, PropertyFlags::ReadWrite | PropertyFlags::Store}
   , debugLogRXTX{this, "debug_log", false, PropertyFlags::ReadWrite | PropertyFlags::Store}
+  , pcap{this, "pcap", false, PropertyFlags::ReadWrite | PropertyFlags::Store,
+      [this](bool value)
+      {
+        Attributes::setEnabled(pcapOutput, value);
+      }}
+  , pcapOutput{this, "pcap_output", PCAPOutput::File, PropertyFlags::ReadWrite | PropertyFlags::Store}
 {
   Attributes::addDisplayName(speedSteps, DisplayName::Hardware::speedSteps);
   Attributes::addEnabled(speedSteps, false);
@@ -42,6 +48,14 @@ Settings::Settings(Object& _parent, std::string_view parentPropertyName)
 
   Attributes::addDisplayName(debugLogRXTX, DisplayName::Hardware::debugLogRXTX);
   m_interfaceItems.add(debugLogRXTX);
+
+  Attributes::addDisplayName(pcap, DisplayName::Hardware::pcap);
+  m_interfaceItems.add(pcap);
+
+  Attributes::addDisplayName(pcapOutput, DisplayName::Hardware::pcapOutput);
+  Attributes::addEnabled(pcapOutput, pcap);
+  Attributes::addValues(pcapOutput, pcapOutputValues);
+  m_interfaceItems.add(pcapOutput);
 }
 
 Config Settings::config() const
@@ -50,7 +64,16 @@ Config Settings::config() const
   config.speedSteps = speedSteps;
   config.startupDelay = startupDelay;
   config.debugLogRXTX = debugLogRXTX;
+  config.pcap = pcap;
+  config.pcapOutput = pcapOutput;
   return config;
 }
 
+void Settings::loaded()
+{
+  SubObject::loaded();
+
+  Attributes::setEnabled(pcapOutput, pcap);
+}
+
 }
@@ -38,12 +38,17 @@ class Settings : public SubObject
     static constexpr uint16_t startupDelayDefault = 2'500;
     static constexpr uint16_t startupDelayMax = 60'000;
 
+  protected:
+    void loaded() override;
+
   public:
     static constexpr std::array<uint8_t, 2> speedStepValues{28, 128};
 
     Property<uint8_t> speedSteps;
     Property<uint16_t> startupDelay;
     Property<bool> debugLogRXTX;
+    Property<bool> pcap;
+    Property<PCAPOutput> pcapOutput;
 
     Settings(Object& _parent, std::string_view parentPropertyName);
 
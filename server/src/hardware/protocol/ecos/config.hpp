@@ -23,11 +23,15 @@
 #ifndef TRAINTASTIC_SERVER_HARDWARE_PROTOCOL_ECOS_CONFIG_HPP
 #define TRAINTASTIC_SERVER_HARDWARE_PROTOCOL_ECOS_CONFIG_HPP
 
+#include <traintastic/enum/pcapoutput.hpp>
+
 namespace ECoS {
 
 struct Config
 {
   bool debugLogRXTX;
+  bool pcap;
+  PCAPOutput pcapOutput;
 };
 
 }
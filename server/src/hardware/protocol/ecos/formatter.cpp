@@ -0,0 +1,48 @@
+/**
+ * server/src/hardware/protocol/ecos/formatter.cpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "formatter.hpp"
+
+namespace ECoS {
+
+void Formatter::begin(std::string_view command, uint16_t objectId)
+{
+  m_buffer.clear();
+  m_buffer.append(command).append("(");
+  append(objectId);
+}
+
+std::string_view Formatter::end()
+{
+  m_buffer.append(")\n");
+  return m_buffer;
+}
+
+std::string_view Formatter::command(std::string_view command, uint16_t objectId, std::initializer_list<std::string_view> options)
+{
+  begin(command, objectId);
+  for(auto option : options)
+    m_buffer.append(", ").append(option);
+  return end();
+}
+
+}
@@ -0,0 +1,172 @@
+/**
+ * server/src/hardware/protocol/ecos/formatter.hpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TRAINTASTIC_SERVER_HARDWARE_PROTOCOL_ECOS_FORMATTER_HPP
+#define TRAINTASTIC_SERVER_HARDWARE_PROTOCOL_ECOS_FORMATTER_HPP
+
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace ECoS {
+
+struct Command
+{
+  static constexpr std::string_view queryObjects = "queryObjects";
+  static constexpr std::string_view set = "set";
+  static constexpr std::string_view get = "get";
+  static constexpr std::string_view create = "create";
+  static constexpr std::string_view delete_ = "delete";
+  static constexpr std::string_view request = "request";
+  static constexpr std::string_view release = "release";
+};
+
+/**
+ * \brief Formats ECoS commands into a reusable buffer
+ *
+ * The buffer keeps its capacity, so once warmed up formatting doesn't
+ * allocate. The returned view is valid until the next command is formatted.
+ */
+class Formatter
+{
+  private:
+    std::string m_buffer;
+
+    template<class T>
+    void appendValue(T value)
+    {
+      if constexpr(std::is_convertible_v<T, std::string_view>)
+      {
+        m_buffer.append(std::string_view{value});
+      }
+      else
+      {
+        static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>);
+        append(value);
+      }
+    }
+
+    void begin(std::string_view command, uint16_t objectId);
+    std::string_view end();
+
+  public:
+    //! \brief Clear the buffer, for building messages with append()
+    inline Formatter& clear()
+    {
+      m_buffer.clear();
+      return *this;
+    }
+
+    inline Formatter& append(std::string_view text)
+    {
+      m_buffer.append(text);
+      return *this;
+    }
+
+    template<class T>
+    Formatter& append(T value, int base = 10) requires(std::is_integral_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, char>)
+    {
+      std::array<char, 24> chars;
+      const auto r = std::to_chars(chars.data(), chars.data() + chars.size(), value, base);
+      m_buffer.append(chars.data(), r.ptr);
+      return *this;
+    }
+
+    inline std::string_view view() const
+    {
+      return m_buffer;
+    }
+
+    /**
+     * \brief Format: <tt>command(objectId, option, ...)</tt>
+     */
+    std::string_view command(std::string_view command, uint16_t objectId, std::initializer_list<std::string_view> options);
+
+    /**
+     * \brief Format: <tt>command(objectId, option[value, ...])</tt>
+     */
+    template<class T, class... Ts>
+    std::string_view command(std::string_view command, uint16_t objectId, std::string_view option, const T& value, const Ts&... values)
+    {
+      begin(command, objectId);
+      m_buffer.append(", ").append(option).append("[");
+      appendValue(value);
+      ((m_buffer.append(","), appendValue(values)), ...);
+      m_buffer.append("]");
+      return end();
+    }
+
+    inline std::string_view queryObjects(uint16_t objectId, std::initializer_list<std::string_view> options = {})
+    {
+      return command(Command::queryObjects, objectId, options);
+    }
+
+    inline std::string_view set(uint16_t objectId, std::initializer_list<std::string_view> options)
+    {
+      return command(Command::set, objectId, options);
+    }
+
+    template<class T, class... Ts>
+    std::string_view set(uint16_t objectId, std::string_view option, const T& value, const Ts&... values)
+    {
+      return command(Command::set, objectId, option, value, values...);
+    }
+
+    inline std::string_view get(uint16_t objectId, std::initializer_list<std::string_view> options)
+    {
+      return command(Command::get, objectId, options);
+    }
+
+    template<class T, class... Ts>
+    std::string_view get(uint16_t objectId, std::string_view option, const T& value, const Ts&... values)
+    {
+      return command(Command::get, objectId, option, value, values...);
+    }
+
+    inline std::string_view create(uint16_t objectId, std::initializer_list<std::string_view> options)
+    {
+      return command(Command::create, objectId, options);
+    }
+
+    inline std::string_view delete_(uint16_t objectId, std::initializer_list<std::string_view> options)
+    {
+      return command(Command::delete_, objectId, options);
+    }
+
+    inline std::string_view request(uint16_t objectId, std::initializer_list<std::string_view> options)
+    {
+      return command(Command::request, objectId, options);
+    }
+
+    inline std::string_view release(uint16_t objectId, std::initializer_list<std::string_view> options)
+    {
+      return command(Command::release, objectId, options);
+    }
+};
+
+}
+
+#endif
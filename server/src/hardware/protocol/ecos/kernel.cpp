@@ -39,9 +39,7 @@
 #include "../../output/outputcontroller.hpp"
 #include "../../../utils/setthreadname.hpp"
 #include "../../../utils/startswith.hpp"
-#include "../../../utils/ltrim.hpp"
 #include "../../../utils/rtrim.hpp"
-#include "../../../utils/tohex.hpp"
 #include "../../../core/eventloop.hpp"
 #include "../../../log/log.hpp"
 #include "../../../log/logmessageexception.hpp"
@@ -89,6 +87,8 @@ void Kernel::setConfig(const Config& config)
   m_ioContext.post(
     [this, newConfig=config]()
     {
+      setPCAP(newConfig.pcap, newConfig.pcapOutput, PCAPLinkType::ECoS);
+
       m_config = newConfig;
     });
 }
@@ -151,6 +151,8 @@ void Kernel::start()
   m_ioContext.post(
     [this]()
     {
+      setPCAP(m_config.pcap, m_config.pcapOutput, PCAPLinkType::ECoS);
+
       try
       {
         m_ioHandler->start();
@@ -178,6 +180,7 @@ void Kernel::stop(Simulation* simulation)
     [this]()
     {
       m_ioHandler->stop();
+      m_pcap.reset();
     });
 
   m_ioContext.stop();
@@ -267,6 +270,8 @@ void Kernel::started()
 
 void Kernel::receive(std::string_view message)
 {
+  writePCAP(message.data(), message.size());
+
   if(m_config.debugLogRXTX)
   {
     std::string msg{rtrim(message, {'\r', '\n'})};
@@ -488,10 +493,11 @@ void Kernel::simulateInputChange(InputChannel channel, uint32_t address, Simulat
                     mask |= 1 << i;
                 }
 
-                receive(
-                  std::string("<EVENT ").append(std::to_string(feedback->id())).append(">\r\n")
-                    .append(std::to_string(feedback->id())).append(" state[0x").append(mask != 0 ? ltrim(toHex(mask), '0') : std::string_view{"0"}).append("]>\r\n")
-                    .append("<END 0 (OK)>\r\n"));
+                receive(m_simulationFormatter.clear()
+                  .append("<EVENT ").append(feedback->id()).append(">\r\n")
+                  .append(feedback->id()).append(" state[0x").append(mask, 16).append("]>\r\n")
+                  .append("<END 0 (OK)>\r\n")
+                  .view());
 
                 break;
               }
@@ -522,19 +528,11 @@ void Kernel::switchManagerSwitched(SwitchProtocol protocol, uint16_t address, Ou
   switch(protocol)
   {
     case SwitchProtocol::DCC:
-      EventLoop::call(
-        [this, address, value]()
-        {
-          m_outputController->updateOutputValue(OutputChannel::AccessoryDCC, address, value);
-        });
+      m_events.pushOutput(*m_outputController, OutputChannel::AccessoryDCC, address, value);
       break;
 
     case SwitchProtocol::Motorola:
-      EventLoop::call(
-        [this, address, value]()
-        {
-          m_outputController->updateOutputValue(OutputChannel::AccessoryMotorola, address, value);
-        });
+      m_events.pushOutput(*m_outputController, OutputChannel::AccessoryMotorola, address, value);
       break;
 
     case SwitchProtocol::Unknown:
@@ -550,11 +548,7 @@ void Kernel::switchStateChanged(uint16_t objectId, uint8_t state)
   if(!m_outputController)
     return;
 
-  EventLoop::call(
-    [this, objectId, state]()
-    {
-      m_outputController->updateOutputValue(OutputChannel::ECoSObject, objectId, state);
-    });
+  m_events.pushOutput(*m_outputController, OutputChannel::ECoSObject, objectId, state);
 }
 
 void Kernel::feedbackStateChanged(Feedback& object, uint8_t port, TriState value)
@@ -584,22 +578,14 @@ void Kernel::feedbackStateChanged(Feedback& object, uint8_t port, TriState value
       offset += feedback->ports();
     }
 
-    EventLoop::call(
-      [this, address=offset + port, value]()
-      {
-        m_inputController->updateInputValue(InputChannel::S88, address, value);
-      });
+    m_events.pushInput(*m_inputController, InputChannel::S88, offset + port, value);
   }
   else // ECoS Detector
   {
     const uint16_t portsPerObject = 16;
     const uint16_t address = 1 + port + portsPerObject * (object.id() - ObjectId::ecosDetector);
 
-    EventLoop::call(
-      [this, address, value]()
-      {
-        m_inputController->updateInputValue(InputChannel::ECoSDetector, address, value);
-      });
+    m_events.pushInput(*m_inputController, InputChannel::ECoSDetector, address, value);
   }
 }
 
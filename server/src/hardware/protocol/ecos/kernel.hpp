@@ -30,6 +30,7 @@
 #include <traintastic/enum/inputchannel.hpp>
 #include <traintastic/enum/outputchannel.hpp>
 #include "config.hpp"
+#include "formatter.hpp"
 #include "iohandler/iohandler.hpp"
 #include "object/object.hpp"
 #include "object/switchprotocol.hpp"
@@ -92,6 +93,9 @@ class Kernel : public ::KernelBase
 
     Config m_config;
 
+    Formatter m_formatter; //!< for commands send by objects
+    Formatter m_simulationFormatter; //!< for simulated events, separate as handling an event may format a command
+
     Kernel(std::string logId_, const Config& config, bool simulation);
 
     void setIOHandler(std::unique_ptr<IOHandler> handler);
@@ -21,206 +21,142 @@
  */
 
 #include "messages.hpp"
-#include <cassert>
-#include <charconv>
+#include <type_traits>
 #include "../../../utils/startswith.hpp"
 #include "../../../utils/fromchars.hpp"
-#include "../../../utils/rtrim.hpp"
 
 namespace ECoS {
 
-static const std::string_view startDelimiterReply = "<REPLY ";
-static const std::string_view endDelimiter = "<END ";
+static constexpr std::string_view startDelimiterReply = "<REPLY ";
+static constexpr std::string_view startDelimiterEvent = "<EVENT ";
+static constexpr std::string_view endDelimiter = "<END ";
 
-bool parseRequest(std::string_view message, Request& request)
+//! \brief Read <tt>command(objectId, arguments)</tt>, \a n is advanced to the character after the \c )
+template<class T>
+static bool parseCommand(std::string_view message, size_t& n, T& command)
 {
   // read command:
-  size_t pos;
-  if((pos = message.find('(')) == std::string_view::npos)
+  const size_t commandBegin = n;
+  while(n < message.size() && message[n] != '(')
+    n++;
+  if(n >= message.size() || n == commandBegin)
     return false;
-  request.command = message.substr(0, pos);
+  command.command = message.substr(commandBegin, n - commandBegin);
+  n++;
 
   // read objectId:
-  auto r = fromChars(message.substr(pos + 1), request.objectId);
+  auto r = fromChars(message.substr(n), command.objectId);
   if(r.ec != std::errc())
     return false;
+  n = r.ptr - message.data();
 
-  // read arguments
-  size_t n = r.ptr - message.data();
-  while((pos = std::min(std::min(message.find(',', n), message.find(')', n)), message.find('[', n))) != std::string_view::npos)
+  // find end of arguments:
+  const size_t argumentsBegin = n;
+  while(n < message.size() && message[n] != ')')
   {
-    if(message[pos] == '[')
+    if(message[n] == '[')
     {
-      if((pos = message.find(']', pos)) == std::string_view::npos)
-        return false;
-      if((pos = std::min(message.find(',', pos), message.find(')', pos))) == std::string_view::npos)
+      if((n = findValueEnd(message, n + 1)) == std::string_view::npos)
         return false;
     }
-    while(message[n] == ' ' && n < pos)
+    else if(message[n] == '\n')
+      return false;
+    else
       n++;
-    if(pos > n)
-      request.options.emplace_back(&message[n], pos - n);
-    if(message[pos] == ')')
-      break;
-    n = pos + 1;
   }
+  if(n >= message.size())
+    return false;
+  command.options = ArgumentList(message.substr(argumentsBegin, n - argumentsBegin));
+  n++;
 
   return true;
 }
 
-bool isReply(std::string_view message)
-{
-  return startsWith(message, startDelimiterReply);
-}
-
-bool parseReply(std::string_view message, Reply& reply)
+//! \brief Read lines until <tt><END status (message)></tt>, \a n must be at the end of the header
+template<class T>
+static bool parseBody(std::string_view message, size_t n, T& result)
 {
-  if(!isReply(message))
-    return false;
-
-  size_t n = startDelimiterReply.size();
-  size_t pos;
-  if((pos = message.find('(', n)) == std::string_view::npos)
-    return false;
-
-  // read command:
-  reply.command = message.substr(n, pos - n);
-  n = pos + 1;
-
-  // read objectId
-  auto r = std::from_chars(&message[n], &message[message.size() - 1], reply.objectId);
-  if(r.ec != std::errc())
-    return false;
-
-  // read arguments
-  n = r.ptr - message.data();
-  while((pos = std::min(std::min(message.find(',', n), message.find(')', n)), message.find('[', n))) != std::string_view::npos)
-  {
-    if(message[pos] == '[')
-    {
-      if((pos = message.find(']', pos)) == std::string_view::npos)
-        return false;
-      if((pos = std::min(message.find(',', pos), message.find(')', pos))) == std::string_view::npos)
-        return false;
-    }
-    while(message[n] == ' ' && n < pos)
-      n++;
-    if(pos > n)
-      reply.options.emplace_back(&message[n], pos - n);
-    if(message[pos] == ')')
-      break;
-    n = pos + 1;
-  }
-  if(pos == std::string_view::npos || pos + 1 >= message.size() || message[pos + 1] != '>')
-    return false;
-
   // advance to next line
-  n = pos + 2;
-  while((message[n] == '\n' || message[n] == '\r') && n < message.size())
+  while(n < message.size() && (message[n] == '\n' || message[n] == '\r'))
     n++;
   if(n >= message.size())
     return false;
 
-  // find end
-  size_t end;
-  if((end = message.find(endDelimiter, n)) == std::string_view::npos)
-    return false;
-
-  // read lines
-  if(end > n)
+  // read lines, until end
+  const size_t linesBegin = n;
+  while(message.substr(n, endDelimiter.size()) != endDelimiter)
   {
-    while((pos = message.find('\n', n)) < end)
-    {
-      reply.lines.emplace_back(rtrim({&message[n], pos - n}, '\r'));
-      n = pos + 1;
-    }
+    if((n = message.find('\n', n)) == std::string_view::npos)
+      return false;
+    n++;
   }
+  result.lines = LineList(message.substr(linesBegin, n - linesBegin));
+  n += endDelimiter.size();
 
   // read status code
   std::underlying_type_t<Status> status;
-  r = std::from_chars(&message[end + endDelimiter.size()], &message[message.size() - 1], status);
+  auto r = fromChars(message.substr(n), status);
   if(r.ec != std::errc())
     return false;
-  reply.status = static_cast<Status>(status);
+  result.status = static_cast<Status>(status);
   n = r.ptr - message.data();
 
   // read status message
-  while(message[n] != '(' && message[n] != '\n' && message[n] != '\r' && n < message.size())
+  while(n < message.size() && message[n] != '(' && message[n] != '\n' && message[n] != '\r')
     n++;
   if(n >= message.size() || message[n] != '(')
     return false;
 
-  pos = ++n;
-  while(message[pos] != ')' && message[pos] != '\n' && message[pos] != '\r' && n < message.size())
-    pos++;
-  if(pos >= message.size() || message[pos] != ')')
+  const size_t statusMessageBegin = ++n;
+  while(n < message.size() && message[n] != ')' && message[n] != '\n' && message[n] != '\r')
+    n++;
+  if(n >= message.size() || message[n] != ')')
     return false;
 
-  reply.statusMessage = message.substr(n, pos - n);
+  result.statusMessage = message.substr(statusMessageBegin, n - statusMessageBegin);
 
   return true;
 }
 
-bool parseEvent(std::string_view message, Event& event)
+bool parseRequest(std::string_view message, Request& request)
 {
-  static const std::string_view startDelimiter = "<EVENT ";
-
-  if(!startsWith(message, startDelimiter))
-    return false;
+  size_t n = 0;
+  return parseCommand(message, n, request);
+}
 
-  size_t n = startDelimiter.size();
-  size_t pos;
+bool isReply(std::string_view message)
+{
+  return startsWith(message, startDelimiterReply);
+}
 
-  // read objectId
-  auto r = std::from_chars(&message[n], &message[message.size() - 1], event.objectId);
-  if(r.ec != std::errc())
+bool parseReply(std::string_view message, Reply& reply)
+{
+  if(!isReply(message))
     return false;
 
-  // advance to next line
-  n = r.ptr - message.data() + 1;
-  while((message[n] == '\n' || message[n] == '\r') && n < message.size())
-    n++;
-  if(n >= message.size())
+  size_t n = startDelimiterReply.size();
+  if(!parseCommand(message, n, reply))
     return false;
-
-  // find end
-  size_t end;
-  if((end = message.find(endDelimiter, n)) == std::string_view::npos)
+  if(n >= message.size() || message[n] != '>')
     return false;
 
-  // read lines
-  if(end > n)
-  {
-    while((pos = message.find('\n', n)) < end)
-    {
-      event.lines.emplace_back(rtrim({&message[n], pos - n}, '\r'));
-      n = pos + 1;
-    }
-  }
+  return parseBody(message, n + 1, reply);
+}
 
-  // read status code
-  std::underlying_type_t<Status> status;
-  r = std::from_chars(&message[end + endDelimiter.size()], &message[message.size() - 1], status);
-  if(r.ec != std::errc())
+bool parseEvent(std::string_view message, Event& event)
+{
+  if(!startsWith(message, startDelimiterEvent))
     return false;
-  event.status = static_cast<Status>(status);
-  n = r.ptr - message.data();
 
-  // read status message
-  while(message[n] != '(' && message[n] != '\n' && message[n] != '\r' && n < message.size())
-    n++;
-  if(n >= message.size() || message[n] != '(')
+  // read objectId
+  auto r = fromChars(message.substr(startDelimiterEvent.size()), event.objectId);
+  if(r.ec != std::errc())
     return false;
-
-  pos = ++n;
-  while(message[pos] != ')' && message[pos] != '\n' && message[pos] != '\r' && n < message.size())
-    pos++;
-  if(pos >= message.size() || message[pos] != ')')
+  size_t n = r.ptr - message.data();
+  if(n >= message.size() || message[n] != '>')
     return false;
 
-  event.statusMessage = message.substr(n, pos - n);
-
-  return true;
+  return parseBody(message, n + 1, event);
 }
 
 bool parseId(std::string_view line, uint16_t& id)
@@ -235,34 +171,7 @@ bool parseLine(std::string_view text, Line& line)
   if(r.ec != std::errc())
     return false;
 
-  assert(line.values.empty());
-
-  size_t n = r.ptr - text.data();
-  while(n < text.size())
-  {
-    while(text[n] == ' ' && n < text.size())
-      n++;
-
-    if(n < text.size())
-    {
-      size_t pos = text.find('[', n);
-      if(pos != std::string_view::npos)
-      {
-        std::string_view key{text.data() + n, pos - n};
-        n = pos + 1;
-        if(n >= text.size())
-          return false;
-        const bool quoted = (text[n] == '"');
-        pos = quoted ? text.find("\"]", ++n) : text.find(']', n);
-        if(pos == std::string_view::npos)
-          return false;
-        line.values.emplace(key, std::string_view{text.data() + n, pos - n});
-        n = pos + (quoted ? 2 : 1);
-      }
-      else
-        n = pos;
-    }
-  }
+  line.values = ValueList(text.substr(r.ptr - text.data()));
 
   return true;
 }
@@ -270,7 +179,7 @@ bool parseLine(std::string_view text, Line& line)
 bool parseOptionValue(std::string_view text, std::string_view& option, std::string_view& value)
 {
   auto n = text.find('[');
-  if(n == std::string_view::npos || *text.rbegin() != ']')
+  if(n == std::string_view::npos || text.back() != ']')
     return false;
   option = text.substr(0, n);
   value = text.substr(n + 1, text.size() - (n + 2));
@@ -23,24 +23,13 @@
 #ifndef TRAINTASTIC_SERVER_HARDWARE_PROTOCOL_ECOS_MESSAGES_HPP
 #define TRAINTASTIC_SERVER_HARDWARE_PROTOCOL_ECOS_MESSAGES_HPP
 
-#include <string>
-#include <vector>
-#include <unordered_map>
 #include <cstdint>
+#include <string_view>
+#include "formatter.hpp"
+#include "tokenizer.hpp"
 
 namespace ECoS {
 
-struct Command
-{
-  static constexpr std::string_view queryObjects = "queryObjects";
-  static constexpr std::string_view set = "set";
-  static constexpr std::string_view get = "get";
-  static constexpr std::string_view create = "create";
-  static constexpr std::string_view delete_ = "delete";
-  static constexpr std::string_view request = "request";
-  static constexpr std::string_view release = "release";
-};
-
 struct ObjectId
 {
   static constexpr uint16_t ecos = 1;
@@ -112,15 +101,15 @@ struct Request
 {
   std::string_view command;
   uint16_t objectId;
-  std::vector<std::string_view> options;
+  ArgumentList options;
 };
 
 struct Reply
 {
   std::string_view command;
   uint16_t objectId;
-  std::vector<std::string_view> options;
-  std::vector<std::string_view> lines;
+  ArgumentList options;
+  LineList lines;
   Status status;
   std::string_view statusMessage;
 };
@@ -128,7 +117,7 @@ struct Reply
 struct Event
 {
   uint16_t objectId;
-  std::vector<std::string_view> lines;
+  LineList lines;
   Status status;
   std::string_view statusMessage;
 };
@@ -136,92 +125,9 @@ struct Event
 struct Line
 {
   uint16_t objectId;
-  std::unordered_map<std::string_view, std::string_view> values;
+  ValueList values;
 };
 
-inline std::string buildCommand(std::string_view command, uint16_t objectId, std::initializer_list<std::string_view> options)
-{
-  std::string s(command);
-  s.append("(").append(std::to_string(objectId));
-  for(auto option : options)
-    s.append(", ").append(option);
-  s.append(")\n");
-  return s;
-}
-
-inline std::string queryObjects(uint16_t objectId, std::initializer_list<std::string_view> options = {})
-{
-  return buildCommand(Command::queryObjects, objectId, options);
-}
-
-inline std::string set(uint16_t objectId, std::initializer_list<std::string_view> options)
-{
-  return buildCommand(Command::set, objectId, options);
-}
-
-template<class T>
-inline std::string set(uint16_t objectId, std::string_view option, T value)
-{
-  std::string s(Command::set);
-  s.append("(").append(std::to_string(objectId));
-  s.append(", ").append(option);
-  s.append("[");
-  if constexpr(std::is_same_v<T, std::string>)
-    s.append(value);
-  else
-    s.append(std::to_string(value));
-  s.append("]");
-  s.append(")\n");
-  return s;
-}
-
-template<class T1, class T2>
-inline std::string set(uint16_t objectId, std::string_view option, T1 value1, T2 value2)
-{
-  std::string s(Command::set);
-  s.append("(").append(std::to_string(objectId));
-  s.append(", ").append(option);
-  s.append("[").append(std::to_string(value1)).append(",").append(std::to_string(value2)).append("]");
-  s.append(")\n");
-  return s;
-}
-
-inline std::string get(uint16_t objectId, std::initializer_list<std::string_view> options)
-{
-  return buildCommand(Command::get, objectId, options);
-}
-
-template<class T>
-inline std::string get(uint16_t objectId, std::string_view option, T value)
-{
-  std::string s(Command::get);
-  s.append("(").append(std::to_string(objectId));
-  s.append(", ").append(option);
-  s.append("[").append(std::to_string(value)).append("]");
-  s.append(")\n");
-  return s;
-}
-
-inline std::string create(uint16_t objectId, std::initializer_list<std::string_view> options)
-{
-  return buildCommand(Command::create, objectId, options);
-}
-
-inline std::string delete_(uint16_t objectId, std::initializer_list<std::string_view> options)
-{
-  return buildCommand(Command::delete_, objectId, options);
-}
-
-inline std::string request(uint16_t objectId, std::initializer_list<std::string_view> options)
-{
-  return buildCommand(Command::request, objectId, options);
-}
-
-inline std::string release(uint16_t objectId, std::initializer_list<std::string_view> options)
-{
-  return buildCommand(Command::release, objectId, options);
-}
-
 bool parseRequest(std::string_view message, Request& request);
 
 bool isReply(std::string_view message);
@@ -33,7 +33,7 @@ ECoS::ECoS(Kernel& kernel)
   : Object(kernel, ObjectId::ecos)
 {
   requestView();
-  send(get(m_id, {
+  send(format().get(m_id, {
     Option::commandstationtype,
     Option::protocolversion,
     Option::hardwareversion,
@@ -83,13 +83,13 @@ bool ECoS::receiveEvent(const Event& event)
 void ECoS::go()
 {
   if(m_go != TriState::True)
-    send(set(m_id, {Option::go}));
+    send(format().set(m_id, {Option::go}));
 }
 
 void ECoS::stop()
 {
   if(m_go != TriState::False)
-    send(set(m_id, {Option::stop}));
+    send(format().set(m_id, {Option::stop}));
 }
 
 void ECoS::update(std::string_view option, std::string_view value)
@@ -35,19 +35,14 @@ Feedback::Feedback(Kernel& kernel, uint16_t id)
   : Object(kernel, id)
 {
   requestView();
-  send(get(m_id, {Option::state}));
+  send(format().get(m_id, {Option::state}));
 }
 
 Feedback::Feedback(Kernel& kernel, const Line& data)
   : Feedback(kernel, data.objectId)
 {
-  const auto values = data.values;
-  if(auto ports = values.find(Option::ports); ports != values.end())
-  {
-    size_t n;
-    if(fromChars(ports->second, n).ec == std::errc())
-      m_state.resize(n, TriState::Undefined);
-  }
+  if(size_t n; data.values.get(Option::ports, n))
+    m_state.resize(n, TriState::Undefined);
 }
 
 void Feedback::update(std::string_view option, std::string_view value)
@@ -31,7 +31,7 @@ FeedbackManager::FeedbackManager(Kernel& kernel)
   : Object(kernel, ObjectId::feedbackManager)
 {
   requestView();
-  send(queryObjects(m_id, Feedback::options));
+  send(format().queryObjects(m_id, Feedback::options));
 }
 
 bool FeedbackManager::receiveReply(const Reply& reply)
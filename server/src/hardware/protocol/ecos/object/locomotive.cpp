@@ -33,21 +33,19 @@ Locomotive::Locomotive(Kernel& kernel, uint16_t id)
   : Object(kernel, id)
 {
   requestView();
-  send(get(m_id, {Option::dir, Option::speedStep}));
+  send(format().get(m_id, {Option::dir, Option::speedStep}));
 }
 
 Locomotive::Locomotive(Kernel& kernel, const Line& data)
   : Locomotive(kernel, data.objectId)
 {
-  const auto values = data.values;
-  if(auto addr = values.find(Option::addr); addr != values.end())
-    fromChars(addr->second, m_address);
-  if(auto protocol = values.find(Option::protocol); protocol != values.end())
-    fromString(protocol->second, m_protocol);
+  data.values.get(Option::addr, m_address);
+  if(std::string_view protocol; data.values.get(Option::protocol, protocol))
+    fromString(protocol, m_protocol);
 
   if(m_protocol != LocomotiveProtocol::Unknown)
     for(uint8_t i = 0; i < getFunctionCount(); i++)
-      send(get(m_id, Option::func, i));
+      send(format().get(m_id, Option::func, i));
 }
 
 bool Locomotive::receiveReply(const Reply& reply)
@@ -71,7 +69,7 @@ bool Locomotive::receiveEvent(const Event& event)
 
 void Locomotive::stop()
 {
-  send(set(m_id, {Option::stop}));
+  send(format().set(m_id, {Option::stop}));
 }
 
 void Locomotive::setSpeedStep(uint8_t value)
@@ -79,7 +77,7 @@ void Locomotive::setSpeedStep(uint8_t value)
   if(m_speedStep != value)
   {
     requestControl();
-    send(set(m_id, Option::speedStep, value));
+    send(format().set(m_id, Option::speedStep, value));
   }
 }
 
@@ -88,7 +86,7 @@ void Locomotive::setDirection(Direction value)
   if(m_direction != value)
   {
     requestControl();
-    send(set(m_id, Option::dir, (value == Direction::Reverse) ? 1 : 0));
+    send(format().set(m_id, Option::dir, (value == Direction::Reverse) ? 1 : 0));
   }
 }
 
@@ -105,7 +103,7 @@ void Locomotive::setFunctionValue(uint8_t index, bool value)
   if(it == m_functions.end() || it->second.value != value)
   {
     requestControl();
-    send(set(m_id, Option::func, index, value ? 1 : 0));
+    send(format().set(m_id, Option::func, index, value ? 1 : 0));
   }
 }
 
@@ -134,7 +132,7 @@ void Locomotive::update(std::string_view option, std::string_view value)
 void Locomotive::requestControl()
 {
   if(!m_control)
-    send(request(m_id, {Option::control, Option::force}));
+    send(format().request(m_id, {Option::control, Option::force}));
 }
 
 }
@@ -31,7 +31,7 @@ LocomotiveManager::LocomotiveManager(Kernel& kernel)
   : Object(kernel, ObjectId::locomotiveManager)
 {
   requestView();
-  send(queryObjects(m_id, Locomotive::options));
+  send(format().queryObjects(m_id, Locomotive::options));
 }
 
 bool LocomotiveManager::receiveReply(const Reply& reply)
@@ -65,7 +65,12 @@ bool Object::receiveEvent(const Event& event)
 void Object::requestView()
 {
   if(!m_isViewActive)
-    send(request(m_id, {Option::view}));
+    send(format().request(m_id, {Option::view}));
+}
+
+Formatter& Object::format()
+{
+  return m_kernel.m_formatter;
 }
 
 void Object::send(std::string_view message)
@@ -93,14 +98,14 @@ void Object::removeObject(uint16_t objectId)
   m_kernel.removeObject(objectId);
 }
 
-void Object::update(const std::vector<std::string_view>& lines)
+void Object::update(const LineList& lines)
 {
   for(auto line : lines)
   {
     Line data;
     if(parseLine(line, data))
-      for(auto it : data.values)
-        update(it.first, it.second);
+      for(const auto& [option, value] : data.values)
+        update(option, value);
   }
 }
 
@@ -25,25 +25,27 @@
 
 #include <cstdint>
 #include <memory>
-#include <vector>
 #include <string_view>
 
 namespace ECoS {
 
 class Kernel;
+class Formatter;
 struct Reply;
 struct Event;
+class LineList;
 
 class Object
 {
   private:
-    void update(const std::vector<std::string_view>& lines);
+    void update(const LineList& lines);
 
   protected:
     Kernel& m_kernel;
     const uint16_t m_id;
     bool m_isViewActive = false;
 
+    Formatter& format();
     void send(std::string_view message);
 
     bool objectExists(uint16_t objectId) const;
@@ -45,7 +45,7 @@ Switch::Switch(Kernel& kernel, uint16_t id)
 {
   requestView();
 
-  send(get(m_id, {
+  send(format().get(m_id, {
     Option::name1,
     Option::name2,
     Option::name3,
@@ -92,7 +92,7 @@ std::string Switch::nameUI() const
 
 void Switch::setState(uint8_t value)
 {
-  send(set(m_id, Option::state, value));
+  send(format().set(m_id, Option::state, value));
 }
 
 void Switch::update(std::string_view option, std::string_view value)
@@ -21,7 +21,10 @@
  */
 
 #include "switchmanager.hpp"
+#include <algorithm>
+#include <array>
 #include <cassert>
+#include <charconv>
 #include "switch.hpp"
 #include "../kernel.hpp"
 #include "../messages.hpp"
@@ -35,13 +38,20 @@ SwitchManager::SwitchManager(Kernel& kernel)
   : Object(kernel, ObjectId::switchManager)
 {
   requestView();
-  send(queryObjects(m_id, {Option::type}));
+  send(format().queryObjects(m_id, {Option::type}));
 }
 
 void SwitchManager::setSwitch(SwitchProtocol protocol, uint16_t address, bool port)
 {
   if(protocol == SwitchProtocol::DCC || protocol == SwitchProtocol::Motorola) /*[[likely]]*/
-    send(set(m_id, Option::switch_, std::string((protocol == SwitchProtocol::Motorola) ? "MOT" : "DCC").append(std::to_string(address)).append(port ? "g" : "r")));
+  {
+    // value: <protocol><address><port>, e.g. DCC12g
+    std::array<char, 16> value;
+    char* p = std::copy_n((protocol == SwitchProtocol::Motorola) ? "MOT" : "DCC", 3, value.data());
+    p = std::to_chars(p, value.data() + value.size() - 1, address).ptr;
+    *p++ = port ? 'g' : 'r';
+    send(format().set(m_id, Option::switch_, std::string_view(value.data(), p - value.data())));
+  }
 }
 
 bool SwitchManager::receiveReply(const Reply& reply)
@@ -56,7 +66,7 @@ bool SwitchManager::receiveReply(const Reply& reply)
       if(parseLine(line, data) && !objectExists(data.objectId))
       {
         SwitchType type = SwitchType::Unknown;
-        if(auto it = data.values.find(Option::type); it != data.values.end() && fromString(it->second, type))
+        if(std::string_view value; data.values.get(Option::type, value) && fromString(value, type))
         {
           switch(type)
           {
@@ -91,7 +101,7 @@ bool SwitchManager::receiveEvent(const Event& event)
     {
       if(firstLine.objectId == m_id) // TODO: msg[LIST_CHANGED]
       {
-        if(auto msg = firstLine.values.find("msg"); msg != firstLine.values.end() && msg->second == "LIST_CHANGED")
+        if(std::string_view msg; firstLine.values.get("msg", msg) && msg == "LIST_CHANGED")
         {
           auto it = event.lines.begin();
           it++; // skip first line
@@ -29,10 +29,24 @@ namespace ECoS {
 Settings::Settings(Object& _parent, std::string_view parentPropertyName)
   : SubObject(_parent, parentPropertyName)
   , debugLogRXTX{this, "debug_log_rx_tx", false, PropertyFlags::ReadWrite | PropertyFlags::Store}
+  , pcap{this, "pcap", false, PropertyFlags::ReadWrite | PropertyFlags::Store,
+      [this](bool value)
+      {
+        Attributes::setEnabled(pcapOutput, value);
+      }}
+  , pcapOutput{this, "pcap_output", PCAPOutput::File, PropertyFlags::ReadWrite | PropertyFlags::Store}
 {
   Attributes::addDisplayName(debugLogRXTX, DisplayName::Hardware::debugLogRXTX);
   //Attributes::addGroup(debugLogRXTX, Group::debug);
   m_interfaceItems.add(debugLogRXTX);
+
+  Attributes::addDisplayName(pcap, DisplayName::Hardware::pcap);
+  m_interfaceItems.add(pcap);
+
+  Attributes::addDisplayName(pcapOutput, DisplayName::Hardware::pcapOutput);
+  Attributes::addEnabled(pcapOutput, pcap);
+  Attributes::addValues(pcapOutput, pcapOutputValues);
+  m_interfaceItems.add(pcapOutput);
 }
 
 Config Settings::config() const
@@ -40,8 +54,17 @@ Config Settings::config() const
   Config config;
 
   config.debugLogRXTX = debugLogRXTX;
+  config.pcap = pcap;
+  config.pcapOutput = pcapOutput;
 
   return config;
 }
 
+void Settings::loaded()
+{
+  SubObject::loaded();
+
+  Attributes::setEnabled(pcapOutput, pcap);
+}
+
 }
@@ -31,10 +31,15 @@ namespace ECoS {
 
 class Settings final : public SubObject
 {
+  protected:
+    void loaded() final;
+
   public:
     CLASS_ID("ecos_settings")
 
     Property<bool> debugLogRXTX;
+    Property<bool> pcap;
+    Property<PCAPOutput> pcapOutput;
 
     Settings(Object& _parent, std::string_view parentPropertyName);
 
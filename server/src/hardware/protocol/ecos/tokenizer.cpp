@@ -0,0 +1,130 @@
+/**
+ * server/src/hardware/protocol/ecos/tokenizer.cpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "tokenizer.hpp"
+
+namespace ECoS {
+
+size_t findValueEnd(std::string_view text, size_t pos)
+{
+  if(pos < text.size() && text[pos] == '"') // quoted value
+  {
+    pos = text.find("\"]", pos + 1);
+    return pos == std::string_view::npos ? pos : pos + 2;
+  }
+  pos = text.find(']', pos);
+  return pos == std::string_view::npos ? pos : pos + 1;
+}
+
+void ArgumentList::Iterator::next()
+{
+  size_t n = m_pos;
+  while(n < m_text.size() && (m_text[n] == ',' || m_text[n] == ' '))
+    n++;
+
+  if(n >= m_text.size())
+  {
+    m_token = {};
+    m_tokenData = nullptr;
+    return;
+  }
+
+  const size_t begin = n;
+  while(n < m_text.size() && m_text[n] != ',')
+  {
+    if(m_text[n] == '[')
+    {
+      n = findValueEnd(m_text, n + 1);
+      if(n == std::string_view::npos)
+        n = m_text.size();
+    }
+    else
+      n++;
+  }
+
+  size_t end = n;
+  while(m_text[end - 1] == ' ') // can't pass begin, that isn't a space
+    end--;
+
+  m_token = m_text.substr(begin, end - begin);
+  m_tokenData = m_token.data();
+  m_pos = n;
+}
+
+void LineList::Iterator::next()
+{
+  if(m_pos >= m_text.size())
+  {
+    m_token = {};
+    m_tokenData = nullptr;
+    return;
+  }
+
+  size_t end = m_text.find('\n', m_pos);
+  if(end == std::string_view::npos)
+    end = m_text.size();
+
+  size_t size = end - m_pos;
+  while(size > 0 && m_text[m_pos + size - 1] == '\r')
+    size--;
+
+  m_token = m_text.substr(m_pos, size);
+  m_tokenData = m_text.data() + m_pos;
+  m_pos = end + 1;
+}
+
+void ValueList::Iterator::next()
+{
+  size_t n = m_pos;
+  while(n < m_text.size() && m_text[n] == ' ')
+    n++;
+
+  const size_t begin = n;
+  while(n < m_text.size() && m_text[n] != '[' && m_text[n] != ' ')
+    n++;
+
+  if(n >= m_text.size() || m_text[n] != '[' || n == begin) // end or option without value
+  {
+    m_token = {};
+    m_tokenData = nullptr;
+    m_pos = m_text.size();
+    return;
+  }
+
+  const size_t valueEnd = findValueEnd(m_text, n + 1);
+  if(valueEnd == std::string_view::npos)
+  {
+    m_token = {};
+    m_tokenData = nullptr;
+    m_pos = m_text.size();
+    return;
+  }
+
+  const bool quoted = m_text[n + 1] == '"';
+  const size_t valueBegin = n + (quoted ? 2 : 1);
+  m_token.first = m_text.substr(begin, n - begin);
+  m_token.second = m_text.substr(valueBegin, valueEnd - (quoted ? 2 : 1) - valueBegin);
+  m_tokenData = m_token.first.data();
+  m_pos = valueEnd;
+}
+
+}
@@ -0,0 +1,285 @@
+/**
+ * server/src/hardware/protocol/ecos/tokenizer.hpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TRAINTASTIC_SERVER_HARDWARE_PROTOCOL_ECOS_TOKENIZER_HPP
+#define TRAINTASTIC_SERVER_HARDWARE_PROTOCOL_ECOS_TOKENIZER_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include "../../../utils/fromchars.hpp"
+
+/**
+ * \file
+ * \brief Allocation free tokenizing of ECoS messages
+ *
+ * The lists are views on the received message, tokens are found while
+ * iterating. They are only valid as long as the message buffer is.
+ */
+
+namespace ECoS {
+
+/**
+ * \brief Find the end of a bracketed value
+ *
+ * \param[in] text Text to search in
+ * \param[in] pos Position of the first character after the \c [
+ * \return Position of the first character after the closing \c ] or \c npos if there is none.
+ */
+size_t findValueEnd(std::string_view text, size_t pos);
+
+/**
+ * \brief Base for forward iterators over tokens of a text
+ *
+ * \tparam Derived Must implement <tt>void next()</tt>, which sets \c m_token and \c m_tokenData or \c nullptr at the end.
+ * \tparam T Token type
+ */
+template<class Derived, class T>
+class TokenIterator
+{
+  protected:
+    std::string_view m_text;
+    size_t m_pos = 0; //!< start of next token
+    T m_token = {};
+    const char* m_tokenData = nullptr; //!< start of the token in the text, separate as tokens may be empty
+
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
+    TokenIterator() = default;
+
+    explicit TokenIterator(std::string_view text)
+      : m_text{text}
+    {
+    }
+
+    reference operator *() const
+    {
+      return m_token;
+    }
+
+    pointer operator ->() const
+    {
+      return &m_token;
+    }
+
+    Derived& operator ++()
+    {
+      static_cast<Derived*>(this)->next();
+      return static_cast<Derived&>(*this);
+    }
+
+    Derived operator ++(int)
+    {
+      Derived tmp = static_cast<Derived&>(*this);
+      ++*this;
+      return tmp;
+    }
+
+    bool operator ==(const TokenIterator& other) const
+    {
+      return m_tokenData == other.m_tokenData;
+    }
+};
+
+/**
+ * \brief Comma separated arguments of a command, e.g. <tt>view, name1["abc"], func[3,1]</tt>
+ *
+ * Leading and trailing spaces are removed, empty arguments are skipped.
+ */
+class ArgumentList
+{
+  private:
+    std::string_view m_text;
+
+  public:
+    class Iterator : public TokenIterator<Iterator, std::string_view>
+    {
+      friend class TokenIterator<Iterator, std::string_view>;
+
+      private:
+        void next();
+
+      public:
+        Iterator() = default;
+
+        explicit Iterator(std::string_view text)
+          : TokenIterator(text)
+        {
+          next();
+        }
+    };
+
+    ArgumentList() = default;
+
+    explicit ArgumentList(std::string_view text)
+      : m_text{text}
+    {
+    }
+
+    Iterator begin() const { return Iterator(m_text); }
+    Iterator end() const { return {}; }
+
+    bool empty() const { return begin() == end(); }
+    size_t size() const { return static_cast<size_t>(std::distance(begin(), end())); }
+    std::string_view front() const { return *begin(); }
+
+    //! \note Linear time, intended for the first few arguments only.
+    std::string_view operator [](size_t index) const
+    {
+      return *std::next(begin(), static_cast<std::ptrdiff_t>(index));
+    }
+};
+
+/**
+ * \brief Lines of a reply or event body, without line ending
+ */
+class LineList
+{
+  private:
+    std::string_view m_text;
+
+  public:
+    class Iterator : public TokenIterator<Iterator, std::string_view>
+    {
+      friend class TokenIterator<Iterator, std::string_view>;
+
+      private:
+        void next();
+
+      public:
+        Iterator() = default;
+
+        explicit Iterator(std::string_view text)
+          : TokenIterator(text)
+        {
+          next();
+        }
+    };
+
+    LineList() = default;
+
+    explicit LineList(std::string_view text)
+      : m_text{text}
+    {
+    }
+
+    Iterator begin() const { return Iterator(m_text); }
+    Iterator end() const { return {}; }
+
+    bool empty() const { return m_text.empty(); }
+    size_t size() const { return static_cast<size_t>(std::distance(begin(), end())); }
+    std::string_view front() const { return *begin(); }
+};
+
+/**
+ * \brief Option values of a line, e.g. <tt>addr[3] protocol[DCC28] name["abc"]</tt>
+ *
+ * Quotes around values are removed, iteration stops at the first token
+ * without value, e.g. \c appended in a LIST_CHANGED event.
+ */
+class ValueList
+{
+  public:
+    using Value = std::pair<std::string_view, std::string_view>; //!< option, value
+
+  private:
+    std::string_view m_text;
+
+  public:
+    class Iterator : public TokenIterator<Iterator, Value>
+    {
+      friend class TokenIterator<Iterator, Value>;
+
+      private:
+        void next();
+
+      public:
+        Iterator() = default;
+
+        explicit Iterator(std::string_view text)
+          : TokenIterator(text)
+        {
+          next();
+        }
+    };
+
+    ValueList() = default;
+
+    explicit ValueList(std::string_view text)
+      : m_text{text}
+    {
+    }
+
+    Iterator begin() const { return Iterator(m_text); }
+    Iterator end() const { return {}; }
+
+    bool empty() const { return begin() == end(); }
+
+    Iterator find(std::string_view option) const
+    {
+      auto it = begin();
+      while(it != end() && it->first != option)
+        ++it;
+      return it;
+    }
+
+    /**
+     * \brief Get a typed option value
+     *
+     * \param[in] option Option name
+     * \param[out] value Option value, only written on success
+     * \return \c true if the option exists and its value could be converted, \c false otherwise.
+     */
+    template<class T>
+    bool get(std::string_view option, T& value) const
+    {
+      auto it = find(option);
+      if(it == end())
+        return false;
+      if constexpr(std::is_same_v<T, std::string_view>)
+      {
+        value = it->second;
+        return true;
+      }
+      else
+      {
+        static_assert(std::is_integral_v<T>);
+        T v;
+        auto r = fromChars(it->second, v);
+        if(r.ec != std::errc() || r.ptr != it->second.data() + it->second.size())
+          return false;
+        value = v;
+        return true;
+      }
+    }
+};
+
+}
+
+#endif
@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2023 Reinder Feenstra
+ * Copyright (C) 2023,2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -22,6 +22,11 @@
 
 #include "kernelbase.hpp"
 #include "../../core/eventloop.hpp"
+#include "../../log/log.hpp"
+#include "../../pcap/pcapfile.hpp"
+#include "../../pcap/pcappipe.hpp"
+#include "../../traintastic/traintastic.hpp"
+#include "../../utils/datetimestr.hpp"
 
 KernelBase::KernelBase(std::string logId_)
   : m_ioContext{1}
@@ -29,6 +34,13 @@ KernelBase::KernelBase(std::string logId_)
 {
 }
 
+void KernelBase::setOnEventQueueStatistics(KernelEventQueue::OnStatistics callback)
+{
+  assert(isEventLoopThread());
+  assert(!m_started);
+  m_events.setOnStatistics(std::move(callback));
+}
+
 void KernelBase::setOnStarted(std::function<void()> callback)
 {
   assert(isEventLoopThread());
@@ -80,3 +92,60 @@ void KernelBase::started()
       });
   }
 }
+
+void KernelBase::setPCAP(bool enabled, PCAPOutput output, uint32_t linkType)
+{
+  if(!enabled)
+  {
+    m_pcap.reset();
+    return;
+  }
+
+  if(m_pcap && output == m_pcapOutput)
+    return; // already capturing
+
+  m_pcap.reset();
+  m_pcapOutput = output;
+
+  try
+  {
+    switch(output)
+    {
+      case PCAPOutput::File:
+      {
+        const auto filename = Traintastic::instance->debugDir() / logId += dateTimeStr() += ".pcap";
+        EventLoop::call(
+          [this, filename]()
+          {
+            Log::log(logId, LogMessage::N2004_STARTING_PCAP_FILE_LOG_X, filename);
+          });
+        m_pcap = std::make_unique<PCAPFile>(filename, linkType);
+        break;
+      }
+      case PCAPOutput::Pipe:
+      {
+        std::filesystem::path pipe;
+#ifdef WIN32
+        return; //! \todo Implement
+#else // unix
+        pipe = std::filesystem::temp_directory_path() / "traintastic-server" / logId;
+#endif
+        EventLoop::call(
+          [this, pipe]()
+          {
+            Log::log(logId, LogMessage::N2005_STARTING_PCAP_LOG_PIPE_X, pipe);
+          });
+        m_pcap = std::make_unique<PCAPPipe>(std::move(pipe), linkType);
+        break;
+      }
+    }
+  }
+  catch(const std::exception& e)
+  {
+    EventLoop::call(
+      [this, what=std::string(e.what())]()
+      {
+        Log::log(logId, LogMessage::E2021_STARTING_PCAP_LOG_FAILED_X, what);
+      });
+  }
+}
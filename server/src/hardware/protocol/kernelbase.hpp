@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2023-2024 Reinder Feenstra
+ * Copyright (C) 2023-2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -25,18 +25,25 @@
 
 #include <string>
 #include <functional>
+#include <memory>
 #include <thread>
 #include <boost/asio/io_context.hpp>
+#include <traintastic/enum/pcapoutput.hpp>
+#include "../../pcap/pcap.hpp"
+#include "kerneleventqueue.hpp"
 
 class KernelBase
 {
   private:
     std::function<void()> m_onStarted;
     std::function<void()> m_onError;
+    PCAPOutput m_pcapOutput = PCAPOutput::File;
 
   protected:
     boost::asio::io_context m_ioContext;
     std::thread m_thread;
+    std::unique_ptr<PCAP> m_pcap;
+    KernelEventQueue m_events; //!< input and output changes for the event loop
 
 #ifndef NDEBUG
     bool m_started = false;
@@ -46,6 +53,28 @@ class KernelBase
 
     virtual void started();
 
+    /**
+     * \brief Start, restart or stop the PCAP capture
+     *
+     * The capture is only restarted if the output changed.
+     *
+     * \param[in] enabled \c true to capture, \c false to stop capturing
+     * \param[in] output Capture output
+     * \param[in] linkType PCAP link type of the captured messages, see ::PCAPLinkType
+     * \note This function must run in the kernel's IO context
+     */
+    void setPCAP(bool enabled, PCAPOutput output, uint32_t linkType);
+
+    /**
+     * \brief Write a message to the PCAP capture, if capturing
+     * \note This function must run in the kernel's IO context
+     */
+    inline void writePCAP(const void* data, size_t size)
+    {
+      if(m_pcap)
+        m_pcap->writeRecord(data, static_cast<uint32_t>(size));
+    }
+
   public:
     virtual ~KernelBase() = default;
 
@@ -61,6 +90,23 @@ class KernelBase
       return m_ioContext;
     }
 
+    /**
+     * \brief Statistics of the batched input and output change delivery
+     * \note This function must run in the event loop thread.
+     */
+    const KernelEventQueue::Statistics& eventQueueStatistics() const
+    {
+      return m_events.statistics();
+    }
+
+    /**
+     * \brief Register event queue statistics handler
+     *
+     * \param[in] callback Handler to call in the event loop after each delivered batch.
+     * \note This function may not be called when the kernel is running.
+     */
+    void setOnEventQueueStatistics(KernelEventQueue::OnStatistics callback);
+
     /**
      * \brief ...
      *
@@ -0,0 +1,94 @@
+/**
+ * server/src/hardware/protocol/kerneleventqueue.cpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "kerneleventqueue.hpp"
+#include <algorithm>
+#include <cassert>
+#include "../input/inputcontroller.hpp"
+#include "../output/outputcontroller.hpp"
+#include "../../core/eventloop.hpp"
+
+void KernelEventQueue::push(const Event& event)
+{
+  bool post;
+  {
+    std::lock_guard lock(m_mutex);
+    m_pending.push_back(event);
+    post = !m_drainPending;
+    m_drainPending = true;
+  }
+
+  if(post)
+  {
+    EventLoop::call(
+      [this]()
+      {
+        drain();
+      });
+  }
+}
+
+void KernelEventQueue::drain()
+{
+  assert(isEventLoopThread());
+
+  {
+    std::lock_guard lock(m_mutex);
+    std::swap(m_pending, m_batch); // the producer continues with the previous batch buffer, no reallocation once warmed up
+    m_drainPending = false;
+  }
+
+  const uint32_t batchSize = static_cast<uint32_t>(m_batch.size());
+  m_statistics.batches++;
+  m_statistics.lastBatchSize = batchSize;
+  m_statistics.maxBatchSize = std::max(m_statistics.maxBatchSize, batchSize);
+
+  m_batchValues.clear();
+  for(const auto& event : m_batch)
+  {
+    if(auto [it, inserted] = m_batchValues.try_emplace(event.key(), event.value); !inserted)
+    {
+      if(it->second == event.value)
+      {
+        m_statistics.duplicates++;
+        continue;
+      }
+      it->second = event.value;
+    }
+
+    switch(event.type)
+    {
+      case Event::Type::Input:
+        event.inputController->updateInputValue(static_cast<InputChannel>(event.channel), event.address, std::get<TriState>(event.value));
+        break;
+
+      case Event::Type::Output:
+        event.outputController->updateOutputValue(static_cast<OutputChannel>(event.channel), event.address, event.value);
+        break;
+    }
+    m_statistics.events++;
+  }
+  m_batch.clear();
+
+  if(m_onStatistics)
+    m_onStatistics(m_statistics);
+}
@@ -0,0 +1,148 @@
+/**
+ * server/src/hardware/protocol/kerneleventqueue.hpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TRAINTASTIC_SERVER_HARDWARE_PROTOCOL_KERNELEVENTQUEUE_HPP
+#define TRAINTASTIC_SERVER_HARDWARE_PROTOCOL_KERNELEVENTQUEUE_HPP
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+#include <traintastic/enum/inputchannel.hpp>
+#include <traintastic/enum/outputchannel.hpp>
+#include "../output/outputvalue.hpp"
+
+class InputController;
+class OutputController;
+
+/**
+ * \brief Batched delivery of input and output changes from a kernel to the event loop
+ *
+ * The kernel thread pushes plain event records, the event loop drains all
+ * records queued since its previous wake-up in a single handler. So a
+ * feedback burst results in a few event loop posts instead of one per
+ * input. Within a batch an event is dropped if it repeats the state of the
+ * previous event for the same channel and address, state transitions are
+ * always delivered in order.
+ */
+class KernelEventQueue
+{
+  public:
+    struct Event
+    {
+      enum class Type : uint8_t
+      {
+        Input,
+        Output,
+      };
+
+      Type type;
+      uint16_t channel; //!< ::InputChannel or ::OutputChannel
+      uint32_t address;
+      OutputValue value; //!< \c TriState for inputs
+      union
+      {
+        InputController* inputController;
+        OutputController* outputController;
+      };
+
+      inline uint64_t key() const
+      {
+        return (static_cast<uint64_t>(type) << 48) | (static_cast<uint64_t>(channel) << 32) | address;
+      }
+    };
+    static_assert(std::is_trivially_copyable_v<Event>);
+
+    struct Statistics
+    {
+      uint64_t batches = 0; //!< number of drained batches
+      uint64_t events = 0; //!< number of delivered events
+      uint64_t duplicates = 0; //!< number of dropped events, repeating the previous state within a batch
+      uint32_t lastBatchSize = 0; //!< number of events in the last batch, including duplicates
+      uint32_t maxBatchSize = 0; //!< largest batch, including duplicates
+    };
+
+    using OnStatistics = std::function<void(const Statistics&)>;
+
+  private:
+    std::mutex m_mutex;
+    std::vector<Event> m_pending; //!< guarded by m_mutex
+    bool m_drainPending = false; //!< guarded by m_mutex
+
+    // event loop only:
+    std::vector<Event> m_batch;
+    std::unordered_map<uint64_t, OutputValue> m_batchValues;
+    Statistics m_statistics;
+    OnStatistics m_onStatistics;
+
+    void push(const Event& event);
+    void drain();
+
+  public:
+    KernelEventQueue() = default;
+    KernelEventQueue(const KernelEventQueue&) = delete;
+    KernelEventQueue& operator =(const KernelEventQueue&) = delete;
+
+    /**
+     * \brief Queue an input value change
+     * \note This function must run in the kernel's IO context
+     */
+    inline void pushInput(InputController& controller, InputChannel channel, uint32_t address, TriState value)
+    {
+      Event event{Event::Type::Input, static_cast<uint16_t>(channel), address, value, {}};
+      event.inputController = &controller;
+      push(event);
+    }
+
+    /**
+     * \brief Queue an output value change
+     * \note This function must run in the kernel's IO context
+     */
+    inline void pushOutput(OutputController& controller, OutputChannel channel, uint32_t id, OutputValue value)
+    {
+      Event event{Event::Type::Output, static_cast<uint16_t>(channel), id, value, {}};
+      event.outputController = &controller;
+      push(event);
+    }
+
+    /**
+     * \brief Batch statistics
+     * \note This function must run in the event loop thread.
+     */
+    inline const Statistics& statistics() const
+    {
+      return m_statistics;
+    }
+
+    /**
+     * \brief Set handler called with the updated statistics after each batch
+     * \note This function must run in the event loop thread.
+     */
+    inline void setOnStatistics(OnStatistics callback)
+    {
+      m_onStatistics = std::move(callback);
+    }
+};
+
+#endif
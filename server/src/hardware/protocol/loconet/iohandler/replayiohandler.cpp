@@ -0,0 +1,47 @@
+/**
+ * server/src/hardware/protocol/loconet/iohandler/replayiohandler.cpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "replayiohandler.hpp"
+#include "../kernel.hpp"
+#include "../messages.hpp"
+
+namespace LocoNet {
+
+ReplayIOHandler::ReplayIOHandler(Kernel& kernel, const std::filesystem::path& filename, double speed, std::function<void()> onFinished)
+  : PCAPReplayIOHandler(kernel, filename, PCAPLinkType::LocoNet, speed, std::move(onFinished))
+{
+}
+
+void ReplayIOHandler::receive(const std::byte* data, size_t size)
+{
+  const auto& message = *reinterpret_cast<const Message*>(data);
+  if(size >= 2 && message.size() == size && isValid(message))
+    m_kernel.receive(message);
+}
+
+void ReplayIOHandler::start()
+{
+  PCAPReplayIOHandler::start();
+  started();
+}
+
+}
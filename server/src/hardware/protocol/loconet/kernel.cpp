@@ -31,17 +31,13 @@
 #include "../../input/inputcontroller.hpp"
 #include "../../output/outputcontroller.hpp"
 #include "../../identification/identificationcontroller.hpp"
-#include "../../../utils/datetimestr.hpp"
 #include "../../../utils/setthreadname.hpp"
 #include "../../../utils/inrange.hpp"
-#include "../../../pcap/pcapfile.hpp"
-#include "../../../pcap/pcappipe.hpp"
 #include "../../../core/eventloop.hpp"
 #include "../../../core/objectproperty.tpp"
 #include "../../../log/log.hpp"
 #include "../../../log/logmessageexception.hpp"
 #include "../../../clock/clock.hpp"
-#include "../../../traintastic/traintastic.hpp"
 #include "../dcc/dcc.hpp"
 #include "../dcc/messages.hpp"
 
@@ -76,12 +72,12 @@ Kernel::Kernel(std::string logId_, const Config& config, bool simulation)
   , m_waitingForEchoTimer{m_ioContext}
   , m_waitingForResponse{false}
   , m_waitingForResponseTimer{m_ioContext}
+  , m_sendQueueStatisticsTimer{m_ioContext}
   , m_fastClockSyncTimer(m_ioContext)
   , m_decoderController{nullptr}
   , m_inputController{nullptr}
   , m_outputController{nullptr}
   , m_identificationController{nullptr}
-  , m_debugDir{Traintastic::instance->debugDir()}
   , m_config{config}
 {
   assert(isEventLoopThread());
@@ -107,18 +103,7 @@ void Kernel::setConfig(const Config& config)
   m_ioContext.post(
     [this, newConfig=config]()
     {
-      if(newConfig.pcap != m_config.pcap)
-      {
-        if(newConfig.pcap)
-          startPCAP(newConfig.pcapOutput);
-        else
-          m_pcap.reset();
-      }
-      else if(newConfig.pcap && newConfig.pcapOutput != m_config.pcapOutput)
-      {
-        m_pcap.reset();
-        startPCAP(newConfig.pcapOutput);
-      }
+      setPCAP(newConfig.pcap, newConfig.pcapOutput, PCAPLinkType::LocoNet);
 
       if(newConfig.listenOnly && !m_config.listenOnly)
       {
@@ -169,6 +154,13 @@ void Kernel::setOnStateChanged(std::function<void(bool, bool)> callback)
   m_onStateChanged = std::move(callback);
 }
 
+void Kernel::setOnSendQueueStatistics(OnSendQueueStatistics callback)
+{
+  assert(isEventLoopThread());
+  assert(!m_started);
+  m_onSendQueueStatistics = std::move(callback);
+}
+
 void Kernel::setClock(std::shared_ptr<Clock> clock)
 {
   assert(isEventLoopThread());
@@ -238,8 +230,7 @@ void Kernel::start()
   m_ioContext.post(
     [this]()
     {
-      if(m_config.pcap)
-        startPCAP(m_config.pcapOutput);
+      setPCAP(m_config.pcap, m_config.pcapOutput, PCAPLinkType::LocoNet);
 
       try
       {
@@ -273,6 +264,7 @@ void Kernel::stop()
     {
       m_waitingForEchoTimer.cancel();
       m_waitingForResponseTimer.cancel();
+      m_sendQueueStatisticsTimer.cancel();
       m_fastClockSyncTimer.cancel();
       m_ioHandler->stop();
       m_pcap.reset();
@@ -297,6 +289,9 @@ void Kernel::started()
   if(m_config.fastClockSyncEnabled)
     startFastClockSyncTimer();
 
+  if(m_onSendQueueStatistics)
+    startSendQueueStatisticsTimer();
+
   for(uint8_t slot = SLOT_LOCO_MIN; slot <= m_config.locomotiveSlots; slot++)
     send(RequestSlotData(slot), LowPriority);
 
@@ -308,8 +303,7 @@ void Kernel::receive(const Message& message)
   assert(isKernelThread());
   assert(isValid(message)); // only valid messages should be received
 
-  if(m_pcap)
-    m_pcap->writeRecord(&message, message.size());
+  writePCAP(&message, message.size());
 
   if(m_config.debugLogRXTX)
     EventLoop::call([this, msg=toString(message)](){ Log::log(logId, LogMessage::D2002_RX_X, msg); });
@@ -486,11 +480,7 @@ void Kernel::receive(const Message& message)
 
             m_inputValues[inputRep.fullAddress()] = value;
 
-            EventLoop::call(
-              [this, address=1 + inputRep.fullAddress(), value]()
-              {
-                m_inputController->updateInputValue(InputChannel::Input, address, value);
-              });
+            m_events.pushInput(*m_inputController, InputChannel::Input, 1 + inputRep.fullAddress(), value);
           }
         }
       }
@@ -507,11 +497,7 @@ void Kernel::receive(const Message& message)
           {
             m_outputValues[switchRequest.address() - accessoryOutputAddressMin] = value;
 
-            EventLoop::call(
-              [this, address=switchRequest.address(), value]()
-              {
-                m_outputController->updateOutputValue(OutputChannel::Accessory, address, value);
-              });
+            m_events.pushOutput(*m_outputController, OutputChannel::Accessory, switchRequest.address(), value);
           }
         }
       }
@@ -1441,6 +1427,9 @@ void Kernel::send(const Message& message, Priority priority)
     return;
   }
 
+  const uint32_t depth = m_sendQueue[HighPriority].size() + m_sendQueue[NormalPriority].size() + m_sendQueue[LowPriority].size();
+  m_sendQueueStatistics.depthMax = std::max(m_sendQueueStatistics.depthMax, depth);
+
   if(!m_waitingForEcho && !m_waitingForResponse)
     sendNextMessage();
 }
@@ -1492,6 +1481,7 @@ void Kernel::sendNextMessage()
       if(m_ioHandler->send(message))
       {
         m_sentMessagePriority = priority;
+        m_sendQueue[priority].setFrontSent();
 
         m_waitingForEcho = true;
         m_waitingForEchoTimer.expires_after(boost::asio::chrono::milliseconds(m_config.echoTimeout));
@@ -1534,6 +1524,47 @@ void Kernel::waitingForEchoTimerExpired(const boost::system::error_code& ec)
     });
 }
 
+void Kernel::startSendQueueStatisticsTimer()
+{
+  assert(isKernelThread());
+  m_sendQueueStatisticsTimer.expires_after(sendQueueStatisticsInterval);
+  m_sendQueueStatisticsTimer.async_wait(std::bind(&Kernel::sendQueueStatisticsTimerExpired, this, std::placeholders::_1));
+}
+
+void Kernel::sendQueueStatisticsTimerExpired(const boost::system::error_code& ec)
+{
+  assert(isKernelThread());
+
+  if(ec)
+    return;
+
+  SendQueueStatistics statistics;
+  std::chrono::steady_clock::duration latencySum{};
+  uint32_t latencyCount = 0;
+  for(auto& queue : m_sendQueue)
+  {
+    statistics.depth += queue.size();
+    statistics.superseded += queue.superseded();
+    queue.takeLatency(latencySum, latencyCount);
+  }
+  statistics.depthMax = std::max(m_sendQueueStatistics.depthMax, statistics.depth);
+  if(latencyCount != 0)
+    statistics.latency = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(latencySum / latencyCount).count());
+
+  if(statistics != m_sendQueueStatistics)
+  {
+    EventLoop::call(
+      [this, statistics]()
+      {
+        m_onSendQueueStatistics(statistics);
+      });
+  }
+  m_sendQueueStatistics = statistics;
+  m_sendQueueStatistics.depthMax = statistics.depth; // start a new interval
+
+  startSendQueueStatisticsTimer();
+}
+
 void Kernel::waitingForResponseTimerExpired(const boost::system::error_code& ec)
 {
   assert(isKernelThread());
@@ -1685,65 +1716,86 @@ bool Kernel::updateFunctions(LocoSlot& slot, const T& message)
   return changed;
 }
 
-void Kernel::startPCAP(PCAPOutput pcapOutput)
+//! \brief Key of messages that replace each other, zero if the message can't be replaced
+static uint16_t supersedeKey(const Message& message)
 {
-  assert(isKernelThread());
-  assert(!m_pcap);
-
-  const uint32_t DLT_USER0 = 147; //! \todo change to LocoNet DLT once it is registered
-
-  try
+  switch(message.opCode)
   {
-    switch(pcapOutput)
-    {
-      case PCAPOutput::File:
-      {
-        const auto filename = m_debugDir / logId += dateTimeStr() += ".pcap";
-        EventLoop::call(
-          [this, filename]()
-          {
-            Log::log(logId, LogMessage::N2004_STARTING_PCAP_FILE_LOG_X, filename);
-          });
-        m_pcap = std::make_unique<PCAPFile>(filename, DLT_USER0);
-        break;
-      }
-      case PCAPOutput::Pipe:
-      {
-        std::filesystem::path pipe;
-#ifdef WIN32
-        return; //! \todo Implement
-#else // unix
-        pipe = std::filesystem::temp_directory_path() / "traintastic-server" / logId;
-#endif
-        EventLoop::call(
-          [this, pipe]()
-          {
-            Log::log(logId, LogMessage::N2005_STARTING_PCAP_LOG_PIPE_X, pipe);
-          });
-        m_pcap = std::make_unique<PCAPPipe>(std::move(pipe), DLT_USER0);
-        break;
-      }
-    }
+    case OPC_LOCO_SPD:
+    case OPC_LOCO_DIRF:
+    case OPC_LOCO_SND:
+    case OPC_LOCO_F9F12:
+      return static_cast<uint16_t>((message.opCode << 8) | static_cast<const SlotMessage&>(message).slot);
+
+    default:
+      return 0;
   }
-  catch(const std::exception& e)
+}
+
+//! \brief Check if a message addresses a slot, messages for the same slot must stay in order
+static bool refersToSlot(const Message& message, uint8_t slot)
+{
+  const auto* bytes = reinterpret_cast<const uint8_t*>(&message);
+  switch(message.opCode)
   {
-    EventLoop::call(
-      [this, what=std::string(e.what())]()
-      {
-        Log::log(logId, LogMessage::E2021_STARTING_PCAP_LOG_FAILED_X, what);
-      });
+    case OPC_LOCO_SPD:
+    case OPC_LOCO_DIRF:
+    case OPC_LOCO_SND:
+    case OPC_LOCO_F9F12:
+    case OPC_SLOT_STAT1:
+    case OPC_RQ_SL_DATA:
+      return bytes[1] == slot;
+
+    case OPC_MOVE_SLOTS:
+    case OPC_LINK_SLOTS:
+    case OPC_UNLINK_SLOTS:
+      return bytes[1] == slot || bytes[2] == slot;
+
+    case OPC_WR_SL_DATA:
+      return bytes[2] == slot;
+
+    default:
+      return false;
   }
 }
 
-
 bool Kernel::SendQueue::append(const Message& message)
 {
   const uint8_t messageSize = message.size();
+
+  if(const uint16_t key = supersedeKey(message); key != 0)
+  {
+    // only the last queued message for the slot may be replaced, else the order of changes is lost,
+    // e.g. stop, reverse, go would become go (in the old direction), reverse:
+    const uint8_t slot = static_cast<const SlotMessage&>(message).slot;
+    std::byte* last = nullptr;
+    std::byte* p = m_front;
+    std::byte* const end = m_front + m_bytes;
+    if(m_frontSent && p != end)
+      p += reinterpret_cast<const Message*>(p)->size();
+    while(p != end)
+    {
+      const auto& queued = *reinterpret_cast<const Message*>(p);
+      if(refersToSlot(queued, slot))
+        last = p;
+      p += queued.size();
+    }
+
+    if(last && supersedeKey(*reinterpret_cast<const Message*>(last)) == key)
+    {
+      assert(reinterpret_cast<const Message*>(last)->size() == messageSize);
+      memcpy(last, &message, messageSize);
+      m_superseded++;
+      return true;
+    }
+  }
+
   if(m_bytes + messageSize > threshold())
     return false;
 
   memcpy(m_front + m_bytes, &message, messageSize);
   m_bytes += messageSize;
+  m_queuedAt.emplace_back(std::chrono::steady_clock::now());
 
   return true;
 }
@@ -1753,6 +1805,14 @@ void Kernel::SendQueue::pop()
   const uint8_t messageSize = front().size();
   m_front += messageSize;
   m_bytes -= messageSize;
+  m_frontSent = false;
+
+  if(!m_queuedAt.empty()) [[likely]]
+  {
+    m_latencySum += std::chrono::steady_clock::now() - m_queuedAt.front();
+    m_latencyCount++;
+    m_queuedAt.pop_front();
+  }
 
   if(static_cast<std::size_t>(m_front - m_buffer.data()) >= threshold())
   {
@@ -1764,6 +1824,16 @@ void Kernel::SendQueue::pop()
 void Kernel::SendQueue::clear()
 {
   m_bytes = 0;
+  m_frontSent = false;
+  m_queuedAt.clear();
+}
+
+void Kernel::SendQueue::takeLatency(std::chrono::steady_clock::duration& sum, uint32_t& count)
+{
+  sum += m_latencySum;
+  count += m_latencyCount;
+  m_latencySum = {};
+  m_latencyCount = 0;
 }
 
 }
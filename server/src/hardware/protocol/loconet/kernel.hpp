@@ -25,8 +25,9 @@
 
 #include "../kernelbase.hpp"
 #include <array>
+#include <chrono>
+#include <deque>
 #include <unordered_map>
-#include <filesystem>
 #include <queue>
 #include <boost/asio/steady_timer.hpp>
 #include <boost/signals2/connection.hpp>
@@ -46,7 +47,6 @@ enum class SimulateInputAction;
 class InputController;
 class OutputController;
 class IdentificationController;
-class PCAP;
 
 namespace LocoNet {
 
@@ -60,7 +60,21 @@ class Kernel : public ::KernelBase
     static constexpr uint16_t accessoryOutputAddressMin = 1;
     static constexpr uint16_t accessoryOutputAddressMax = 2048;
 
+    struct SendQueueStatistics
+    {
+      uint32_t depth = 0; //!< number of queued messages
+      uint32_t depthMax = 0; //!< maximum number of queued messages since the previous report
+      uint32_t latency = 0; //!< average time from queued until sent and acknowledged in ms since the previous report
+      uint32_t superseded = 0; //!< total number of queued messages replaced by a newer one
+
+      bool operator ==(const SendQueueStatistics&) const = default;
+    };
+
+    using OnSendQueueStatistics = std::function<void(const SendQueueStatistics&)>;
+
   private:
+    static constexpr auto sendQueueStatisticsInterval = std::chrono::seconds(1);
+
     enum Priority
     {
       HighPriority = 0,
@@ -69,12 +83,26 @@ class Kernel : public ::KernelBase
     };
     friend constexpr Priority& operator ++(Priority& value);
 
+    /**
+     * \brief Queue of messages to send
+     *
+     * Speed, direction and function messages for a slot contain the complete
+     * state, a newer one replaces a queued one for the same slot in place if
+     * that is the last queued message for the slot. It keeps the position of
+     * the queued one, so a quickly changing throttle doesn't fill the queue
+     * with outdated messages.
+     */
     class SendQueue
     {
       private:
         std::array<std::byte, 4000> m_buffer;
         std::byte* m_front;
         std::size_t m_bytes;
+        bool m_frontSent = false; //!< front message is being sent, it must not be replaced
+        std::deque<std::chrono::steady_clock::time_point> m_queuedAt; //!< one per queued message
+        uint32_t m_superseded = 0;
+        std::chrono::steady_clock::duration m_latencySum{};
+        uint32_t m_latencyCount = 0;
 
         constexpr std::size_t threshold() const noexcept { return m_buffer.size() / 2; }
 
@@ -96,11 +124,29 @@ class Kernel : public ::KernelBase
           return *reinterpret_cast<const Message*>(m_front);
         }
 
+        inline uint32_t size() const
+        {
+          return static_cast<uint32_t>(m_queuedAt.size());
+        }
+
+        inline uint32_t superseded() const
+        {
+          return m_superseded;
+        }
+
+        inline void setFrontSent()
+        {
+          m_frontSent = true;
+        }
+
         bool append(const Message& message);
 
         void pop();
 
         void clear();
+
+        //! \brief Add the latency of the messages popped since the previous call
+        void takeLatency(std::chrono::steady_clock::duration& sum, uint32_t& count);
     };
 
     struct LocoSlot
@@ -165,6 +211,9 @@ class Kernel : public ::KernelBase
       }
     } m_pendingLNCVRead;
     boost::asio::steady_timer m_waitingForResponseTimer;
+    boost::asio::steady_timer m_sendQueueStatisticsTimer;
+    SendQueueStatistics m_sendQueueStatistics;
+    OnSendQueueStatistics m_onSendQueueStatistics;
 
     TriState m_globalPower;
     TriState m_emergencyStop;
@@ -203,9 +252,6 @@ class Kernel : public ::KernelBase
 
     IdentificationController* m_identificationController;
 
-    const std::filesystem::path m_debugDir;
-    std::unique_ptr<PCAP> m_pcap;
-
     Config m_config;
 
     Kernel(std::string logId_, const Config& config, bool simulation);
@@ -265,6 +311,8 @@ class Kernel : public ::KernelBase
     void sendNextMessage();
 
     void waitingForEchoTimerExpired(const boost::system::error_code& ec);
+    void startSendQueueStatisticsTimer();
+    void sendQueueStatisticsTimerExpired(const boost::system::error_code& ec);
     void waitingForResponseTimerExpired(const boost::system::error_code& ec);
 
     void setFastClockMaster(bool enable);
@@ -278,8 +326,6 @@ class Kernel : public ::KernelBase
     template<uint8_t First, uint8_t Last, class T>
     bool updateFunctions(LocoSlot& slot, const T& message);
 
-    void startPCAP(PCAPOutput pcapOutput);
-
   public:
     static constexpr uint16_t inputAddressMin = 1;
     static constexpr uint16_t inputAddressMax = 4096;
@@ -341,6 +387,16 @@ class Kernel : public ::KernelBase
      */
     void setOnStateChanged(std::function<void(bool, bool)> callback);
 
+    /**
+     * @brief Set send queue statistics callback
+     *
+     * The callback is called in the event loop, at most once per second and only if the statistics changed.
+     *
+     * @param[in] callback The callback
+     * @note This function may not be called when the kernel is running.
+     */
+    void setOnSendQueueStatistics(OnSendQueueStatistics callback);
+
     /**
      * @brief Set clock for LocoNet fast clock
      *
@@ -458,6 +514,10 @@ class Kernel : public ::KernelBase
     void lncvWrite(uint16_t lncv, uint16_t value);
     void lncvStop();
     void setOnLNCVReadResponse(OnLNCVReadResponse callback);
+
+#ifdef TRAINTASTIC_TEST
+    using TestSendQueue = SendQueue;
+#endif
 };
 
 }
@@ -23,6 +23,8 @@
 #ifndef TRAINTASTIC_SERVER_HARDWARE_PROTOCOL_MARKLINCAN_CONFIG_HPP
 #define TRAINTASTIC_SERVER_HARDWARE_PROTOCOL_MARKLINCAN_CONFIG_HPP
 
+#include <traintastic/enum/pcapoutput.hpp>
+
 namespace MarklinCAN {
 
 struct Config
@@ -33,6 +35,8 @@ struct Config
   bool debugLogRXTX;
   bool debugStatusDataConfig;
   bool debugConfigStream;
+  bool pcap;
+  PCAPOutput pcapOutput;
 };
 
 }
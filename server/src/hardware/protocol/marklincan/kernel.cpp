@@ -82,6 +82,8 @@ void Kernel::setConfig(const Config& config)
   m_ioContext.post(
     [this, newConfig=config]()
     {
+      setPCAP(newConfig.pcap, newConfig.pcapOutput, PCAPLinkType::MarklinCAN);
+
       if(m_config.defaultSwitchTime != newConfig.defaultSwitchTime)
         send(AccessorySwitchTime(newConfig.defaultSwitchTime / 10));
 
@@ -146,6 +148,8 @@ void Kernel::start()
   m_ioContext.post(
     [this]()
     {
+      setPCAP(m_config.pcap, m_config.pcapOutput, PCAPLinkType::MarklinCAN);
+
       try
       {
         m_ioHandler->start();
@@ -174,6 +178,7 @@ void Kernel::stop()
     [this]()
     {
       m_ioHandler->stop();
+      m_pcap.reset();
     });
 
   m_ioContext.stop();
@@ -210,6 +215,12 @@ void Kernel::receive(const Message& message)
 {
   assert(isKernelThread());
 
+  if(m_pcap)
+  {
+    const PCAPFrame frame(message);
+    m_pcap->writeRecord(&frame, sizeof(frame));
+  }
+
   if(m_config.debugLogRXTX)
     EventLoop::call([this, msg=toString(message)](){ Log::log(logId, LogMessage::D2002_RX_X, msg); });
 
@@ -236,7 +247,7 @@ void Kernel::receive(const Message& message)
               EventLoop::call(
                 [this, protocol=proto, address=addr]()
                 {
-                  if(const auto& decoder = m_decoderController->getDecoder(protocol, address))
+                  if(const auto& decoder = getDecoder(protocol, address))
                     decoder->emergencyStop.setValueInternal(true);
                 });
             }
@@ -278,7 +289,7 @@ void Kernel::receive(const Message& message)
             EventLoop::call(
               [this, protocol=proto, address=addr, throttle=Decoder::speedStepToThrottle(locomotiveSpeed.speed(), LocomotiveSpeed::speedMax)]()
               {
-                if(const auto& decoder = m_decoderController->getDecoder(protocol, address))
+                if(const auto& decoder = getDecoder(protocol, address))
                 {
                   decoder->emergencyStop.setValueInternal(false);
                   decoder->throttle.setValueInternal(throttle);
@@ -317,7 +328,7 @@ void Kernel::receive(const Message& message)
             EventLoop::call(
               [this, protocol=proto, address=addr, direction]()
               {
-                if(const auto& decoder = m_decoderController->getDecoder(protocol, address))
+                if(const auto& decoder = getDecoder(protocol, address))
                   decoder->direction.setValueInternal(direction);
               });
           }
@@ -337,7 +348,7 @@ void Kernel::receive(const Message& message)
             EventLoop::call(
               [this, protocol=proto, address=addr, number=locomotiveFunction.number(), value=locomotiveFunction.isOn()]()
               {
-                if(const auto& decoder = m_decoderController->getDecoder(protocol, address))
+                if(const auto& decoder = getDecoder(protocol, address))
                   decoder->setFunctionValue(number, value);
               });
           }
@@ -383,11 +394,7 @@ void Kernel::receive(const Message& message)
           break;
         }
 
-        EventLoop::call(
-          [this, channel, address, value]()
-          {
-            m_outputController->updateOutputValue(channel, address, value);
-          });
+        m_events.pushOutput(*m_outputController, channel, address, value);
       }
       break;
 
@@ -410,11 +417,7 @@ void Kernel::receive(const Message& message)
             {
               m_inputValues[feedbackState.contactId() - s88AddressMin] = value;
 
-              EventLoop::call(
-                [this, address=feedbackState.contactId(), value]()
-                {
-                  m_inputController->updateInputValue(InputChannel::Input, address, value);
-                });
+              m_events.pushInput(*m_inputController, InputChannel::Input, feedbackState.contactId(), value);
             }
           }
         }
@@ -786,10 +789,15 @@ void Kernel::receiveConfigData(std::unique_ptr<ConfigDataStreamCollector> config
       EventLoop::call(
         [this, list=std::make_shared<LocomotiveList>(locList)]()
         {
-          // update MFX UID to SID list:
+          // update MFX UID to SID lists:
           m_mfxUIDtoSID.clear();
+          m_mfxSIDtoUID.clear();
           for(const auto& item : *list)
+          {
             m_mfxUIDtoSID.emplace(item.mfxUID, item.sid);
+            if(item.protocol == DecoderProtocol::MFX)
+              m_mfxSIDtoUID.emplace(item.sid, item.mfxUID);
+          }
 
           if(m_onLocomotiveListChanged) /*[[likely]]*/
             m_onLocomotiveListChanged(list);
@@ -932,6 +940,20 @@ void Kernel::nodeChanged(const Node& node)
   }
 }
 
+const std::shared_ptr<Decoder>& Kernel::getDecoder(DecoderProtocol protocol, uint16_t address) const
+{
+  assert(isEventLoopThread());
+
+  if(protocol == DecoderProtocol::MFX)
+  {
+    if(auto it = m_mfxSIDtoUID.find(address); it != m_mfxSIDtoUID.end())
+      return m_decoderController->getDecoderMFX(it->second);
+    return Decoder::null;
+  }
+
+  return m_decoderController->getDecoder(protocol, address);
+}
+
 void Kernel::changeState(State value)
 {
   assert(isKernelThread());
@@ -44,6 +44,7 @@
 class Decoder;
 enum class DecoderChangeFlags;
 class DecoderController;
+enum class DecoderProtocol : uint8_t;
 class InputController;
 class OutputController;
 
@@ -100,6 +101,7 @@ class Kernel : public ::KernelBase
 
     DecoderController* m_decoderController = nullptr;
     std::map<uint32_t, uint16_t> m_mfxUIDtoSID;
+    std::map<uint16_t, uint32_t> m_mfxSIDtoUID;
 
     InputController* m_inputController = nullptr;
     std::array<TriState, s88AddressMax - s88AddressMin + 1> m_inputValues;
@@ -129,6 +131,10 @@ class Kernel : public ::KernelBase
 
     void nodeChanged(const Node& node);
 
+    //! \brief Get decoder by protocol and address, for MFX the address is the SID
+    //! \note This function must run in the event loop thread.
+    const std::shared_ptr<Decoder>& getDecoder(DecoderProtocol protocol, uint16_t address) const;
+
     void changeState(State value);
     inline void nextState()
     {
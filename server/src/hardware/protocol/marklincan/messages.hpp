@@ -23,6 +23,7 @@
 #ifndef TRAINTASTIC_SERVER_HARDWARE_PROTOCOL_MARKLINCAN_MESSAGES_HPP
 #define TRAINTASTIC_SERVER_HARDWARE_PROTOCOL_MARKLINCAN_MESSAGES_HPP
 
+#include <algorithm>
 #include <cstdint>
 #include <cassert>
 #include <cstring>
@@ -30,6 +31,7 @@
 #include <initializer_list>
 #include "../../../utils/byte.hpp"
 #include "../../../utils/endian.hpp"
+#include "../../../utils/packed.hpp"
 
 namespace MarklinCAN {
 
@@ -773,6 +775,38 @@ struct BootloaderCAN : Message
   }
 };
 
+/**
+ * \brief CAN frame as stored in a PCAP capture, see LINKTYPE_CAN_SOCKETCAN
+ */
+PRAGMA_PACK_PUSH_1
+struct PCAPFrame
+{
+  static constexpr uint32_t extendedFrameFormat = 0x80000000;
+
+  uint32_t idBE; //!< CAN id and flags, big endian
+  uint8_t dlc;
+  uint8_t reserved[3] = {0, 0, 0};
+  uint8_t data[8];
+
+  explicit PCAPFrame(const Message& message)
+    : idBE{host_to_be(extendedFrameFormat | message.id)}
+    , dlc{message.dlc}
+  {
+    std::memcpy(data, message.data, sizeof(data));
+  }
+
+  Message toMessage() const
+  {
+    Message message;
+    message.id = be_to_host(idBE) & ~extendedFrameFormat;
+    message.dlc = std::min<uint8_t>(dlc, sizeof(message.data));
+    std::memcpy(message.data, data, sizeof(message.data));
+    return message;
+  }
+} ATTRIBUTE_PACKED;
+PRAGMA_PACK_POP
+static_assert(sizeof(PCAPFrame) == 16);
+
 std::string_view toString(MarklinCAN::DeviceId value);
 
 }
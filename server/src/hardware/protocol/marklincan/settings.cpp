@@ -36,6 +36,12 @@ Settings::Settings(Object& _parent, std::string_view parentPropertyName)
   , debugLogRXTX{this, "debug_log_rx_tx", false, PropertyFlags::ReadWrite | PropertyFlags::Store}
   , debugStatusDataConfig{this, "debug_status_data_config", false, PropertyFlags::ReadWrite | PropertyFlags::Store}
   , debugConfigStream{this, "debug_config_stream", false, PropertyFlags::ReadWrite | PropertyFlags::Store}
+  , pcap{this, "pcap", false, PropertyFlags::ReadWrite | PropertyFlags::Store,
+      [this](bool value)
+      {
+        Attributes::setEnabled(pcapOutput, value);
+      }}
+  , pcapOutput{this, "pcap_output", PCAPOutput::File, PropertyFlags::ReadWrite | PropertyFlags::Store}
 {
   Attributes::addMinMax<uint32_t>(defaultSwitchTime, 0, 163'000);
   //Attributes::addStep(defaultSwitchTime, 10);
@@ -52,6 +58,14 @@ Settings::Settings(Object& _parent, std::string_view parentPropertyName)
   m_interfaceItems.add(debugStatusDataConfig);
 
   m_interfaceItems.add(debugConfigStream);
+
+  Attributes::addDisplayName(pcap, DisplayName::Hardware::pcap);
+  m_interfaceItems.add(pcap);
+
+  Attributes::addDisplayName(pcapOutput, DisplayName::Hardware::pcapOutput);
+  Attributes::addEnabled(pcapOutput, pcap);
+  Attributes::addValues(pcapOutput, pcapOutputValues);
+  m_interfaceItems.add(pcapOutput);
 }
 
 Config Settings::config() const
@@ -64,8 +78,17 @@ Config Settings::config() const
   config.debugLogRXTX = debugLogRXTX;
   config.debugStatusDataConfig = debugStatusDataConfig;
   config.debugConfigStream = debugConfigStream;
+  config.pcap = pcap;
+  config.pcapOutput = pcapOutput;
 
   return config;
 }
 
+void Settings::loaded()
+{
+  SubObject::loaded();
+
+  Attributes::setEnabled(pcapOutput, pcap);
+}
+
 }
@@ -35,6 +35,9 @@ class Settings final : public SubObject
     static constexpr uint32_t nodeSerialNumberRandomMin = 1000;
     static constexpr uint32_t nodeSerialNumberRandomMax = 9999;
 
+  protected:
+    void loaded() final;
+
   public:
     CLASS_ID("marklincan_settings")
 
@@ -44,6 +47,8 @@ class Settings final : public SubObject
     Property<bool> debugLogRXTX;
     Property<bool> debugStatusDataConfig;
     Property<bool> debugConfigStream;
+    Property<bool> pcap;
+    Property<PCAPOutput> pcapOutput;
 
     Settings(Object& _parent, std::string_view parentPropertyName);
 
@@ -24,6 +24,7 @@
 #define TRAINTASTIC_SERVER_HARDWARE_PROTOCOL_TRAINTASTICDIY_CONFIG_HPP
 
 #include <chrono>
+#include <traintastic/enum/pcapoutput.hpp>
 
 namespace TraintasticDIY {
 
@@ -34,6 +35,8 @@ struct Config
 
   bool debugLogRXTX;
   bool debugLogHeartbeat;
+  bool pcap;
+  PCAPOutput pcapOutput;
 };
 
 }
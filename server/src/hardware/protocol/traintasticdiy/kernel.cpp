@@ -88,6 +88,8 @@ void Kernel::setConfig(const Config& config)
   m_ioContext.post(
     [this, newConfig=config]()
     {
+      setPCAP(newConfig.pcap, newConfig.pcapOutput, PCAPLinkType::TraintasticDIY);
+
       m_config = newConfig;
     });
 }
@@ -118,6 +120,8 @@ void Kernel::start()
   m_ioContext.post(
     [this]()
     {
+      setPCAP(m_config.pcap, m_config.pcapOutput, PCAPLinkType::TraintasticDIY);
+
       try
       {
         m_ioHandler->start();
@@ -149,6 +153,7 @@ void Kernel::stop()
     {
       m_heartbeatTimeout.cancel();
       m_ioHandler->stop();
+      m_pcap.reset();
     });
 
   m_ioContext.stop();
@@ -175,6 +180,8 @@ void Kernel::started()
 
 void Kernel::receive(const Message& message)
 {
+  writePCAP(&message, message.size());
+
   if(m_config.debugLogRXTX && (message != Heartbeat() || m_config.debugLogHeartbeat))
     EventLoop::call(
       [this, msg=toString(message)]()
@@ -203,17 +210,17 @@ void Kernel::receive(const Message& message)
         {
           m_inputValues[address] = setInputState.state;
 
-          EventLoop::call(
-            [this, address, state=setInputState.state]()
-            {
-              if(state == InputState::Invalid)
+          if(setInputState.state == InputState::Invalid)
+          {
+            EventLoop::call(
+              [this, address]()
               {
                 if(m_inputController->inputMap().count({InputChannel::Input, address}) != 0)
                   Log::log(logId, LogMessage::W2004_INPUT_ADDRESS_X_IS_INVALID, address);
-              }
-              else
-                m_inputController->updateInputValue(InputChannel::Input, address, toTriState(state));
-            });
+              });
+          }
+          else
+            m_events.pushInput(*m_inputController, InputChannel::Input, address, toTriState(setInputState.state));
         }
       }
       break;
@@ -232,17 +239,17 @@ void Kernel::receive(const Message& message)
         {
           m_outputValues[address] = setOutputState.state;
 
-          EventLoop::call(
-            [this, address, state=setOutputState.state]()
-            {
-              if(state == OutputState::Invalid)
+          if(setOutputState.state == OutputState::Invalid)
+          {
+            EventLoop::call(
+              [this, address]()
               {
                 if(m_outputController->outputMap().count({OutputChannel::Output, address}) != 0)
                   Log::log(logId, LogMessage::W2005_OUTPUT_ADDRESS_X_IS_INVALID, address);
-              }
-              else
-                m_outputController->updateOutputValue(OutputChannel::Output, address, toTriState(state));
-            });
+              });
+          }
+          else
+            m_events.pushOutput(*m_outputController, OutputChannel::Output, address, toTriState(setOutputState.state));
         }
       }
       break;
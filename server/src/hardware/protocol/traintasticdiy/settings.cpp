@@ -32,6 +32,12 @@ Settings::Settings(Object& _parent, std::string_view parentPropertyName)
   , heartbeatTimeout{this, "heartbeat_timeout", heartbeatTimeoutDefault, PropertyFlags::ReadWrite | PropertyFlags::Store}
   , debugLogRXTX{this, "debug_log_rx_tx", false, PropertyFlags::ReadWrite | PropertyFlags::Store}
   , debugLogHeartbeat{this, "debug_log_heartbeat", false, PropertyFlags::ReadWrite | PropertyFlags::Store}
+  , pcap{this, "pcap", false, PropertyFlags::ReadWrite | PropertyFlags::Store,
+      [this](bool value)
+      {
+        Attributes::setEnabled(pcapOutput, value);
+      }}
+  , pcapOutput{this, "pcap_output", PCAPOutput::File, PropertyFlags::ReadWrite | PropertyFlags::Store}
 {
   Attributes::addMinMax(startupDelay, startupDelayMin, startupDelayMax);
   m_interfaceItems.add(startupDelay);
@@ -43,6 +49,14 @@ Settings::Settings(Object& _parent, std::string_view parentPropertyName)
   m_interfaceItems.add(debugLogRXTX);
 
   m_interfaceItems.add(debugLogHeartbeat);
+
+  Attributes::addDisplayName(pcap, DisplayName::Hardware::pcap);
+  m_interfaceItems.add(pcap);
+
+  Attributes::addDisplayName(pcapOutput, DisplayName::Hardware::pcapOutput);
+  Attributes::addEnabled(pcapOutput, pcap);
+  Attributes::addValues(pcapOutput, pcapOutputValues);
+  m_interfaceItems.add(pcapOutput);
 }
 
 Config Settings::config() const
@@ -54,8 +68,17 @@ Config Settings::config() const
 
   config.debugLogRXTX = debugLogRXTX;
   config.debugLogHeartbeat = debugLogHeartbeat;
+  config.pcap = pcap;
+  config.pcapOutput = pcapOutput;
 
   return config;
 }
 
+void Settings::loaded()
+{
+  SubObject::loaded();
+
+  Attributes::setEnabled(pcapOutput, pcap);
+}
+
 }
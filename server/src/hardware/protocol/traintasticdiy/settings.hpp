@@ -41,11 +41,16 @@ class Settings final : public SubObject
     static constexpr uint16_t heartbeatTimeoutDefault = 1'000;
     static constexpr uint16_t heartbeatTimeoutMax = 60'000;
 
+  protected:
+    void loaded() final;
+
   public:
     Property<uint16_t> startupDelay;
     Property<uint16_t> heartbeatTimeout;
     Property<bool> debugLogRXTX;
     Property<bool> debugLogHeartbeat;
+    Property<bool> pcap;
+    Property<PCAPOutput> pcapOutput;
 
     Settings(Object& _parent, std::string_view parentPropertyName);
 
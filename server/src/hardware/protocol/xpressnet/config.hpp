@@ -23,6 +23,8 @@
 #ifndef TRAINTASTIC_SERVER_HARDWARE_PROTOCOL_XPRESSNET_CONFIG_HPP
 #define TRAINTASTIC_SERVER_HARDWARE_PROTOCOL_XPRESSNET_CONFIG_HPP
 
+#include <traintastic/enum/pcapoutput.hpp>
+
 namespace XpressNet {
 
 struct Config
@@ -33,6 +35,8 @@ struct Config
 
   bool debugLogInput;
   bool debugLogRXTX;
+  bool pcap;
+  PCAPOutput pcapOutput;
 };
 
 }
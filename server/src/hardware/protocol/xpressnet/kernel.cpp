@@ -47,6 +47,8 @@ void Kernel::setConfig(const Config& config)
   m_ioContext.post(
     [this, newConfig=config]()
     {
+      setPCAP(newConfig.pcap, newConfig.pcapOutput, PCAPLinkType::XpressNet);
+
       m_config = newConfig;
     });
 }
@@ -72,6 +74,8 @@ void Kernel::start()
   m_ioContext.post(
     [this]()
     {
+      setPCAP(m_config.pcap, m_config.pcapOutput, PCAPLinkType::XpressNet);
+
       try
       {
         m_ioHandler->start();
@@ -99,6 +103,7 @@ void Kernel::stop()
     [this]()
     {
       m_ioHandler->stop();
+      m_pcap.reset();
     });
 
   m_ioContext.stop();
@@ -119,6 +124,8 @@ void Kernel::started()
 
 void Kernel::receive(const Message& message)
 {
+  writePCAP(&message, message.size());
+
   if(m_config.debugLogRXTX)
     EventLoop::call(
       [this, msg=toString(message)]()
@@ -163,11 +170,7 @@ void Kernel::receive(const Message& message)
 
                   m_inputValues[fullAddress] = value;
 
-                  EventLoop::call(
-                    [this, address=1 + fullAddress, value]()
-                    {
-                      m_inputController->updateInputValue(InputChannel::Input, address, value);
-                    });
+                  m_events.pushInput(*m_inputController, InputChannel::Input, 1 + fullAddress, value);
                 }
               }
             }
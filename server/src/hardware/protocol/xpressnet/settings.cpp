@@ -34,6 +34,12 @@ Settings::Settings(Object& _parent, std::string_view parentPropertyName)
   , useRocoF13F20Command{this, "use_roco_f13_f20_command", false, PropertyFlags::ReadWrite | PropertyFlags::Store, std::bind(&Settings::setCommandStationCustom, this)}
   , debugLogInput{this, "debug_log_input", false, PropertyFlags::ReadWrite | PropertyFlags::Store}
   , debugLogRXTX{this, "debug_log_rx_tx", false, PropertyFlags::ReadWrite | PropertyFlags::Store}
+  , pcap{this, "pcap", false, PropertyFlags::ReadWrite | PropertyFlags::Store,
+      [this](bool value)
+      {
+        Attributes::setEnabled(pcapOutput, value);
+      }}
+  , pcapOutput{this, "pcap_output", PCAPOutput::File, PropertyFlags::ReadWrite | PropertyFlags::Store}
 {
   Attributes::addDisplayName(commandStation, DisplayName::Hardware::commandStation);
   Attributes::addValues(commandStation, XpressNetCommandStationValues);
@@ -50,6 +56,14 @@ Settings::Settings(Object& _parent, std::string_view parentPropertyName)
 
   Attributes::addDisplayName(debugLogRXTX, DisplayName::Hardware::debugLogRXTX);
   m_interfaceItems.add(debugLogRXTX);
+
+  Attributes::addDisplayName(pcap, DisplayName::Hardware::pcap);
+  m_interfaceItems.add(pcap);
+
+  Attributes::addDisplayName(pcapOutput, DisplayName::Hardware::pcapOutput);
+  Attributes::addEnabled(pcapOutput, pcap);
+  Attributes::addValues(pcapOutput, pcapOutputValues);
+  m_interfaceItems.add(pcapOutput);
 }
 
 Config Settings::config() const
@@ -62,6 +76,8 @@ Config Settings::config() const
 
   config.debugLogInput = debugLogInput;
   config.debugLogRXTX = debugLogRXTX;
+  config.pcap = pcap;
+  config.pcapOutput = pcapOutput;
 
   return config;
 }
@@ -70,6 +86,8 @@ void Settings::loaded()
 {
   SubObject::loaded();
 
+  Attributes::setEnabled(pcapOutput, pcap);
+
   commandStationChanged(commandStation);
 }
 
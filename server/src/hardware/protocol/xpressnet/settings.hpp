@@ -47,6 +47,8 @@ class Settings final : public SubObject
     Property<bool> useRocoF13F20Command;
     Property<bool> debugLogInput;
     Property<bool> debugLogRXTX;
+    Property<bool> pcap;
+    Property<PCAPOutput> pcapOutput;
 
     Settings(Object& _parent, std::string_view parentPropertyName);
 
@@ -48,12 +48,16 @@ void ClientKernel::setConfig(const ClientConfig& config)
   m_ioContext.post(
     [this, newConfig=config]()
     {
+      setPCAP(newConfig.pcap, newConfig.pcapOutput, PCAPLinkType::Z21);
+
       m_config = newConfig;
     });
 }
 
 void ClientKernel::receive(const Message& message)
 {
+  writePCAP(&message, message.dataLen());
+
   if(m_config.debugLogRXTX)
     EventLoop::call(
       [this, msg=toString(message)]()
@@ -84,11 +88,7 @@ void ClientKernel::receive(const Message& message)
               value = reply.state() ? OutputPairValue::Second : OutputPairValue::First;
             }
 
-            EventLoop::call(
-              [this, address=reply.address(), value]()
-              {
-                m_outputController->updateOutputValue(OutputChannel::Accessory, address, value);
-              });
+            m_events.pushOutput(*m_outputController, OutputChannel::Accessory, reply.address(), value);
           }
           break;
 
@@ -98,11 +98,7 @@ void ClientKernel::receive(const Message& message)
             const auto& reply = static_cast<const LanXExtAccessoryInfo&>(message);
             if(reply.isDataValid())
             {
-              EventLoop::call(
-                [this, address=reply.address(), value=reply.aspect()]()
-                {
-                  m_outputController->updateOutputValue(OutputChannel::DCCext, address, value);
-                });
+              m_events.pushOutput(*m_outputController, OutputChannel::DCCext, reply.address(), reply.aspect());
             }
           }
           break;
@@ -352,11 +348,7 @@ void ClientKernel::receive(const Message& message)
           {
             m_rbusFeedbackStatus[index] = value;
 
-            EventLoop::call(
-              [this, address=rbusAddressMin + index, value]()
-              {
-                m_inputController->updateInputValue(InputChannel::RBus, address, value);
-              });
+            m_events.pushInput(*m_inputController, InputChannel::RBus, rbusAddressMin + index, value);
           }
         }
       }
@@ -376,11 +368,7 @@ void ClientKernel::receive(const Message& message)
             {
               m_loconetFeedbackStatus[index] = value;
 
-              EventLoop::call(
-                [this, address=loconetAddressMin + index, value]()
-                {
-                  m_inputController->updateInputValue(InputChannel::LocoNet, address, value);
-                });
+              m_events.pushInput(*m_inputController, InputChannel::LocoNet, loconetAddressMin + index, value);
             }
             break;
           }
@@ -717,6 +705,8 @@ void ClientKernel::simulateInputChange(InputChannel channel, uint32_t address, S
 
 void ClientKernel::onStart()
 {
+  setPCAP(m_config.pcap, m_config.pcapOutput, PCAPLinkType::Z21);
+
   // reset all state values
   m_broadcastFlags = BroadcastFlags::None;
   m_broadcastFlagsRetryCount = 0;
@@ -751,6 +741,8 @@ void ClientKernel::onStop()
   m_schedulePendingRequestTimer.cancel();
   m_locoCache.clear();
   m_pendingRequests.clear();
+
+  m_pcap.reset();
 }
 
 void ClientKernel::send(const Message& message, bool wantReply, uint8_t customRetryCount)
@@ -24,12 +24,15 @@
 #define TRAINTASTIC_SERVER_HARDWARE_PROTOCOL_Z21_CONFIG_HPP
 
 #include "messages.hpp"
+#include <traintastic/enum/pcapoutput.hpp>
 
 namespace Z21 {
 
 struct Config
 {
   bool debugLogRXTX;
+  bool pcap;
+  PCAPOutput pcapOutput;
 };
 
 struct ClientConfig : Config
@@ -25,6 +25,7 @@
 
 #include <cstddef>
 #include <limits>
+#include <span>
 
 namespace Z21 {
 
@@ -55,6 +56,20 @@ class IOHandler
     virtual bool send(const Message& /*message*/) { return false; }
     virtual bool sendTo(const Message& /*message*/, ClientId /*id*/) { return false; }
 
+    /**
+     * \brief Send the same message to multiple clients
+     * \param[in] message The message to send, it's encoded only once
+     * \param[in] ids Clients to send the message to
+     * \return \c true if the message was sent to all clients, \c false otherwise.
+     */
+    virtual bool sendTo(const Message& message, std::span<const ClientId> ids)
+    {
+      bool success = true;
+      for(auto id : ids)
+        success = sendTo(message, id) && success;
+      return success;
+    }
+
     virtual void purgeClient(ClientId /*id*/) {}
 };
 
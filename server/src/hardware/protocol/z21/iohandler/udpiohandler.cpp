@@ -26,6 +26,9 @@
 #include "../../../../core/eventloop.hpp"
 #include "../../../../log/log.hpp"
 #include "../../../../log/logmessageexception.hpp"
+#ifdef __linux__
+  #include <sys/socket.h>
+#endif
 
 namespace Z21 {
 
@@ -44,6 +47,68 @@ void UDPIOHandler::stop()
 {
 }
 
+size_t UDPIOHandler::sendToAll(const Message& message, std::span<const boost::asio::ip::udp::endpoint> endpoints)
+{
+  size_t sent = 0;
+
+#ifdef __linux__
+  static constexpr size_t batchSize = 64;
+  std::array<mmsghdr, batchSize> headers;
+  iovec data{const_cast<Message*>(&message), message.dataLen()};
+
+  while(sent < endpoints.size())
+  {
+    const size_t count = std::min(endpoints.size() - sent, batchSize);
+    for(size_t i = 0; i < count; i++)
+    {
+      const auto& endpoint = endpoints[sent + i];
+      headers[i] = {};
+      headers[i].msg_hdr.msg_name = const_cast<sockaddr*>(endpoint.data());
+      headers[i].msg_hdr.msg_namelen = static_cast<socklen_t>(endpoint.size());
+      headers[i].msg_hdr.msg_iov = &data;
+      headers[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    const int r = ::sendmmsg(m_socket.native_handle(), headers.data(), static_cast<unsigned int>(count), 0);
+    if(r <= 0)
+      break; // e.g. socket buffer full, send the remaining ones one by one
+    sent += static_cast<size_t>(r);
+  }
+#endif
+
+  for(const auto& endpoint : endpoints.subspan(sent))
+  {
+    boost::system::error_code ec;
+    m_socket.send_to(boost::asio::buffer(&message, message.dataLen()), endpoint, 0, ec);
+    if(!ec)
+      sent++;
+  }
+
+  return sent;
+}
+
+bool UDPIOHandler::sendToClient(const Message& message, ClientId id)
+{
+  //! \todo use async_send_to()
+  if(auto it = m_clients.find(id); it != m_clients.end())
+  {
+    m_socket.send_to(boost::asio::buffer(&message, message.dataLen()), it->second);
+    return true;
+  }
+
+  return false;
+}
+
+bool UDPIOHandler::sendToClients(const Message& message, std::span<const ClientId> ids)
+{
+  m_sendEndpoints.clear();
+  for(auto id : ids)
+    if(auto it = m_clients.find(id); it != m_clients.end())
+      m_sendEndpoints.emplace_back(it->second);
+
+  return sendToAll(message, m_sendEndpoints) == ids.size();
+}
+
 void UDPIOHandler::receive()
 {
   m_socket.async_receive_from(boost::asio::buffer(m_receiveBuffer), m_receiveEndpoint,
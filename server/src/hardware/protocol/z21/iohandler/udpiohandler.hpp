@@ -24,6 +24,9 @@
 #define TRAINTASTIC_SERVER_HARDWARE_PROTOCOL_Z21_IOHANDLER_UDPIOHANDLER_HPP
 
 #include "iohandler.hpp"
+#include <span>
+#include <unordered_map>
+#include <vector>
 #include <boost/asio/ip/udp.hpp>
 
 namespace Z21 {
@@ -36,14 +39,48 @@ class UDPIOHandler : public IOHandler
   private:
     boost::asio::ip::udp::endpoint m_receiveEndpoint;
     std::array<std::byte, payloadSizeMax> m_receiveBuffer;
+    std::vector<boost::asio::ip::udp::endpoint> m_sendEndpoints; //!< reused by sendToClients()
 
     void receive();
 
   protected:
     boost::asio::ip::udp::socket m_socket;
+    std::unordered_map<ClientId, boost::asio::ip::udp::endpoint> m_clients; //!< endpoints of the known clients
 
     virtual void receive(const Message& message, const boost::asio::ip::udp::endpoint& remoteEndpoint) = 0;
 
+    /**
+     * \brief Send the same message to multiple endpoints
+     *
+     * On Linux the datagrams are handed to the OS in batches using \c sendmmsg(),
+     * all pointing to the same message buffer. Elsewhere they're sent one by one.
+     *
+     * \param[in] message The message to send
+     * \param[in] endpoints Endpoints to send the message to
+     * \return Number of endpoints the message was sent to
+     */
+    size_t sendToAll(const Message& message, std::span<const boost::asio::ip::udp::endpoint> endpoints);
+
+    /**
+     * \brief Send a message to a known client
+     *
+     * \param[in] message The message to send
+     * \param[in] id Client to send the message to
+     * \return \c true if sent, \c false if the client is unknown
+     */
+    bool sendToClient(const Message& message, ClientId id);
+
+    /**
+     * \brief Send the same message to multiple known clients
+     *
+     * Unknown clients are skipped, the message is still sent to the others.
+     *
+     * \param[in] message The message to send
+     * \param[in] ids Clients to send the message to
+     * \return \c true if sent to all clients, \c false if a client is unknown or sending failed
+     */
+    bool sendToClients(const Message& message, std::span<const ClientId> ids);
+
   public:
     static constexpr uint16_t defaultPort = 21105;
 
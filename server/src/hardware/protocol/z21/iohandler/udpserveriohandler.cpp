@@ -44,14 +44,12 @@ UDPServerIOHandler::UDPServerIOHandler(ServerKernel& kernel)
 
 bool UDPServerIOHandler::sendTo(const Message& message, ClientId id)
 {
-  //! \todo use async_send_to()
-  if(auto it = m_clients.find(id); it != m_clients.end())
-  {
-    m_socket.send_to(boost::asio::buffer(&message, message.dataLen()), it->second);
-    return true;
-  }
+  return sendToClient(message, id);
+}
 
-  return false;
+bool UDPServerIOHandler::sendTo(const Message& message, std::span<const ClientId> ids)
+{
+  return sendToClients(message, ids);
 }
 
 void UDPServerIOHandler::purgeClient(ClientId id)
@@ -24,7 +24,6 @@
 #define TRAINTASTIC_SERVER_HARDWARE_PROTOCOL_Z21_IOHANDLER_UDPSERVERIOHANDLER_HPP
 
 #include "udpiohandler.hpp"
-#include <unordered_map>
 
 namespace Z21 {
 
@@ -34,7 +33,6 @@ class UDPServerIOHandler final : public UDPIOHandler
 {
   private:
     ClientId m_lastClientId = 0;
-    std::unordered_map<ClientId, boost::asio::ip::udp::endpoint> m_clients;
 
   protected:
     void receive(const Message& message, const boost::asio::ip::udp::endpoint& remoteEndpoint) final;
@@ -43,6 +41,7 @@ class UDPServerIOHandler final : public UDPIOHandler
     UDPServerIOHandler(ServerKernel& kernel);
 
     bool sendTo(const Message& message, ClientId id) final;
+    bool sendTo(const Message& message, std::span<const ClientId> ids) final;
 
     void purgeClient(ClientId id) final;
 };
@@ -21,6 +21,8 @@
  */
 
 #include "serverkernel.hpp"
+#include <algorithm>
+#include <bit>
 #include "messages.hpp"
 #include "../xpressnet/messages.hpp"
 #include "../../decoder/list/decoderlist.hpp"
@@ -28,6 +30,22 @@
 #include "../../../core/eventloop.hpp"
 #include "../../../log/log.hpp"
 
+namespace {
+
+void insertClient(std::vector<Z21::IOHandler::ClientId>& clients, Z21::IOHandler::ClientId clientId)
+{
+  if(auto it = std::lower_bound(clients.begin(), clients.end(), clientId); it == clients.end() || *it != clientId)
+    clients.insert(it, clientId);
+}
+
+void eraseClient(std::vector<Z21::IOHandler::ClientId>& clients, Z21::IOHandler::ClientId clientId)
+{
+  if(auto it = std::lower_bound(clients.begin(), clients.end(), clientId); it != clients.end() && *it == clientId)
+    clients.erase(it);
+}
+
+}
+
 namespace Z21 {
 
 ServerKernel::ServerKernel(std::string logId_, const ServerConfig& config, std::shared_ptr<DecoderList> decoderList)
@@ -43,6 +61,8 @@ void ServerKernel::setConfig(const ServerConfig& config)
   m_ioContext.post(
     [this, newConfig=config]()
     {
+      setPCAP(newConfig.pcap, newConfig.pcapOutput, PCAPLinkType::Z21);
+
       m_config = newConfig;
     });
 }
@@ -77,6 +97,8 @@ void ServerKernel::setState(bool trackPowerOn, bool emergencyStop)
 
 void ServerKernel::receiveFrom(const Message& message, IOHandler::ClientId clientId)
 {
+  writePCAP(&message, message.dataLen());
+
   if(m_config.debugLogRXTX)
     EventLoop::call(
       [this, clientId, msg=toString(message)]()
@@ -254,7 +276,7 @@ void ServerKernel::receiveFrom(const Message& message, IOHandler::ClientId clien
 
     case LAN_SET_BROADCASTFLAGS:
       if(message.dataLen() == sizeof(LanSetBroadcastFlags))
-        m_clients[clientId].broadcastFlags = static_cast<const LanSetBroadcastFlags&>(message).broadcastFlags();
+        setBroadcastFlags(clientId, static_cast<const LanSetBroadcastFlags&>(message).broadcastFlags());
       break;
 
     case LAN_SYSTEMSTATE_GETDATA:
@@ -264,7 +286,7 @@ void ServerKernel::receiveFrom(const Message& message, IOHandler::ClientId clien
 
     case LAN_LOGOFF:
       if(message == LanLogoff())
-        m_clients.erase(clientId);
+        removeClient(clientId);
       break;
 
     case LAN_GET_CODE:
@@ -288,6 +310,8 @@ void ServerKernel::receiveFrom(const Message& message, IOHandler::ClientId clien
 
 void ServerKernel::onStart()
 {
+  setPCAP(m_config.pcap, m_config.pcapOutput, PCAPLinkType::Z21);
+
   startInactiveClientPurgeTimer();
 }
 
@@ -295,8 +319,10 @@ void ServerKernel::onStop()
 {
   m_inactiveClientPurgeTimer.cancel();
 
-  for(auto& it : m_decoderSubscriptions)
-    it.second.connection.disconnect();
+  for(auto& it : m_decoderConnections)
+    it.second.disconnect();
+
+  m_pcap.reset();
 }
 
 void ServerKernel::sendTo(const Message& message, IOHandler::ClientId clientId)
@@ -314,11 +340,42 @@ void ServerKernel::sendTo(const Message& message, IOHandler::ClientId clientId)
   {} // log message and go to error state
 }
 
+void ServerKernel::sendTo(const Message& message, std::span<const IOHandler::ClientId> clientIds)
+{
+  if(clientIds.empty())
+    return;
+
+  if(m_ioHandler->sendTo(message, clientIds))
+  {
+    if(m_config.debugLogRXTX)
+      EventLoop::call(
+        [this, clientIds=std::vector<IOHandler::ClientId>(clientIds.begin(), clientIds.end()), msg=toString(message)]()
+        {
+          for(auto clientId : clientIds)
+            Log::log(logId, LogMessage::D2004_X_TX_X, clientId, msg);
+        });
+  }
+  else
+  {} // log message and go to error state
+}
+
 void ServerKernel::sendTo(const Message& message, BroadcastFlags broadcastFlags)
 {
-  for(const auto& client : m_clients)
-    if((client.second.broadcastFlags & broadcastFlags) != BroadcastFlags::None)
-      sendTo(message, client.first);
+  const auto flags = static_cast<uint32_t>(broadcastFlags);
+  if(std::has_single_bit(flags))
+  {
+    sendTo(message, m_broadcastClients[std::countr_zero(flags)]);
+    return;
+  }
+
+  // multiple flags, send once to every client having at least one of them:
+  m_sendClients.clear();
+  for(size_t i = 0; i < m_broadcastClients.size(); i++)
+    if(flags & (1U << i))
+      m_sendClients.insert(m_sendClients.end(), m_broadcastClients[i].begin(), m_broadcastClients[i].end());
+  std::sort(m_sendClients.begin(), m_sendClients.end());
+  m_sendClients.erase(std::unique(m_sendClients.begin(), m_sendClients.end()), m_sendClients.end());
+  sendTo(message, m_sendClients);
 }
 
 LanSystemStateDataChanged ServerKernel::getLanSystemStateDataChanged() const
@@ -341,11 +398,35 @@ std::shared_ptr<Decoder> ServerKernel::getDecoder(uint16_t address, bool longAdd
   return decoder;
 }
 
+const ServerKernel::ClientIdList& ServerKernel::broadcastClients(BroadcastFlags flag) const
+{
+  assert(std::has_single_bit(static_cast<uint32_t>(flag)));
+  return m_broadcastClients[std::countr_zero(static_cast<uint32_t>(flag))];
+}
+
+void ServerKernel::setBroadcastFlags(IOHandler::ClientId clientId, BroadcastFlags broadcastFlags)
+{
+  auto& client = m_clients[clientId];
+  const auto oldFlags = static_cast<uint32_t>(client.broadcastFlags);
+  const auto newFlags = static_cast<uint32_t>(broadcastFlags);
+  client.broadcastFlags = broadcastFlags;
+
+  for(size_t i = 0; i < m_broadcastClients.size(); i++)
+  {
+    const uint32_t flag = 1U << i;
+    if((newFlags & flag) && !(oldFlags & flag))
+      insertClient(m_broadcastClients[i], clientId);
+    else if(!(newFlags & flag) && (oldFlags & flag))
+      eraseClient(m_broadcastClients[i], clientId);
+  }
+}
+
 void ServerKernel::removeClient(IOHandler::ClientId clientId)
 {
   auto& subscriptions = m_clients[clientId].subscriptions;
   while(!subscriptions.empty())
     unsubscribe(clientId, *subscriptions.begin());
+  setBroadcastFlags(clientId, BroadcastFlags::None);
   m_clients.erase(clientId);
   m_ioHandler->purgeClient(clientId);
 }
@@ -353,29 +434,24 @@ void ServerKernel::removeClient(IOHandler::ClientId clientId)
 void ServerKernel::subscribe(IOHandler::ClientId clientId, uint16_t address, bool longAddress)
 {
   auto& subscriptions = m_clients[clientId].subscriptions;
-  const std::pair<uint16_t, bool> key{address, longAddress};
+  const DecoderKey key{address, longAddress};
   if(std::find(subscriptions.begin(), subscriptions.end(), key) != subscriptions.end())
     return;
-  subscriptions.emplace_back(address, longAddress);
+  subscriptions.emplace_back(key);
+  insertClient(m_decoderSubscriptions[key], clientId);
   if(subscriptions.size() > ServerConfig::subscriptionMax)
     unsubscribe(clientId, *subscriptions.begin());
 
   EventLoop::call(
     [this, key]()
     {
-      if(auto it = m_decoderSubscriptions.find(key); it == m_decoderSubscriptions.end())
-      {
+      if(!m_decoderConnections.contains(key)) // connect if not yet, the decoder might not have existed at the previous subscribe
         if(auto decoder = getDecoder(key.first, key.second))
-          m_decoderSubscriptions.emplace(key, DecoderSubscription{decoder->decoderChanged.connect(std::bind(&ServerKernel::decoderChanged, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3)), 1});
-      }
-      else
-      {
-        it->second.count++;
-      }
+          m_decoderConnections.emplace(key, decoder->decoderChanged.connect(std::bind(&ServerKernel::decoderChanged, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3)));
     });
 }
 
-void ServerKernel::unsubscribe(IOHandler::ClientId clientId, std::pair<uint16_t, bool> key)
+void ServerKernel::unsubscribe(IOHandler::ClientId clientId, DecoderKey key)
 {
   {
     auto& subscriptions = m_clients[clientId].subscriptions;
@@ -384,33 +460,42 @@ void ServerKernel::unsubscribe(IOHandler::ClientId clientId, std::pair<uint16_t,
       subscriptions.erase(it);
   }
 
+  if(auto it = m_decoderSubscriptions.find(key); it != m_decoderSubscriptions.end())
+  {
+    eraseClient(it->second, clientId);
+    if(!it->second.empty())
+      return;
+    m_decoderSubscriptions.erase(it);
+  }
+
+  // last client unsubscribed:
   EventLoop::call(
     [this, key]()
     {
-      if(auto it = m_decoderSubscriptions.find(key); it != m_decoderSubscriptions.end())
+      if(auto it = m_decoderConnections.find(key); it != m_decoderConnections.end())
       {
-        assert(it->second.count > 0);
-        if(--it->second.count == 0)
-          m_decoderSubscriptions.erase(it);
+        it->second.disconnect();
+        m_decoderConnections.erase(it);
       }
     });
 }
 
 void ServerKernel::decoderChanged(const Decoder& decoder, DecoderChangeFlags /*changes*/, uint32_t /*functionNumber*/)
 {
-  const std::pair<uint16_t, bool> key(decoder.address, decoder.protocol == DecoderProtocol::DCCLong);
+  const DecoderKey key(decoder.address, decoder.protocol == DecoderProtocol::DCCLong);
   const LanXLocoInfo message(decoder);
 
-  EventLoop::call(
+  m_ioContext.post(
     [this, key, message]()
     {
-      for(auto it : m_clients)
-        if((it.second.broadcastFlags & BroadcastFlags::PowerLocoTurnoutChanges) == BroadcastFlags::PowerLocoTurnoutChanges)
-        {
-          auto& subscriptions = it.second.subscriptions;
-          if(std::find(subscriptions.begin(), subscriptions.end(), key) != subscriptions.end())
-            sendTo(message, it.first);
-        }
+      auto it = m_decoderSubscriptions.find(key);
+      if(it == m_decoderSubscriptions.end())
+        return;
+
+      const auto& clients = broadcastClients(BroadcastFlags::PowerLocoTurnoutChanges);
+      m_sendClients.clear();
+      std::set_intersection(it->second.begin(), it->second.end(), clients.begin(), clients.end(), std::back_inserter(m_sendClients));
+      sendTo(message, m_sendClients);
     });
 }
 
@@ -24,9 +24,12 @@
 #define TRAINTASTIC_SERVER_HARDWARE_PROTOCOL_Z21_SERVERKERNEL_HPP
 
 #include "kernel.hpp"
+#include <array>
 #include <list>
 #include <map>
+#include <span>
 #include <unordered_map>
+#include <vector>
 #include <boost/asio/steady_timer.hpp>
 #include <boost/signals2/signal.hpp>
 #include <traintastic/enum/tristate.hpp>
@@ -39,24 +42,24 @@ namespace Z21 {
 class ServerKernel final : public Kernel
 {
   private:
+    using DecoderKey = std::pair<uint16_t, bool>; //!< address, long address
+    using ClientIdList = std::vector<IOHandler::ClientId>; //!< sorted
+
     struct Client
     {
       std::chrono::time_point<std::chrono::steady_clock> lastSeen;
       BroadcastFlags broadcastFlags = BroadcastFlags::None;
-      std::list<std::pair<uint16_t, bool>> subscriptions;
-    };
-
-    struct DecoderSubscription
-    {
-      boost::signals2::connection connection;
-      size_t count; //!< number of clients subscribed to the decoder
+      std::list<DecoderKey> subscriptions;
     };
 
     boost::asio::steady_timer m_inactiveClientPurgeTimer;
     ServerConfig m_config;
     std::shared_ptr<DecoderList> m_decoderList;
     std::unordered_map<IOHandler::ClientId, Client> m_clients;
-    std::map<std::pair<uint16_t, bool>, DecoderSubscription> m_decoderSubscriptions;
+    std::array<ClientIdList, 32> m_broadcastClients; //!< clients per broadcast flag bit
+    std::map<DecoderKey, ClientIdList> m_decoderSubscriptions; //!< subscribed clients per decoder
+    ClientIdList m_sendClients; //!< reused for broadcasts to a combination of clients
+    std::map<DecoderKey, boost::signals2::connection> m_decoderConnections; //!< \note Only accessed in the event loop thread
     TriState m_trackPowerOn = TriState::Undefined;
     std::function<void()> m_onTrackPowerOff;
     std::function<void()> m_onTrackPowerOn;
@@ -79,15 +82,19 @@ class ServerKernel final : public Kernel
     }
 
     void sendTo(const Message& message, IOHandler::ClientId clientId);
+    void sendTo(const Message& message, std::span<const IOHandler::ClientId> clientIds);
     void sendTo(const Message& message, BroadcastFlags broadcastFlags);
 
     LanSystemStateDataChanged getLanSystemStateDataChanged() const;
 
     std::shared_ptr<Decoder> getDecoder(uint16_t address, bool longAddress) const;
 
+    const ClientIdList& broadcastClients(BroadcastFlags flag) const;
+    void setBroadcastFlags(IOHandler::ClientId clientId, BroadcastFlags broadcastFlags);
+
     void removeClient(IOHandler::ClientId clientId);
     void subscribe(IOHandler::ClientId clientId, uint16_t address, bool longAddress);
-    void unsubscribe(IOHandler::ClientId clientId, std::pair<uint16_t, bool> key);
+    void unsubscribe(IOHandler::ClientId clientId, DecoderKey key);
     void decoderChanged(const Decoder& decoder, DecoderChangeFlags changes, uint32_t functionNumber);
 
     void startInactiveClientPurgeTimer();
@@ -34,10 +34,13 @@ class Settings : public SubObject
   protected:
     Settings(Object& _parent, std::string_view parentPropertyName);
 
+    void loaded() override;
     void getConfig(Config& config) const;
 
   public:
     Property<bool> debugLogRXTX;
+    Property<bool> pcap;
+    Property<PCAPOutput> pcapOutput;
 };
 
 }
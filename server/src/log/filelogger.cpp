@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2021-2023 Reinder Feenstra
+ * Copyright (C) 2021-2023,2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -21,11 +21,27 @@
  */
 
 #include "filelogger.hpp"
-#include <iomanip>
 #include <version.hpp>
 #include "../os/localtime.hpp"
+#include "../utils/setthreadname.hpp"
 
-FileLogger::FileLogger(const std::filesystem::path& filename)
+static constexpr size_t batchSize = 64 * 1024; //!< bytes per file write
+
+static void appendDecimal(std::string& s, uint32_t value, size_t width)
+{
+  const size_t pos = s.size();
+  s.resize(pos + width);
+  for(size_t i = pos + width; i > pos; i--)
+  {
+    s[i - 1] = static_cast<char>('0' + value % 10);
+    value /= 10;
+  }
+}
+
+FileLogger::FileLogger(const std::filesystem::path& filename, std::chrono::milliseconds flushInterval, size_t queueSize)
+  : m_flushInterval{flushInterval}
+  , m_queue{queueSize}
+  , m_queueHighWater{queueSize / 2}
 {
   // try create directory if it doesn't exist
   const auto path = filename.parent_path();
@@ -35,32 +51,154 @@ FileLogger::FileLogger(const std::filesystem::path& filename)
   // open logfile and write marker
   m_file.open(filename, std::ios::app);
   m_file << "=== Traintastic v" TRAINTASTIC_VERSION_FULL << std::endl;
+
+  m_buffer.reserve(batchSize + 4096);
+  m_thread = std::thread(&FileLogger::run, this);
 }
 
+FileLogger::~FileLogger()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_wakeMutex);
+    m_stop = true;
+  }
+  m_wake.notify_one();
+  m_thread.join();
+}
+
+FileLogger::Statistics FileLogger::statistics() const
+{
+  return {m_written.load(), m_dropped.load(), m_backpressure.load()};
+}
+
+#ifdef TRAINTASTIC_TEST
+void FileLogger::pauseWriter(bool pause)
+{
+  {
+    std::lock_guard<std::mutex> lock(m_wakeMutex);
+    m_paused = pause;
+  }
+  m_wake.notify_one();
+}
+#endif
+
 void FileLogger::log(const std::chrono::system_clock::time_point& time, std::string_view objectId, LogMessage message)
 {
-  write(time, objectId, message, toString(message));
+  push({time, std::string{objectId}, message, {}, false});
 }
 
 void FileLogger::log(const std::chrono::system_clock::time_point& time, std::string_view objectId, LogMessage message, const std::vector<std::string>& args)
 {
-  write(time, objectId, message, toString(message, args));
+  push({time, std::string{objectId}, message, args, true});
+}
+
+void FileLogger::push(Record&& record)
+{
+  const auto wake =
+    [this]()
+    {
+      if(!m_wakePending.exchange(true))
+      {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        m_wake.notify_one();
+      }
+    };
+
+  if(!m_queue.tryPush(std::move(record)))
+  {
+    m_dropped.fetch_add(1, std::memory_order_relaxed);
+    wake();
+  }
+  else if(m_queue.size() >= m_queueHighWater)
+  {
+    m_backpressure.fetch_add(1, std::memory_order_relaxed);
+    wake();
+  }
 }
 
-void FileLogger::write(const std::chrono::system_clock::time_point& time, std::string_view objectId, LogMessage code, std::string_view message)
+void FileLogger::run()
 {
-  const auto systemTime = std::chrono::system_clock::to_time_t(time);
-  const auto us = std::chrono::duration_cast<std::chrono::microseconds>(time.time_since_epoch()) % 1000000;
-  tm tm;
+  setThreadName("file-logger");
+
+  Record record;
+  auto lastFlush = std::chrono::steady_clock::now();
+  bool stop = false;
+  while(!stop)
+  {
+    {
+      std::unique_lock<std::mutex> lock(m_wakeMutex);
+      m_wake.wait_for(lock, m_flushInterval, [this]() { return m_stop || m_wakePending.load(); });
+      m_wake.wait(lock, [this]() { return m_stop || !m_paused; });
+      stop = m_stop;
+    }
+    m_wakePending.store(false);
 
-  std::lock_guard<std::mutex> lock(m_fileMutex);
+    uint64_t written = 0;
+    while(m_queue.tryPop(record))
+    {
+      format(record);
+      written++;
+      if(m_buffer.size() >= batchSize)
+      {
+        m_file.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+        m_buffer.clear();
+      }
+    }
+    m_written.fetch_add(written, std::memory_order_relaxed);
 
-  const char time_format[] = TRAINTASTIC_LOG_DATE_FORMAT ";" TRAINTASTIC_LOG_TIME_FORMAT;
+    if(const uint64_t dropped = m_dropped.load(); dropped != m_droppedReported)
+    {
+      m_buffer.append("=== Dropped ").append(std::to_string(dropped - m_droppedReported)).append(" log messages, queue full\n");
+      m_droppedReported = dropped;
+    }
+
+    if(stop && (m_droppedReported != 0 || m_backpressure.load() != 0))
+    {
+      const auto stats = statistics();
+      m_buffer
+        .append("=== Log statistics: written ").append(std::to_string(stats.written))
+        .append(", dropped ").append(std::to_string(stats.dropped))
+        .append(", backpressure ").append(std::to_string(stats.backpressure))
+        .append("\n");
+    }
+
+    if(!m_buffer.empty())
+    {
+      m_file.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+      m_buffer.clear();
+    }
+
+    if(const auto now = std::chrono::steady_clock::now(); stop || now - lastFlush >= m_flushInterval)
+    {
+      m_file.flush();
+      lastFlush = now;
+    }
+  }
+}
+
+void FileLogger::format(const Record& record)
+{
+  // date and time only change once a second, only format them when they do:
+  const auto seconds = std::chrono::time_point_cast<std::chrono::seconds>(record.time);
+  if(m_prefix.empty() || seconds != m_prefixTime)
+  {
+    static const char timeFormat[] = TRAINTASTIC_LOG_DATE_FORMAT ";" TRAINTASTIC_LOG_TIME_FORMAT;
+    const auto systemTime = std::chrono::system_clock::to_time_t(seconds);
+    tm tm;
+    char buffer[32];
+    m_prefix.assign(buffer, strftime(buffer, sizeof(buffer), timeFormat, localTime(&systemTime, &tm)));
+    m_prefixTime = seconds;
+  }
+  const auto us = std::chrono::duration_cast<std::chrono::microseconds>(record.time - seconds).count();
 
-  m_file
-    << std::put_time(localTime(&systemTime, &tm), time_format) << '.' << std::setfill('0') << std::setw(6) << us.count() << ';'
-    << objectId << ';'
-    << logMessageChar(code) << std::setw(4) << logMessageNumber(code) << ';'
-    << message
-    << std::endl;
+  m_buffer.append(m_prefix).append(1, '.');
+  appendDecimal(m_buffer, static_cast<uint32_t>(us), 6);
+  m_buffer.append(1, ';').append(record.objectId).append(1, ';').append(1, logMessageChar(record.message));
+  appendDecimal(m_buffer, static_cast<uint32_t>(logMessageNumber(record.message)), 4);
+  m_buffer.append(1, ';');
+  if(record.hasArgs)
+    m_buffer.append(toString(record.message, record.args));
+  else
+    m_buffer.append(toString(record.message));
+  m_buffer.append(1, '\n');
 }
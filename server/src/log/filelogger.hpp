@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2021-2022 Reinder Feenstra
+ * Copyright (C) 2021-2022,2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -24,20 +24,82 @@
 #define TRAINTASTIC_SERVER_LOG_FILELOGGER_HPP
 
 #include "logger.hpp"
+#include <atomic>
+#include <condition_variable>
 #include <mutex>
 #include <fstream>
+#include <thread>
 #include <traintastic/utils/stdfilesystem.hpp>
+#include "../utils/mpscqueue.hpp"
 
+/**
+ * \brief Asynchronous file logger
+ *
+ * log() only queues the message, formatting and writing is done in batches
+ * by a dedicated writer thread. The file is flushed at the flush interval.
+ * If the queue is full the message is dropped, the number of dropped
+ * messages is written to the log file when there is room again.
+ */
 class FileLogger : public Logger
 {
+  public:
+    static constexpr size_t queueSizeDefault = 8192;
+    static constexpr std::chrono::milliseconds flushIntervalDefault{500};
+
+    struct Statistics
+    {
+      uint64_t written; //!< messages written to the file
+      uint64_t dropped; //!< messages dropped due to a full queue
+      uint64_t backpressure; //!< messages queued while the queue was above the high water mark
+    };
+
   private:
+    struct Record
+    {
+      std::chrono::system_clock::time_point time;
+      std::string objectId;
+      LogMessage message;
+      std::vector<std::string> args;
+      bool hasArgs;
+    };
+
     std::ofstream m_file;
-    std::mutex m_fileMutex;
+    const std::chrono::milliseconds m_flushInterval;
+    MPSCQueue<Record> m_queue;
+    const size_t m_queueHighWater; //!< wake the writer before the flush interval has elapsed
+    std::thread m_thread;
+    std::mutex m_wakeMutex;
+    std::condition_variable m_wake;
+    bool m_stop = false; //!< guarded by m_wakeMutex
+    bool m_paused = false; //!< guarded by m_wakeMutex
+    std::atomic_bool m_wakePending = false;
+    std::atomic<uint64_t> m_written = 0;
+    std::atomic<uint64_t> m_dropped = 0;
+    std::atomic<uint64_t> m_backpressure = 0;
+
+    // writer thread only:
+    std::string m_buffer;
+    std::chrono::system_clock::time_point m_prefixTime;
+    std::string m_prefix; //!< formatted date and time of m_prefixTime
+    uint64_t m_droppedReported = 0;
 
-    void write(const std::chrono::system_clock::time_point& time, std::string_view objectId, LogMessage code, std::string_view message);
+    void push(Record&& record);
+    void run();
+    void format(const Record& record);
 
   public:
-    FileLogger(const std::filesystem::path& filename);
+    /**
+     * \param[in] queueSize Maximum number of queued messages, must be a power of two.
+     */
+    FileLogger(const std::filesystem::path& filename, std::chrono::milliseconds flushInterval = flushIntervalDefault, size_t queueSize = queueSizeDefault);
+    ~FileLogger() final;
+
+    Statistics statistics() const;
+
+#ifdef TRAINTASTIC_TEST
+    //! \brief Hold the writer thread, queued messages are written after resume or on destruction
+    void pauseWriter(bool pause);
+#endif
 
     void log(const std::chrono::system_clock::time_point& time, std::string_view objectId, LogMessage message) final;
     void log(const std::chrono::system_clock::time_point& time, std::string_view objectId, LogMessage message, const std::vector<std::string>& args) final;
@@ -23,6 +23,7 @@
 #ifndef TRAINTASTIC_SERVER_LOG_LOG_HPP
 #define TRAINTASTIC_SERVER_LOG_LOG_HPP
 
+#include <chrono>
 #include <string>
 #include <vector>
 #include <traintastic/enum/logmessage.hpp>
@@ -70,7 +71,7 @@ class Log
   public:
     static void enableConsoleLogger();
 
-    static void enableFileLogger(const std::filesystem::path& filename);
+    static void enableFileLogger(const std::filesystem::path& filename, std::chrono::milliseconds flushInterval);
     static void disableFileLogger();
 
     static void enableMemoryLogger(uint32_t size);
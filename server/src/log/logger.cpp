@@ -26,6 +26,9 @@
 
 std::string_view Logger::toString(LogMessage message)
 {
+  if(!Locale::instance) // no translations loaded, e.g. in the test suite
+    return {};
+
   std::string key;
   key.resize(32);
   int n = snprintf(key.data(), key.size() ,"message:%c%04d", logMessageChar(message), logMessageNumber(message));
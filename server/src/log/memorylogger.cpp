@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2021-2022 Reinder Feenstra
+ * Copyright (C) 2021-2022,2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -21,43 +21,160 @@
  */
 
 #include "memorylogger.hpp"
+#include <algorithm>
+#include <cstring>
+#include <limits>
 #include "../core/eventloop.hpp"
+#include "../utils/random.hpp"
 
-MemoryLogger::MemoryLogger(uint32_t sizeMax)
-  : m_sizeMax{sizeMax}
+std::string_view MemoryLogger::Args::operator[](uint8_t index) const
 {
+  assert(index < m_count);
+  const char* p = data();
+  for(;;)
+  {
+    uint16_t length;
+    std::memcpy(&length, p, sizeof(length));
+    p += sizeof(length);
+    if(index-- == 0)
+      return {p, length};
+    p += length;
+  }
 }
 
-void MemoryLogger::log(const std::chrono::system_clock::time_point& time, std::string_view objectId, LogMessage message)
+void MemoryLogger::Args::assign(const std::vector<std::string>& args)
 {
-  add(time, std::string{objectId}, message, nullptr);
+  const size_t count = std::min<size_t>(args.size(), std::numeric_limits<uint8_t>::max());
+
+  // args are stored as: length (uint16_t) followed by the characters
+  size_t size = 0;
+  for(size_t i = 0; i < count; i++)
+    size += sizeof(uint16_t) + std::min<size_t>(args[i].size(), std::numeric_limits<uint16_t>::max());
+
+  char* p;
+  if(size <= inlineSize)
+    p = m_inline.data();
+  else
+  {
+    if(size > m_heapSize)
+    {
+      m_heap = std::make_unique<char[]>(size);
+      m_heapSize = static_cast<uint32_t>(size);
+    }
+    p = m_heap.get();
+  }
+
+  for(size_t i = 0; i < count; i++)
+  {
+    const auto length = static_cast<uint16_t>(std::min<size_t>(args[i].size(), std::numeric_limits<uint16_t>::max()));
+    std::memcpy(p, &length, sizeof(length));
+    p += sizeof(length);
+    std::memcpy(p, args[i].data(), length);
+    p += length;
+  }
+
+  m_size = static_cast<uint32_t>(size);
+  m_count = static_cast<uint8_t>(count);
 }
 
-void MemoryLogger::log(const std::chrono::system_clock::time_point& time, std::string_view objectId, LogMessage message, const std::vector<std::string>& args)
+void MemoryLogger::Args::clear()
+{
+  m_size = 0;
+  m_count = 0;
+}
+
+MemoryLogger::MemoryLogger(uint32_t sizeMax)
+  : m_logId{Random::value<uint64_t>(1, std::numeric_limits<uint64_t>::max())}
+  , m_sizeMax{sizeMax}
 {
-  add(time, std::string{objectId}, message, new std::vector<std::string>(args));
 }
 
-void MemoryLogger::add(std::chrono::system_clock::time_point time, std::string objectId, LogMessage message, std::vector<std::string>* args)
+void MemoryLogger::log(const std::chrono::system_clock::time_point& time, std::string_view objectId, LogMessage message)
 {
   if(isEventLoopThread())
-  {
-    m_logs.emplace_back(std::move(time), std::move(objectId), message, std::unique_ptr<std::vector<std::string>>{args});
-    changed(*this, 1, cleanUp());
-  }
+    add(time, objectId, message, nullptr);
+  else
+    EventLoop::call(
+      [this, time, objectId=std::string{objectId}, message]()
+      {
+        add(time, objectId, message, nullptr);
+      });
+}
+
+void MemoryLogger::log(const std::chrono::system_clock::time_point& time, std::string_view objectId, LogMessage message, const std::vector<std::string>& args)
+{
+  if(isEventLoopThread())
+    add(time, objectId, message, &args);
   else
-  {
     EventLoop::call(
-      [this, time=std::move(time), objectId=std::move(objectId), message, args]()
+      [this, time, objectId=std::string{objectId}, message, args]()
       {
-        add(std::move(time), std::move(objectId), message, args);
+        add(time, objectId, message, &args);
       });
+}
+
+void MemoryLogger::add(std::chrono::system_clock::time_point time, std::string_view objectId, LogMessage message, const std::vector<std::string>* args)
+{
+  assert(isEventLoopThread());
+
+  if(m_sizeMax == 0)
+    return;
+
+  const uint32_t objectIdIndex = intern(objectId);
+
+  Log* log;
+  if(m_logs.size() < m_sizeMax)
+    log = &m_logs.emplace_back();
+  else // overwrite oldest
+  {
+    log = &m_logs[m_first];
+    m_first = (m_first + 1) % m_logs.size();
+    m_firstSequence++;
   }
+
+  log->time = time;
+  log->objectId = objectIdIndex;
+  log->message = message;
+  if(args)
+    log->args.assign(*args);
+  else
+    log->args.clear();
+
+  changed(*this);
+}
+
+uint32_t MemoryLogger::intern(std::string_view objectId)
+{
+  if(auto it = m_objectIdIndex.find(objectId); it != m_objectIdIndex.end())
+    return it->second;
+
+  if(m_objectIds.size() >= m_objectIdsCompactSize)
+    compactObjectIds();
+
+  const auto index = static_cast<uint32_t>(m_objectIds.size());
+  m_objectIdIndex.emplace(m_objectIds.emplace_back(objectId), index);
+  return index;
 }
 
-uint32_t MemoryLogger::cleanUp()
+void MemoryLogger::compactObjectIds()
 {
-  const uint32_t remove = (size() > m_sizeMax) ? (size() - m_sizeMax) : 0;
-  m_logs.erase(m_logs.begin(), m_logs.begin() + remove);
-  return remove;
+  // drop object ids that are no longer referenced, e.g. of renamed or deleted objects:
+  constexpr auto unused = std::numeric_limits<uint32_t>::max();
+  std::vector<uint32_t> remap(m_objectIds.size(), unused);
+  std::deque<std::string> objectIds;
+  m_objectIdIndex.clear();
+
+  for(auto& log : m_logs)
+  {
+    uint32_t& index = remap[log.objectId];
+    if(index == unused)
+    {
+      index = static_cast<uint32_t>(objectIds.size());
+      m_objectIdIndex.emplace(objectIds.emplace_back(std::move(m_objectIds[log.objectId])), index);
+    }
+    log.objectId = index;
+  }
+
+  m_objectIds = std::move(objectIds);
+  m_objectIdsCompactSize = std::max(objectIdsCompactSizeMin, 2 * m_objectIds.size());
 }
@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2021-2022 Reinder Feenstra
+ * Copyright (C) 2021-2022,2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -24,44 +24,103 @@
 #define TRAINTASTIC_SERVER_LOG_MEMORYLOGGER_HPP
 
 #include "logger.hpp"
-#include <list>
-#include <functional>
+#include <array>
+#include <cassert>
+#include <deque>
+#include <memory>
+#include <unordered_map>
 #include <boost/signals2/signal.hpp>
 
+/**
+ * \brief Keeps the most recent log messages in memory for clients
+ *
+ * Fixed capacity ring buffer, every message gets a sequence number so
+ * clients can (re)synchronize incrementally. Object ids are interned and
+ * small arguments are stored inline, adding a message doesn't allocate
+ * once the buffer is full.
+ */
 class MemoryLogger : public Logger
 {
   public:
+    //! \brief Message arguments packed into a single buffer, inline if they fit
+    class Args
+    {
+      public:
+        static constexpr size_t inlineSize = 48;
+
+      private:
+        std::array<char, inlineSize> m_inline;
+        std::unique_ptr<char[]> m_heap; //!< kept for reuse when the slot is overwritten
+        uint32_t m_heapSize = 0;
+        uint32_t m_size = 0; //!< bytes used
+        uint8_t m_count = 0;
+
+        inline const char* data() const
+        {
+          return m_size > inlineSize ? m_heap.get() : m_inline.data();
+        }
+
+      public:
+        inline uint8_t size() const
+        {
+          return m_count;
+        }
+
+        //! \brief Get argument, O(n)
+        std::string_view operator[](uint8_t index) const;
+
+        void assign(const std::vector<std::string>& args);
+        void clear();
+    };
+
     struct Log
     {
       std::chrono::system_clock::time_point time;
-      std::string objectId;
+      uint32_t objectId; //!< index in interned object ids, see MemoryLogger::objectId()
       LogMessage message;
-      std::unique_ptr<std::vector<std::string>> args;
-
-      Log(std::chrono::system_clock::time_point _time, std::string _objectId, LogMessage _message, std::unique_ptr<std::vector<std::string>> _args = {})
-        : time{std::move(_time)}
-        , objectId{std::move(_objectId)}
-        , message{_message}
-        , args{std::move(_args)}
-      {
-      }
+      Args args;
     };
 
   private:
-    std::vector<Log> m_logs;
+    static constexpr size_t objectIdsCompactSizeMin = 1024;
+
+    const uint64_t m_logId; //!< random, so a client can tell if sequence numbers are of this logger
+    std::vector<Log> m_logs; //!< grows up to m_sizeMax, then used as ring buffer
     size_t m_sizeMax;
+    size_t m_first = 0; //!< index of the oldest log in m_logs
+    uint64_t m_firstSequence = 0;
+    std::deque<std::string> m_objectIds; //!< deque, so the string_views in m_objectIdIndex stay valid
+    std::unordered_map<std::string_view, uint32_t> m_objectIdIndex;
+    size_t m_objectIdsCompactSize = objectIdsCompactSizeMin;
 
-    void add(std::chrono::system_clock::time_point time, std::string objectId, LogMessage message, std::vector<std::string>* args);
-    uint32_t cleanUp();
+    void add(std::chrono::system_clock::time_point time, std::string_view objectId, LogMessage message, const std::vector<std::string>* args);
+    uint32_t intern(std::string_view objectId);
+    void compactObjectIds();
 
   public:
-    boost::signals2::signal<void(const MemoryLogger&, uint32_t added, uint32_t removed)> changed;
+    boost::signals2::signal<void(const MemoryLogger&)> changed;
 
     MemoryLogger(uint32_t sizeMax);
 
-    inline const Log& operator[](uint32_t index) const { return m_logs[index]; }
+    inline uint64_t logId() const { return m_logId; }
+
+    //! \brief Sequence number of the oldest log still in memory
+    inline uint64_t firstSequence() const { return m_firstSequence; }
+
+    //! \brief Sequence number the next log will get
+    inline uint64_t nextSequence() const { return m_firstSequence + m_logs.size(); }
+
     inline uint32_t size() const { return static_cast<uint32_t>(m_logs.size()); }
 
+    //! \pre firstSequence() <= sequence < nextSequence()
+    inline const Log& operator[](uint64_t sequence) const
+    {
+      assert(sequence >= m_firstSequence && sequence < nextSequence());
+      return m_logs[(m_first + (sequence - m_firstSequence)) % m_logs.size()];
+    }
+
+    inline const std::string& objectId(const Log& log) const { return m_objectIds[log.objectId]; }
+
     void log(const std::chrono::system_clock::time_point& time, std::string_view objectId, LogMessage message) final;
     void log(const std::chrono::system_clock::time_point& time, std::string_view objectId, LogMessage message, const std::vector<std::string>& args) final;
 };
@@ -30,6 +30,7 @@
 #include "../board/board.hpp"
 #include "../board/boardlist.hpp"
 #include "../board/pathfinder/trainpathfinder.hpp"
+#include "../board/pathfinder/trainroute.hpp"
 
 #include "../board/tile/misc/labeltile.hpp"
 #include "../board/tile/misc/pushbuttontile.hpp"
@@ -163,6 +164,7 @@ void Class::registerValues(lua_State* L)
   registerValue<Board>(L, "BOARD");
   registerValue<BoardList>(L, "BOARD_LIST");
   registerValue<TrainPathFinder>(L, "TRAIN_PATH_FINDER");
+  registerValue<TrainRoute>(L, "TRAIN_ROUTE");
 
   registerValue<LabelTile>(L, "LABEL_TILE");
   registerValue<PushButtonTile>(L, "PUSH_BUTTON_TILE");
@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2019-2024 Reinder Feenstra
+ * Copyright (C) 2019-2024,2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -21,6 +21,8 @@
  */
 
 #include "object.hpp"
+#include <array>
+#include <cstddef>
 #include "../check.hpp"
 #include "../push.hpp"
 #include "../to.hpp"
@@ -35,6 +37,21 @@
 
 namespace Lua::Object {
 
+//! Last used item slot per key, short Lua strings are interned so the key pointer mostly identifies the name.
+//! A wrong slot is detected by InterfaceItems::find(), Lua only runs in the event loop.
+static std::array<std::pair<const char*, uint16_t>, 256> itemSlots{};
+
+static InterfaceItem* findItem(const ::Object& object, std::string_view key)
+{
+  auto& [cachedKey, cachedSlot] = itemSlots[(reinterpret_cast<uintptr_t>(key.data()) / alignof(std::max_align_t)) % itemSlots.size()];
+  if(cachedKey != key.data())
+  {
+    cachedKey = key.data();
+    cachedSlot = InterfaceItems::noSlot;
+  }
+  return object.interfaceItems().find(key, cachedSlot);
+}
+
 void Object::registerType(lua_State* L)
 {
   luaL_newmetatable(L, metaTableName);
@@ -51,9 +68,9 @@ int Object::index(lua_State* L, ::Object& object)
 {
   const auto key = to<std::string_view>(L, 2);
 
-  if(InterfaceItem* item = object.getItem(key))
+  if(InterfaceItem* item = findItem(object, key))
   {
-    if(auto* property = dynamic_cast<AbstractProperty*>(item))
+    if(auto* property = interfaceItemCast<AbstractProperty>(item))
     {
       if(property->isScriptReadable())
       {
@@ -102,21 +119,21 @@ int Object::index(lua_State* L, ::Object& object)
       else
         lua_pushnil(L);
     }
-    else if(auto* vectorProperty = dynamic_cast<AbstractVectorProperty*>(item))
+    else if(auto* vectorProperty = interfaceItemCast<AbstractVectorProperty>(item))
     {
       if(vectorProperty->isScriptReadable())
         VectorProperty::push(L, *vectorProperty);
       else
         lua_pushnil(L);
     }
-    else if(auto* method = dynamic_cast<AbstractMethod*>(item))
+    else if(auto* method = interfaceItemCast<AbstractMethod>(item))
     {
       if(method->isScriptCallable())
         Method::push(L, *method);
       else
         lua_pushnil(L);
     }
-    else if(auto* event = dynamic_cast<AbstractEvent*>(item))
+    else if(auto* event = interfaceItemCast<AbstractEvent>(item))
     {
       if(event->isScriptable())
         Event::push(L, *event);
@@ -139,7 +156,7 @@ int Object::newindex(lua_State* L, ::Object& object)
 {
   const auto key = to<std::string_view>(L, 2);
 
-  if(AbstractProperty* property = object.getProperty(key))
+  if(AbstractProperty* property = interfaceItemCast<AbstractProperty>(findItem(object, key)))
   {
     if(!property->isScriptWriteable() || !property->isWriteable())
       errorCantSetReadOnlyProperty(L);
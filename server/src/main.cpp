@@ -129,7 +129,7 @@ int main(int argc, char* argv[])
         Log::disableMemoryLogger();
 
       if(settings.enableFileLogger)
-        Log::enableFileLogger(dataDir / "log" / "traintastic.txt");
+        Log::enableFileLogger(dataDir / "log" / "traintastic.txt", std::chrono::milliseconds(settings.fileLoggerFlushInterval));
       else
         Log::disableFileLogger();
     }
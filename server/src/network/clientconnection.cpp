@@ -52,25 +52,22 @@ void ClientConnection::doRead()
 
       if(!ec)
       {
-        while(m_readBuffer.size() >= sizeof(Message::Header))
-        {
-          const Message::Header& header = *reinterpret_cast<const Message::Header*>(m_readBuffer.cdata().data());
-          if(m_readBuffer.size() >= sizeof(Message::Header) + header.dataSize)
-          {
-            auto message = std::make_shared<Message>(header);
-            if(header.dataSize != 0)
-            {
-              std::memcpy(message->data(), static_cast<const std::byte*>(m_readBuffer.cdata().data()) + sizeof(header), message->dataSize());
-            }
-            EventLoop::call(&ClientConnection::processMessage, this, message);
-            m_readBuffer.consume(sizeof(header) + header.dataSize);
-          }
-          else
+        // messages are read in place, the next read starts when the event loop is done with the buffer:
+        EventLoop::call(
+          [this, weak]()
           {
-            break;
-          }
-        }
-        doRead();
+            if(weak.expired())
+              return;
+
+            processReadBuffer();
+
+            ioContext().post(
+              [this, weak]()
+              {
+                if(!weak.expired() && m_ws->is_open())
+                  doRead();
+              });
+          });
       }
       else if(ec == boost::asio::error::eof || ec == boost::asio::error::connection_aborted || ec == boost::asio::error::connection_reset)
       {
@@ -87,16 +84,46 @@ void ClientConnection::doRead()
 void ClientConnection::doWrite()
 {
   assert(isServerThread());
+  assert(!m_writeQueue.empty());
+
+  // gather as many queued messages as fit into a single frame:
+  size_t frameSize = 0;
+  m_writeBuffers.clear();
+  const bool combineFrames = m_combineFrames;
+  for(const auto& pending : m_writeQueue)
+  {
+    if(!m_writeBuffers.empty() && (!combineFrames || frameSize + pending.message->size() > maxFrameSize))
+    {
+      break;
+    }
+    m_writeBuffers.emplace_back(**pending.message, pending.message->size());
+    frameSize += pending.message->size();
+  }
 
-  m_ws->async_write(boost::asio::buffer(**m_writeQueue.front(), m_writeQueue.front()->size()),
-    [this, weak=weak_from_this()](const boost::system::error_code& ec, std::size_t /*bytesTransferred*/)
+  m_ws->async_write(m_writeBuffers,
+    [this, weak=weak_from_this(), count=m_writeBuffers.size()](const boost::system::error_code& ec, std::size_t bytesTransferred)
     {
       if(weak.expired())
         return;
 
       if(!ec)
       {
-        m_writeQueue.pop();
+        const auto now = std::chrono::steady_clock::now();
+        uint64_t latencyMax = m_statistics.latencyMax;
+        uint64_t latencyTotal = 0;
+        for(size_t i = 0; i < count; i++)
+        {
+          const uint64_t latency = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(now - m_writeQueue.front().queued).count());
+          latencyTotal += latency;
+          latencyMax = std::max(latencyMax, latency);
+          m_writeQueue.pop_front();
+        }
+        m_statistics.messages += count;
+        m_statistics.frames++;
+        m_statistics.bytes += bytesTransferred;
+        m_statistics.latencyTotal += latencyTotal;
+        m_statistics.latencyMax = latencyMax;
+
         if(!m_writeQueue.empty())
           doWrite();
       }
@@ -108,21 +135,41 @@ void ClientConnection::doWrite()
     });
 }
 
-void ClientConnection::processMessage(const std::shared_ptr<Message> message)
+void ClientConnection::processReadBuffer()
+{
+  assert(isEventLoopThread());
+
+  const auto data = std::span<const uint8_t>(static_cast<const uint8_t*>(m_readBuffer.cdata().data()), m_readBuffer.size());
+  m_readBuffer.consume(Message::splitFrame(data,
+    [this](std::span<const uint8_t> message)
+    {
+      processMessage(Message(message));
+    }));
+}
+
+void ClientConnection::processMessage(const Message& message)
 {
   assert(isEventLoopThread());
 
   if(m_authenticated && m_session)
   {
-    if(m_session->processMessage(*message))
+    if(m_session->processMessage(message))
       return;
   }
   else if(m_authenticated && !m_session)
   {
-    if(message->command() == Message::Command::NewSession && message->type() == Message::Type::Request)
+    if(message.command() == Message::Command::NewSession && message.type() == Message::Type::Request)
     {
       m_session = std::make_shared<Session>(std::dynamic_pointer_cast<ClientConnection>(shared_from_this()));
-      auto response = Message::newResponse(message->command(), message->requestId());
+      if(!message.endOfMessage()) // older clients don't send capabilities
+      {
+        const auto capabilities = message.read<uint32_t>();
+        m_session->m_itemIndex = (capabilities & Message::capabilityItemIndex) != 0;
+        m_combineFrames = (capabilities & Message::capabilityCombinedFrames) != 0;
+        m_session->m_serverLogSequenced = (capabilities & Message::capabilityServerLogSequence) != 0;
+        m_session->m_tableModelRowRemoved = (capabilities & Message::capabilityTableModelRowRemoved) != 0;
+      }
+      auto response = Message::newResponse(message.command(), message.requestId());
       response->write(m_session->uuid());
       m_session->writeObject(*response, Traintastic::instance);
       sendMessage(std::move(response));
@@ -131,18 +178,18 @@ void ClientConnection::processMessage(const std::shared_ptr<Message> message)
   }
   else
   {
-    if(message->command() == Message::Command::Login && message->type() == Message::Type::Request)
+    if(message.command() == Message::Command::Login && message.type() == Message::Type::Request)
     {
       m_authenticated = true; // oke for now, login can be added later :)
-      sendMessage(Message::newResponse(message->command(), message->requestId()));
+      sendMessage(Message::newResponse(message.command(), message.requestId()));
       return;
     }
   }
 
-  if(message->type() == Message::Type::Request)
+  if(message.type() == Message::Type::Request)
   {
     //assert(false);
-    sendMessage(Message::newErrorResponse(message->command(), message->requestId(), LogMessage::C1014_INVALID_COMMAND));
+    sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1014_INVALID_COMMAND));
   }
 }
 
@@ -150,14 +197,37 @@ void ClientConnection::sendMessage(std::unique_ptr<Message> message)
 {
   assert(isEventLoopThread());
 
+  if(m_sendBatch.empty())
+  {
+    // all messages send before the event loop processes the flush end up in the same batch:
+    m_sendBatchQueued = std::chrono::steady_clock::now();
+    EventLoop::call(
+      [this, weak=weak_from_this()]()
+      {
+        if(!weak.expired())
+          flushSendBatch();
+      });
+  }
+  m_sendBatch.emplace_back(std::move(message));
+}
+
+void ClientConnection::flushSendBatch()
+{
+  assert(isEventLoopThread());
+
+  if(m_sendBatch.empty())
+    return;
+
   ioContext().post(
-    [this, msg=std::make_shared<std::unique_ptr<Message>>(std::move(message))]()
+    [this, batch=std::make_shared<std::vector<std::unique_ptr<Message>>>(std::move(m_sendBatch)), queued=m_sendBatchQueued]()
     {
       const bool wasEmpty = m_writeQueue.empty();
-      m_writeQueue.emplace(std::move(*msg));
+      for(auto& message : *batch)
+        m_writeQueue.emplace_back(PendingMessage{std::move(message), queued});
       if(wasEmpty)
         doWrite();
     });
+  m_sendBatch.clear(); // moved from, make sure it is empty
 }
 
 void ClientConnection::disconnect()
@@ -166,5 +236,11 @@ void ClientConnection::disconnect()
 
   m_session.reset();
 
+  if(const uint64_t messages = m_statistics.messages; messages != 0)
+  {
+    Log::log(id, LogMessage::D1004_SENT_X_MESSAGES_IN_X_FRAMES_X_BYTES_AVERAGE_LATENCY_X_US_MAX_X_US,
+      messages, m_statistics.frames.load(), m_statistics.bytes.load(), m_statistics.latencyTotal / messages, m_statistics.latencyMax.load());
+  }
+
   WebSocketConnection::disconnect();
 }
@@ -24,7 +24,10 @@
 #define TRAINTASTIC_SERVER_NETWORK_CLIENTCONNECTION_HPP
 
 #include <memory>
-#include <queue>
+#include <deque>
+#include <vector>
+#include <atomic>
+#include <chrono>
 #include <boost/asio.hpp>
 #include <boost/beast/core/tcp_stream.hpp>
 #include <boost/beast/websocket/stream.hpp>
@@ -38,25 +41,54 @@ class ClientConnection : public WebSocketConnection
 {
   friend class Session;
 
+  public:
+    struct Statistics
+    {
+      std::atomic<uint64_t> messages = 0;
+      std::atomic<uint64_t> frames = 0;
+      std::atomic<uint64_t> bytes = 0;
+      std::atomic<uint64_t> latencyTotal = 0; //!< sum of queue to wire latency of all messages in microseconds
+      std::atomic<uint64_t> latencyMax = 0; //!< in microseconds
+    };
+
   protected:
     using ObjectHandle = uint32_t;
 
+    //! Messages are combined into a single websocket frame up to this size,
+    //! a larger message is always sent in a frame of its own.
+    //! Only if the client supports Message::capabilityCombinedFrames.
+    static constexpr size_t maxFrameSize = 64 * 1024;
+
+    struct PendingMessage
+    {
+      std::unique_ptr<Message> message;
+      std::chrono::steady_clock::time_point queued;
+    };
+
     boost::beast::flat_buffer m_readBuffer;
-    std::mutex m_writeQueueMutex;
-    std::queue<std::unique_ptr<Message>> m_writeQueue;
+    std::vector<std::unique_ptr<Message>> m_sendBatch; // event loop thread only
+    std::chrono::steady_clock::time_point m_sendBatchQueued;
+    std::deque<PendingMessage> m_writeQueue; // server thread only
+    std::vector<boost::asio::const_buffer> m_writeBuffers;
     bool m_authenticated;
+    std::atomic_bool m_combineFrames = false; //!< client supports Message::capabilityCombinedFrames
     std::shared_ptr<Session> m_session;
+    Statistics m_statistics;
 
     void doRead() final;
     void doWrite() final;
 
-    void processMessage(const std::shared_ptr<Message> message);
+    void processReadBuffer();
+    void processMessage(const Message& message);
     void sendMessage(std::unique_ptr<Message> message);
+    void flushSendBatch();
 
   public:
     ClientConnection(Server& server, std::shared_ptr<boost::beast::websocket::stream<boost::beast::tcp_stream>> ws);
     virtual ~ClientConnection();
 
+    const Statistics& statistics() const { return m_statistics; }
+
     void disconnect() final;
 };
 
@@ -93,6 +93,18 @@ class HandleList
       }
     }
 
+    //! Lookup handle without incrementing the handle counter
+    Handle findHandle(const Titem& item) const
+    {
+      if(item)
+      {
+        auto it = m_itemToHandle.find(item);
+        if(it != m_itemToHandle.end())
+          return it->second;
+      }
+      return invalidHandle;
+    }
+
     Handle getHandle(const Titem& item)
     {
       if(item)
@@ -26,9 +26,7 @@
 #include "clientconnection.hpp"
 #include <traintastic/enum/interfaceitemtype.hpp>
 #include <traintastic/enum/attributetype.hpp>
-#ifndef NDEBUG
-  #include "../core/eventloop.hpp" // for: isEventLoopThread()
-#endif
+#include "../core/eventloop.hpp"
 #include "../core/abstractobjectlist.hpp"
 #include "../core/abstractunitproperty.hpp"
 #include "../core/objectproperty.tpp"
@@ -61,7 +59,9 @@ std::pair<std::string_view, std::string_view> splitOnLastDot(std::string_view sv
 
 Session::Session(const std::shared_ptr<ClientConnection>& connection) :
   m_connection{connection},
-  m_uuid{boost::uuids::random_generator()()}
+  m_uuid{boost::uuids::random_generator()()},
+  m_changedPropertiesTimer{EventLoop::ioContext()},
+  m_serverLogTimer{EventLoop::ioContext()}
 {
   assert(isEventLoopThread());
 }
@@ -70,6 +70,8 @@ Session::~Session()
 {
   assert(isEventLoopThread());
 
+  m_changedPropertiesTimer.cancel();
+  m_serverLogTimer.cancel();
   m_objectSignals.clear(); // disconnect all, we don't want m_handles modified during the loop
   for(const auto& it : m_handles)
   {
@@ -80,6 +82,35 @@ Session::~Session()
   }
 }
 
+template<class T>
+T* Session::findItem(Handle handle, const Object& object, std::string_view name)
+{
+  auto& [cachedHandle, cachedSlot] = m_itemSlots[handle % m_itemSlots.size()];
+  if(cachedHandle != handle)
+  {
+    cachedHandle = handle;
+    cachedSlot = InterfaceItems::noSlot;
+  }
+  return interfaceItemCast<T>(object.interfaceItems().find(name, cachedSlot));
+}
+
+template<class T>
+T* Session::findItem(const Object& object, uint16_t slot)
+{
+  const auto& items = object.interfaceItems();
+  if(slot >= items.size())
+    return nullptr;
+  return interfaceItemCast<T>(&items[slot]);
+}
+
+template<class T>
+T* Session::readItem(Handle handle, const Object& object, const Message& message)
+{
+  if(message.command() == Message::Command::ObjectSetPropertyByIndex)
+    return findItem<T>(object, message.read<uint16_t>());
+  return findItem<T>(handle, object, message.read<std::string_view>());
+}
+
 bool Session::processMessage(const Message& message)
 {
   switch(message.command())
@@ -126,11 +157,11 @@ bool Session::processMessage(const Message& message)
       {
         auto response = Message::newResponse(message.command(), message.requestId());
         writeObject(*response, obj);
-        m_connection->sendMessage(std::move(response));
+        sendMessage(std::move(response));
       }
       else
       {
-        m_connection->sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1015_UNKNOWN_OBJECT));
+        sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1015_UNKNOWN_OBJECT));
       }
       return true;
     }
@@ -149,6 +180,7 @@ bool Session::processMessage(const Message& message)
         }
 
         m_handles.removeHandle(handle);
+        removeChangedProperties(handle);
 
         auto it = m_objectSignals.find(handle);
         while(it != m_objectSignals.end())
@@ -160,17 +192,19 @@ bool Session::processMessage(const Message& message)
 
         auto event = Message::newEvent(message.command(), sizeof(Handle));
         event->write(handle);
-        m_connection->sendMessage(std::move(event));
+        sendMessage(std::move(event));
       }
       break;
     }
     case Message::Command::ObjectSetProperty:
+    case Message::Command::ObjectSetPropertyByIndex:
     {
       if(message.isRequest() || message.isEvent())
       {
-        if(ObjectPtr object = m_handles.getItem(message.read<Handle>()))
+        const auto handle = message.read<Handle>();
+        if(ObjectPtr object = m_handles.getItem(handle))
         {
-          if(AbstractProperty* property = object->getProperty(message.read<std::string>()); property && !property->isInternal())
+          if(AbstractProperty* property = readItem<AbstractProperty>(handle, *object, message); property && !property->isInternal())
           {
             try
             {
@@ -200,23 +234,23 @@ bool Session::processMessage(const Message& message)
             {
               if(message.isRequest()) // send error response
               {
-                m_connection->sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1018_EXCEPTION_X, e.what()));
+                sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1018_EXCEPTION_X, e.what()));
               }
               else // send changed event with current value:
                 objectPropertyChanged(*property);
             }
 
             if(message.isRequest()) // send success response
-              m_connection->sendMessage(Message::newResponse(message.command(), message.requestId()));
+              sendMessage(Message::newResponse(message.command(), message.requestId()));
           }
           else if(message.isRequest()) // send error response
           {
-            m_connection->sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1016_UNKNOWN_PROPERTY));
+            sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1016_UNKNOWN_PROPERTY));
           }
         }
         else if(message.isRequest()) // send error response
         {
-          m_connection->sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1015_UNKNOWN_OBJECT));
+          sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1015_UNKNOWN_OBJECT));
         }
       }
       return true;
@@ -225,9 +259,10 @@ bool Session::processMessage(const Message& message)
     {
       if(message.isRequest() || message.isEvent())
       {
-        if(ObjectPtr object = m_handles.getItem(message.read<Handle>()))
+        const auto handle = message.read<Handle>();
+        if(ObjectPtr object = m_handles.getItem(handle))
         {
-          if(AbstractVectorProperty* property = object->getVectorProperty(message.read<std::string>()); property && !property->isInternal())
+          if(AbstractVectorProperty* property = findItem<AbstractVectorProperty>(handle, *object, message.read<std::string_view>()); property && !property->isInternal())
           {
             try
             {
@@ -259,32 +294,33 @@ bool Session::processMessage(const Message& message)
             {
               if(message.isRequest()) // send error response
               {
-                m_connection->sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1018_EXCEPTION_X, e.what()));
+                sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1018_EXCEPTION_X, e.what()));
               }
               else // send changed event with current value:
                 objectPropertyChanged(*property);
             }
 
             if(message.isRequest()) // send success response
-              m_connection->sendMessage(Message::newResponse(message.command(), message.requestId()));
+              sendMessage(Message::newResponse(message.command(), message.requestId()));
           }
           else if(message.isRequest()) // send error response
           {
-            m_connection->sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1016_UNKNOWN_PROPERTY));
+            sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1016_UNKNOWN_PROPERTY));
           }
         }
         else if(message.isRequest()) // send error response
         {
-          m_connection->sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1015_UNKNOWN_OBJECT));
+          sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1015_UNKNOWN_OBJECT));
         }
       }
       return true;
     }
     case Message::Command::ObjectSetUnitPropertyUnit:
     {
-      if(ObjectPtr object = m_handles.getItem(message.read<Handle>()))
+      const auto handle = message.read<Handle>();
+      if(ObjectPtr object = m_handles.getItem(handle))
       {
-        if(AbstractUnitProperty* property = dynamic_cast<AbstractUnitProperty*>(object->getProperty(message.read<std::string>())); property && !property->isInternal())
+        if(AbstractUnitProperty* property = findItem<AbstractUnitProperty>(handle, *object, message.read<std::string_view>()); property && !property->isInternal())
         {
           try
           {
@@ -302,24 +338,25 @@ bool Session::processMessage(const Message& message)
     case Message::Command::ObjectGetObjectPropertyObject:
       if(message.isRequest())
       {
-        if(ObjectPtr object = m_handles.getItem(message.read<Handle>()))
+        const auto handle = message.read<Handle>();
+        if(ObjectPtr object = m_handles.getItem(handle))
         {
-          if(auto* property = object->getObjectProperty(message.read<std::string>()); property && !property->isInternal())
+          if(auto* property = findItem<AbstractObjectProperty>(handle, *object, message.read<std::string_view>()); property && !property->isInternal())
           {
             if(auto obj = property->toObject())
             {
               auto response = Message::newResponse(message.command(), message.requestId());
               writeObject(*response, obj);
-              m_connection->sendMessage(std::move(response));
+              sendMessage(std::move(response));
             }
             else
-              m_connection->sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1015_UNKNOWN_OBJECT));
+              sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1015_UNKNOWN_OBJECT));
           }
           else // send error response
-            m_connection->sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1016_UNKNOWN_PROPERTY));
+            sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1016_UNKNOWN_PROPERTY));
         }
         else // send error response
-          m_connection->sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1015_UNKNOWN_OBJECT));
+          sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1015_UNKNOWN_OBJECT));
 
         return true;
       }
@@ -328,9 +365,10 @@ bool Session::processMessage(const Message& message)
     case Message::Command::ObjectGetObjectVectorPropertyObject:
       if(message.isRequest())
       {
-        if(ObjectPtr object = m_handles.getItem(message.read<Handle>()))
+        const auto handle = message.read<Handle>();
+        if(ObjectPtr object = m_handles.getItem(handle))
         {
-          if(auto* property = object->getVectorProperty(message.read<std::string>()); property && !property->isInternal())
+          if(auto* property = findItem<AbstractVectorProperty>(handle, *object, message.read<std::string_view>()); property && !property->isInternal())
           {
             const size_t startIndex = message.read<uint32_t>();
             const size_t endIndex = message.read<uint32_t>();
@@ -340,16 +378,16 @@ bool Session::processMessage(const Message& message)
               auto response = Message::newResponse(message.command(), message.requestId());
               for(size_t i = startIndex; i <= endIndex; i++)
                 writeObject(*response, property->getObject(i));
-              m_connection->sendMessage(std::move(response));
+              sendMessage(std::move(response));
             }
             else // send error response
-              m_connection->sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1017_INVALID_INDICES));
+              sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1017_INVALID_INDICES));
           }
           else // send error response
-            m_connection->sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1016_UNKNOWN_PROPERTY));
+            sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1016_UNKNOWN_PROPERTY));
         }
         else // send error response
-          m_connection->sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1015_UNKNOWN_OBJECT));
+          sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1015_UNKNOWN_OBJECT));
 
         return true;
       }
@@ -357,9 +395,10 @@ bool Session::processMessage(const Message& message)
 
     case Message::Command::ObjectSetObjectPropertyById:
     {
-      if(ObjectPtr object = m_handles.getItem(message.read<Handle>()))
+      const auto handle = message.read<Handle>();
+      if(ObjectPtr object = m_handles.getItem(handle))
       {
-        if(AbstractObjectProperty* property = dynamic_cast<AbstractObjectProperty*>(object->getProperty(message.read<std::string>())); property && !property->isInternal())
+        if(AbstractObjectProperty* property = findItem<AbstractObjectProperty>(handle, *object, message.read<std::string_view>()); property && !property->isInternal())
         {
           try
           {
@@ -385,9 +424,10 @@ bool Session::processMessage(const Message& message)
     }
     case Message::Command::ObjectCallMethod:
     {
-      if(ObjectPtr object = m_handles.getItem(message.read<Handle>()))
+      const auto handle = message.read<Handle>();
+      if(ObjectPtr object = m_handles.getItem(handle))
       {
-        if(AbstractMethod* method = object->getMethod(message.read<std::string>()); method && !method->isInternal())
+        if(AbstractMethod* method = findItem<AbstractMethod>(handle, *object, message.read<std::string_view>()); method && !method->isInternal())
         {
           if(callMethod(message, *method))
           {
@@ -427,7 +467,7 @@ bool Session::processMessage(const Message& message)
           assert(model);
           auto response = Message::newResponse(message.command(), message.requestId());
           writeTableModel(*response, model);
-          m_connection->sendMessage(std::move(response));
+          sendMessage(std::move(response));
 
           model->columnHeadersChanged = [this](const TableModelPtr& tableModel)
             {
@@ -436,15 +476,15 @@ bool Session::processMessage(const Message& message)
               event->write(tableModel->columnCount());
               for(const auto& text : tableModel->columnHeaders())
                 event->write(text);
-              m_connection->sendMessage(std::move(event));
+              sendMessage(std::move(event));
             };
 
           model->rowCountChanged = [this](const TableModelPtr& tableModel)
             {
-              auto event = Message::newEvent(Message::Command::TableModelRowCountChanged);
+              auto event = Message::newEvent(Message::Command::TableModelRowCountChanged, sizeof(Handle) + sizeof(uint32_t));
               event->write(m_handles.getHandle(std::dynamic_pointer_cast<Object>(tableModel)));
               event->write(tableModel->rowCount());
-              m_connection->sendMessage(std::move(event));
+              sendMessage(std::move(event));
             };
 
           model->updateRegion = [this](const TableModelPtr& tableModel, const TableModel::Region& region)
@@ -460,13 +500,24 @@ bool Session::processMessage(const Message& message)
                 for(uint32_t column = region.columnMin; column <= region.columnMax; column++)
                   event->write(tableModel->getText(column, row));
 
-              m_connection->sendMessage(std::move(event));
+              sendMessage(std::move(event));
             };
 
+          if(m_tableModelRowRemoved) // else the model sends a row count change and region update
+          {
+            model->rowRemoved = [this](const TableModelPtr& tableModel, uint32_t row)
+              {
+                auto event = Message::newEvent(Message::Command::TableModelRowRemoved, sizeof(Handle) + sizeof(uint32_t));
+                event->write(m_handles.getHandle(std::dynamic_pointer_cast<Object>(tableModel)));
+                event->write(row);
+                sendMessage(std::move(event));
+              };
+          }
+
           return true;
         }
       }
-      m_connection->sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1019_OBJECT_NOT_A_TABLE));
+      sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1019_OBJECT_NOT_A_TABLE));
       return true;
     }
     case Message::Command::ReleaseTableModel:
@@ -501,7 +552,7 @@ bool Session::processMessage(const Message& message)
           response->write(info.used);
           response->write(info.value);
         }
-        m_connection->sendMessage(std::move(response));
+        sendMessage(std::move(response));
         return true;
       }
       break;
@@ -535,7 +586,7 @@ bool Session::processMessage(const Message& message)
               break;
           }
         }
-        m_connection->sendMessage(std::move(response));
+        sendMessage(std::move(response));
         return true;
       }
       break;
@@ -557,7 +608,7 @@ bool Session::processMessage(const Message& message)
           if(tile.data().isActive())
             writeObject(*response, it.second);
         }
-        m_connection->sendMessage(std::move(response));
+        sendMessage(std::move(response));
         return true;
       }
       break;
@@ -576,7 +627,7 @@ bool Session::processMessage(const Message& message)
         response->write(item.menu);
         response->writeBlockEnd();
       }
-      m_connection->sendMessage(std::move(response));
+      sendMessage(std::move(response));
       return true;
     }
     case Message::Command::ServerLog:
@@ -584,12 +635,27 @@ bool Session::processMessage(const Message& message)
       {
         if(auto* logger = Log::getMemoryLogger())
         {
-          m_memoryLoggerChanged = logger->changed.connect(std::bind(&Session::memoryLoggerChanged, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
-          memoryLoggerChanged(*logger, logger->size(), 0);
+          // the client sends what it already has, so it only receives what it has missed,
+          // older clients don't send it and receive the full log:
+          m_serverLogSequence = logger->firstSequence();
+          m_serverLogClientFirst = m_serverLogSequence;
+          if(m_serverLogSequenced && !message.endOfMessage())
+          {
+            const auto logId = message.read<uint64_t>();
+            const auto sequence = message.read<uint64_t>();
+            if(logId == logger->logId() && sequence <= logger->nextSequence())
+              m_serverLogSequence = sequence;
+          }
+          m_memoryLoggerChanged = logger->changed.connect(std::bind(&Session::memoryLoggerChanged, this, std::placeholders::_1));
+          sendServerLog();
         }
       }
       else // disable
+      {
         m_memoryLoggerChanged.disconnect();
+        m_serverLogTimer.cancel();
+        m_serverLogPending = false;
+      }
       break;
 
     case Message::Command::ImportWorld:
@@ -600,11 +666,11 @@ bool Session::processMessage(const Message& message)
           std::vector<std::byte> worldData;
           message.read(worldData);
           Traintastic::instance->importWorld(worldData);
-          m_connection->sendMessage(Message::newResponse(message.command(), message.requestId()));
+          sendMessage(Message::newResponse(message.command(), message.requestId()));
         }
         catch(const LogMessageException& e)
         {
-          m_connection->sendMessage(Message::newErrorResponse(message.command(), message.requestId(), e.message(), e.args()));
+          sendMessage(Message::newErrorResponse(message.command(), message.requestId(), e.message(), e.args()));
         }
       }
       break;
@@ -620,16 +686,16 @@ bool Session::processMessage(const Message& message)
             Traintastic::instance->world->export_(worldData);
             auto response = Message::newResponse(message.command(), message.requestId());
             response->write(worldData);
-            m_connection->sendMessage(std::move(response));
+            sendMessage(std::move(response));
           }
           catch(const LogMessageException& e)
           {
-            m_connection->sendMessage(Message::newErrorResponse(message.command(), message.requestId(), e.message(), e.args()));
+            sendMessage(Message::newErrorResponse(message.command(), message.requestId(), e.message(), e.args()));
           }
         }
         else
         {
-          m_connection->sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1010_EXPORTING_WORLD_FAILED_X, "nullptr"));
+          sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1010_EXPORTING_WORLD_FAILED_X, "nullptr"));
         }
         return true;
       }
@@ -646,16 +712,16 @@ bool Session::processMessage(const Message& message)
             auto throttle = ClientThrottle::create(*Traintastic::instance->world);
             auto response = message.response();
             writeObject(*response, throttle);
-            m_connection->sendMessage(std::move(response));
+            sendMessage(std::move(response));
           }
           else
           {
-            m_connection->sendMessage(message.errorResponse(LogMessage::C1015_UNKNOWN_OBJECT)); // FIXME change error
+            sendMessage(message.errorResponse(LogMessage::C1015_UNKNOWN_OBJECT)); // FIXME change error
           }
         }
         else
         {
-          m_connection->sendMessage(message.errorResponse(LogMessage::C1015_UNKNOWN_OBJECT)); // FIXME change error
+          sendMessage(message.errorResponse(LogMessage::C1015_UNKNOWN_OBJECT)); // FIXME change error
         }
         return true;
       }
@@ -678,21 +744,21 @@ bool Session::processMessage(const Message& message)
               {
                 writeObject(*response, list->getObject(i));
               }
-              m_connection->sendMessage(std::move(response));
+              sendMessage(std::move(response));
             }
             else // send error response
             {
-              m_connection->sendMessage(message.errorResponse(LogMessage::C1017_INVALID_INDICES));
+              sendMessage(message.errorResponse(LogMessage::C1017_INVALID_INDICES));
             }
           }
           else
           {
-            m_connection->sendMessage(message.errorResponse(LogMessage::C1015_UNKNOWN_OBJECT));
+            sendMessage(message.errorResponse(LogMessage::C1015_UNKNOWN_OBJECT));
           }
         }
         else
         {
-          m_connection->sendMessage(message.errorResponse(LogMessage::C1015_UNKNOWN_OBJECT));
+          sendMessage(message.errorResponse(LogMessage::C1015_UNKNOWN_OBJECT));
         }
         return true;
       }
@@ -796,7 +862,7 @@ bool Session::callMethod(const Message& message, AbstractMethod& method)
           break;
       }
 
-      m_connection->sendMessage(std::move(response));
+      sendMessage(std::move(response));
       return true;
     }
   }
@@ -804,7 +870,7 @@ bool Session::callMethod(const Message& message, AbstractMethod& method)
   {
     if(message.isRequest())
     {
-      m_connection->sendMessage(Message::newErrorResponse(message.command(), message.requestId(), e.message(), e.args()));
+      sendMessage(Message::newErrorResponse(message.command(), message.requestId(), e.message(), e.args()));
       return true;
     }
     // we can't report it back to the caller, so just log it.
@@ -814,7 +880,7 @@ bool Session::callMethod(const Message& message, AbstractMethod& method)
   {
     if(message.isRequest())
     {
-      m_connection->sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1018_EXCEPTION_X, e.what()));
+      sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1018_EXCEPTION_X, e.what()));
       return true;
     }
   }
@@ -847,31 +913,31 @@ void Session::writeObject(Message& message, const ObjectPtr& object)
     message.write(object->getClassId());
 
     message.writeBlock(); // items
-    const InterfaceItems& interfaceItems = object->interfaceItems();
-    for(const auto& name : interfaceItems.names())
+    const auto& items = object->interfaceItems();
+    for(uint16_t slot = 0; slot < items.size(); slot++)
     {
-      InterfaceItem& item = interfaceItems[name];
+      InterfaceItem& item = items[slot];
 
       if(item.isInternal())
         continue;
 
       message.writeBlock(); // item
-      message.write(name);
+      message.write(item.name());
 
-      if(auto* baseProperty = dynamic_cast<BaseProperty*>(&item))
+      if(auto* baseProperty = interfaceItemCast<BaseProperty>(&item))
       {
         AbstractProperty* property = nullptr;
         AbstractUnitProperty* unitProperty = nullptr;
         AbstractVectorProperty* vectorProperty = nullptr;
 
-        if((property = dynamic_cast<AbstractProperty*>(baseProperty)))
+        if((property = interfaceItemCast<AbstractProperty>(baseProperty)))
         {
-          if((unitProperty = dynamic_cast<AbstractUnitProperty*>(property)))
+          if((unitProperty = interfaceItemCast<AbstractUnitProperty>(property)))
             message.write(InterfaceItemType::UnitProperty);
           else
             message.write(InterfaceItemType::Property);
         }
-        else if((vectorProperty = dynamic_cast<AbstractVectorProperty*>(baseProperty)))
+        else if((vectorProperty = interfaceItemCast<AbstractVectorProperty>(baseProperty)))
           message.write(InterfaceItemType::VectorProperty);
         else
         {
@@ -902,7 +968,7 @@ void Session::writeObject(Message& message, const ObjectPtr& object)
         else
           assert(false);
       }
-      else if(const auto* method = dynamic_cast<const AbstractMethod*>(&item))
+      else if(const auto* method = interfaceItemCast<AbstractMethod>(&item))
       {
         message.write(InterfaceItemType::Method);
         message.write(method->resultTypeInfo().type);
@@ -910,7 +976,7 @@ void Session::writeObject(Message& message, const ObjectPtr& object)
         for(const auto& info : method->argumentTypeInfo())
           message.write(info.type);
       }
-      else if(const auto* event = dynamic_cast<const AbstractEvent*>(&item))
+      else if(const auto* event = interfaceItemCast<AbstractEvent>(&item))
       {
         hasPublicEvents = true;
 
@@ -933,6 +999,10 @@ void Session::writeObject(Message& message, const ObjectPtr& object)
       }
 
       message.writeBlockEnd(); // end attributes
+
+      if(m_itemIndex) // older clients skip it
+        message.write(slot);
+
       message.writeBlockEnd(); // end item
     }
     message.writeBlockEnd(); // end items
@@ -960,37 +1030,101 @@ void Session::writeTableModel(Message& message, const TableModelPtr& model)
   message.writeBlockEnd(); // end model
 }
 
-void Session::memoryLoggerChanged(const MemoryLogger& logger, const uint32_t added, const uint32_t removed)
+void Session::memoryLoggerChanged(const MemoryLogger& /*logger*/)
+{
+  if(!m_serverLogSequenced) // older clients expect an event per change
+  {
+    sendServerLog();
+    return;
+  }
+
+  // Logs are collected and send in batches at a fixed interval,
+  // a busy log would otherwise result in a message per log line.
+  if(m_serverLogPending)
+    return;
+
+  m_serverLogPending = true;
+  m_serverLogTimer.expires_after(serverLogInterval);
+  m_serverLogTimer.async_wait(
+    [weak=weak_from_this()](const boost::system::error_code& ec)
+    {
+      if(auto session = weak.lock(); session && !ec)
+      {
+        session->m_serverLogPending = false;
+        session->sendServerLog();
+      }
+    });
+}
+
+void Session::sendServerLog()
 {
-  auto event = Message::newEvent(Message::Command::ServerLog);
-  event->write(removed);
-  event->write(added);
+  const auto* logger = Log::getMemoryLogger();
+  if(!logger)
+    return;
 
-  const uint32_t size = logger.size();
-  for(uint32_t i = size - added; i < size; i++)
+  // older clients don't know sequences, they must be told how many logs to remove from the front:
+  uint32_t removed = 0;
+  if(!m_serverLogSequenced)
   {
-    const auto& log = logger[i];
-    event->write((std::chrono::duration_cast<std::chrono::microseconds>(log.time.time_since_epoch())).count());
-    event->write(log.objectId);
-    event->write(log.message);
-    const size_t argc = log.args ? std::min<size_t>(log.args->size(), std::numeric_limits<uint8_t>::max()) : 0;
-    event->write(static_cast<uint8_t>(argc));
-    for(size_t j = 0; j < argc; j++)
-      event->write(log.args->at(j));
+    const uint64_t clientFirst = std::max(m_serverLogClientFirst, logger->firstSequence());
+    removed = static_cast<uint32_t>(std::min(clientFirst, m_serverLogSequence) - m_serverLogClientFirst);
+    m_serverLogClientFirst = clientFirst;
   }
 
-  m_connection->sendMessage(std::move(event));
+  // skip logs that are already overwritten, the client removes them too:
+  m_serverLogSequence = std::max(m_serverLogSequence, logger->firstSequence());
+
+  do
+  {
+    const auto count = static_cast<uint32_t>(std::min<uint64_t>(logger->nextSequence() - m_serverLogSequence, serverLogBatchSizeMax));
+
+    auto event = Message::newEvent(Message::Command::ServerLog);
+    if(m_serverLogSequenced)
+    {
+      event->write(logger->logId());
+      event->write(logger->firstSequence());
+      event->write(m_serverLogSequence);
+    }
+    else
+    {
+      event->write(removed);
+      removed = 0;
+    }
+    event->write(count);
+    for(uint32_t i = 0; i < count; i++)
+    {
+      const auto& log = (*logger)[m_serverLogSequence++];
+      event->write((std::chrono::duration_cast<std::chrono::microseconds>(log.time.time_since_epoch())).count());
+      event->write(logger->objectId(log));
+      event->write(log.message);
+      event->write(log.args.size());
+      for(uint8_t j = 0; j < log.args.size(); j++)
+        event->write(log.args[j]);
+    }
+    sendMessage(std::move(event));
+  }
+  while(m_serverLogSequence != logger->nextSequence());
+}
+
+void Session::sendMessage(std::unique_ptr<Message> message)
+{
+  // Pending property changes happened before this message, send them first to keep the order:
+  if(!m_changedProperties.empty())
+    sendChangedProperties();
+
+  m_connection->sendMessage(std::move(message));
 }
 
 void Session::objectDestroying(Object& object)
 {
   const auto handle = m_handles.getHandle(object.shared_from_this());
   m_handles.removeHandle(handle);
+  removeChangedProperties(handle);
   m_objectSignals.erase(handle);
 
   auto event = Message::newEvent(Message::Command::ObjectDestroyed, sizeof(Handle));
   event->write(handle);
-  m_connection->sendMessage(std::move(event));
+  sendMessage(std::move(event));
 }
 
 void Session::objectPropertyChanged(BaseProperty& baseProperty)
@@ -998,18 +1132,96 @@ void Session::objectPropertyChanged(BaseProperty& baseProperty)
   if(baseProperty.isInternal())
     return;
 
-  auto event = Message::newEvent(Message::Command::ObjectPropertyChanged);
-  event->write(m_handles.getHandle(baseProperty.object().shared_from_this()));
-  event->write(baseProperty.name());
-  event->write(baseProperty.type());
-  if(auto* property = dynamic_cast<AbstractProperty*>(&baseProperty))
+  // Changes are collected and send at a fixed interval, only the latest value is send.
+  // This prevents slow clients from falling behind on fast changing properties.
+  if(!m_changedPropertiesSet.emplace(&baseProperty).second)
+    return; // already pending
+
+  const bool schedule = m_changedProperties.empty();
+  m_changedProperties.emplace_back(m_handles.findHandle(baseProperty.object().shared_from_this()), &baseProperty);
+
+  if(schedule)
+  {
+    const auto interval = std::chrono::milliseconds(Traintastic::instance->settings->propertyChangeInterval.value());
+    if(interval.count() == 0)
+    {
+      EventLoop::call(
+        [weak=weak_from_this()]()
+        {
+          if(auto session = weak.lock())
+            session->sendChangedProperties();
+        });
+    }
+    else
+    {
+      m_changedPropertiesTimer.expires_after(interval);
+      m_changedPropertiesTimer.async_wait(
+        [weak=weak_from_this()](const boost::system::error_code& ec)
+        {
+          if(auto session = weak.lock(); session && !ec)
+            session->sendChangedProperties();
+        });
+    }
+  }
+}
+
+void Session::sendChangedProperties()
+{
+  auto changedProperties = std::move(m_changedProperties);
+  m_changedProperties.clear();
+  m_changedPropertiesSet.clear();
+
+  for(const auto& [handle, property] : changedProperties)
+  {
+    assert(m_handles.getItem(handle)); // removeChangedProperties() must be called when a handle is removed
+    sendPropertyChanged(*property);
+  }
+}
+
+void Session::removeChangedProperties(Handle handle)
+{
+  if(m_changedProperties.empty())
+    return;
+
+  std::erase_if(m_changedProperties,
+    [this, handle](const auto& it)
+    {
+      if(it.first != handle)
+        return false;
+      m_changedPropertiesSet.erase(it.second);
+      return true;
+    });
+}
+
+void Session::sendPropertyChanged(BaseProperty& baseProperty)
+{
+  const Handle handle = m_handles.getHandle(baseProperty.object().shared_from_this());
+  const std::string_view name = baseProperty.name();
+  const uint16_t slot = m_itemIndex ? baseProperty.object().interfaceItems().slot(name) : InterfaceItems::noSlot;
+  const ValueType type = baseProperty.type();
+  std::unique_ptr<Message> event;
+  // reserve room for a numeric value, most properties are:
+  if(slot != InterfaceItems::noSlot)
+  {
+    event = Message::newEvent(Message::Command::ObjectPropertyChangedByIndex, Message::writeSize(handle, slot, type, int64_t{0}));
+    event->write(handle);
+    event->write(slot);
+  }
+  else
+  {
+    event = Message::newEvent(Message::Command::ObjectPropertyChanged, Message::writeSize(handle, name, type, int64_t{0}));
+    event->write(handle);
+    event->write(name);
+  }
+  event->write(type);
+  if(auto* property = interfaceItemCast<AbstractProperty>(&baseProperty))
   {
     writePropertyValue(*event, *property);
 
-    if(auto* unitProperty = dynamic_cast<AbstractUnitProperty*>(property))
+    if(auto* unitProperty = interfaceItemCast<AbstractUnitProperty>(property))
       event->write(unitProperty->unitValue());
   }
-  else if(auto* vectorProperty = dynamic_cast<AbstractVectorProperty*>(&baseProperty))
+  else if(auto* vectorProperty = interfaceItemCast<AbstractVectorProperty>(&baseProperty))
     writeVectorPropertyValue(*event, *vectorProperty);
   else
     assert(false);
@@ -1097,18 +1309,27 @@ void Session::writeVectorPropertyValue(Message& message , const AbstractVectorPr
 
 void Session::objectAttributeChanged(AbstractAttribute& attribute)
 {
-  auto event = Message::newEvent(Message::Command::ObjectAttributeChanged);
-  event->write(m_handles.getHandle(attribute.item().object().shared_from_this()));
-  event->write(attribute.item().name());
+  const InterfaceItem& item = attribute.item();
+  const uint16_t slot = m_itemIndex ? item.object().interfaceItems().slot(item.name()) : InterfaceItems::noSlot;
+  auto event = Message::newEvent(slot != InterfaceItems::noSlot ? Message::Command::ObjectAttributeChangedByIndex : Message::Command::ObjectAttributeChanged);
+  event->write(m_handles.getHandle(item.object().shared_from_this()));
+  if(slot != InterfaceItems::noSlot)
+    event->write(slot);
+  else
+    event->write(item.name());
   writeAttribute(*event, attribute);
-  m_connection->sendMessage(std::move(event));
+  sendMessage(std::move(event));
 }
 
 void Session::objectEventFired(const AbstractEvent& event, const Arguments& arguments)
 {
-  auto message = Message::newEvent(Message::Command::ObjectEventFired);
+  const uint16_t slot = m_itemIndex ? event.object().interfaceItems().slot(event.name()) : InterfaceItems::noSlot;
+  auto message = Message::newEvent(slot != InterfaceItems::noSlot ? Message::Command::ObjectEventFiredByIndex : Message::Command::ObjectEventFired);
   message->write(m_handles.getHandle(event.object().shared_from_this()));
-  message->write(event.name());
+  if(slot != InterfaceItems::noSlot)
+    message->write(slot);
+  else
+    message->write(event.name());
   message->write(static_cast<uint32_t>(arguments.size()));
   size_t i = 0;
   for(const auto& typeInfo : event.argumentTypeInfo())
@@ -1146,7 +1367,7 @@ void Session::objectEventFired(const AbstractEvent& event, const Arguments& argu
     }
     i++;
   }
-  m_connection->sendMessage(std::move(message));
+  sendMessage(std::move(message));
 }
 
 void Session::writeAttribute(Message& message , const AbstractAttribute& attribute)
@@ -1242,5 +1463,5 @@ void Session::boardTileDataChanged(Board& board, const TileLocation& location, c
     assert(tile);
     writeObject(*event, tile);
   }
-  m_connection->sendMessage(std::move(event));
+  sendMessage(std::move(event));
 }
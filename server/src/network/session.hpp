@@ -22,9 +22,14 @@
 #ifndef TRAINTASTIC_SERVER_NETWORK_SESSION_HPP
 #define TRAINTASTIC_SERVER_NETWORK_SESSION_HPP
 
+#include <array>
 #include <memory>
+#include <vector>
+#include <unordered_set>
+#include <boost/asio/steady_timer.hpp>
 #include <boost/uuid/uuid.hpp>
 #include <boost/signals2/connection.hpp>
+#include "../core/signal.hpp"
 #include <traintastic/network/message.hpp>
 #include <traintastic/enum/tristate.hpp>
 #include "handlelist.hpp"
@@ -58,6 +63,9 @@ class Session : public std::enable_shared_from_this<Session>
     static void writeAttribute(Message& message, const AbstractAttribute& attribute);
     static void writeTypeInfo(Message& message, const TypeInfo& typeInfo);
 
+    static constexpr auto serverLogInterval = std::chrono::milliseconds(100); //!< server log deltas are sent at most once per interval
+    static constexpr uint32_t serverLogBatchSizeMax = 1000; //!< max number of server logs per message
+
     boost::signals2::scoped_connection m_memoryLoggerChanged;
 
   protected:
@@ -67,9 +75,33 @@ class Session : public std::enable_shared_from_this<Session>
     std::shared_ptr<ClientConnection> m_connection;
     boost::uuids::uuid m_uuid;
     Handles m_handles;
-    std::unordered_multimap<Handle, boost::signals2::scoped_connection> m_objectSignals;
+    std::unordered_multimap<Handle, ScopedSignalConnection> m_objectSignals;
+    std::vector<std::pair<Handle, BaseProperty*>> m_changedProperties; //!< in order of first change
+    std::unordered_set<BaseProperty*> m_changedPropertiesSet;
+    boost::asio::steady_timer m_changedPropertiesTimer;
+    uint64_t m_serverLogSequence = 0; //!< sequence number of the next server log to send
+    uint64_t m_serverLogClientFirst = 0; //!< sequence number of the oldest server log the client has, only without sequence support
+    bool m_serverLogPending = false;
+    boost::asio::steady_timer m_serverLogTimer;
+    std::array<std::pair<Handle, uint16_t>, 64> m_itemSlots{}; //!< last used item slot per handle, direct mapped
+    bool m_itemIndex = false; //!< client supports Message::capabilityItemIndex, items are addressed by slot
+    bool m_serverLogSequenced = false; //!< client supports Message::capabilityServerLogSequence
+    bool m_tableModelRowRemoved = false; //!< client supports Message::capabilityTableModelRowRemoved
+
+    //! \brief Find an interface item of object, tries the last used slot of the handle first
+    template<class T>
+    T* findItem(Handle handle, const Object& object, std::string_view name);
+
+    //! \brief Find a public interface item of object by slot as received from the client
+    template<class T>
+    static T* findItem(const Object& object, uint16_t slot);
+
+    //! \brief Read item name or slot depending on the command and find it
+    template<class T>
+    T* readItem(Handle handle, const Object& object, const Message& message);
 
     bool processMessage(const Message& message);
+    void sendMessage(std::unique_ptr<Message> message);
 
     bool isSessionObject(const ObjectPtr& object);
 
@@ -78,10 +110,14 @@ class Session : public std::enable_shared_from_this<Session>
     void writeObject(Message& message, const ObjectPtr& object);
     void writeTableModel(Message& message, const TableModelPtr& model);
 
-    void memoryLoggerChanged(const MemoryLogger& logger, uint32_t added, uint32_t removed);
+    void memoryLoggerChanged(const MemoryLogger& logger);
+    void sendServerLog();
 
     void objectDestroying(Object& object);
     void objectPropertyChanged(BaseProperty& property);
+    void sendChangedProperties();
+    void removeChangedProperties(Handle handle);
+    void sendPropertyChanged(BaseProperty& property);
     void objectAttributeChanged(AbstractAttribute& attribute);
     void objectEventFired(const AbstractEvent& event, const Arguments& arguments);
 
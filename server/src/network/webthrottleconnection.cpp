@@ -215,7 +215,7 @@ void WebThrottleConnection::processMessage(const nlohmann::json& message)
                 auto event = nlohmann::json::object();
                 event.emplace("event", name);
                 event.emplace("throttle_id", throttleId);
-                if(dynamic_cast<AbstractUnitProperty*>(&property))
+                if(interfaceItemCast<AbstractUnitProperty>(&property))
                 {
                   event.update(property.toJSON());
                 }
@@ -26,7 +26,7 @@
 #include <queue>
 #include <map>
 #include <boost/asio.hpp>
-#include <boost/signals2/connection.hpp>
+#include "../core/signal.hpp"
 #include <nlohmann/json.hpp>
 #include "websocketconnection.hpp"
 
@@ -38,10 +38,10 @@ class WebThrottleConnection : public WebSocketConnection
 protected:
   boost::beast::flat_buffer m_readBuffer;
   std::queue<std::string> m_writeQueue;
-  boost::signals2::scoped_connection m_traintasticPropertyChanged;
+  ScopedSignalConnection m_traintasticPropertyChanged;
   std::map<uint32_t, std::shared_ptr<WebThrottle>> m_throttles;
-  std::multimap<uint32_t, boost::signals2::scoped_connection> m_throttleConnections;
-  std::multimap<uint32_t, boost::signals2::scoped_connection> m_trainConnections;
+  std::multimap<uint32_t, ScopedSignalConnection> m_throttleConnections;
+  std::multimap<uint32_t, ScopedSignalConnection> m_trainConnections;
 
   void doRead() final;
   void doWrite() final;
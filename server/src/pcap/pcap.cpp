@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2023 Reinder Feenstra
+ * Copyright (C) 2023,2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -21,6 +21,7 @@
  */
 
 #include "pcap.hpp"
+#include <algorithm>
 #include <chrono>
 
 void PCAP::writeHeader(uint32_t network)
@@ -28,7 +29,7 @@ void PCAP::writeHeader(uint32_t network)
   GlobalHeader header;
   header.thiszone = 0; //! \todo set system timezone offset
   header.sigfigs = 0;
-  header.snaplen = 255;
+  header.snaplen = snapLength;
   header.network = network;
   write(&header, sizeof(header));
 }
@@ -36,7 +37,8 @@ void PCAP::writeHeader(uint32_t network)
 void PCAP::writeRecord(const void* data, uint32_t size)
 {
   const auto us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
-  RecordHeader header{static_cast<uint32_t>(us / 1'000'000), static_cast<uint32_t>(us % 1'000'000), size, size};
+  const uint32_t length = std::min(size, snapLength);
+  RecordHeader header{static_cast<uint32_t>(us / 1'000'000), static_cast<uint32_t>(us % 1'000'000), length, size};
   write(&header, sizeof(header));
-  write(data, size);
+  write(data, length);
 }
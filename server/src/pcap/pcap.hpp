@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2023 Reinder Feenstra
+ * Copyright (C) 2023,2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -26,12 +26,27 @@
 #include <cstdint>
 #include <cstdlib>
 
+//! \brief PCAP link types of the hardware protocols, DLT_USER0..15 until a link type is registered
+namespace PCAPLinkType
+{
+  constexpr uint32_t LocoNet = 147; //!< DLT_USER0
+  constexpr uint32_t Z21 = 148; //!< DLT_USER1
+  constexpr uint32_t XpressNet = 149; //!< DLT_USER2
+  constexpr uint32_t ECoS = 150; //!< DLT_USER3
+  constexpr uint32_t DCCEX = 152; //!< DLT_USER5
+  constexpr uint32_t TraintasticDIY = 153; //!< DLT_USER6
+  constexpr uint32_t MarklinCAN = 227; //!< DLT_CAN_SOCKETCAN
+}
+
 class PCAP
 {
-  private:
+  public:
+    static constexpr uint32_t magicNumber = 0xA1B2C3D4;
+    static constexpr uint32_t snapLength = 65535;
+
     struct GlobalHeader
     {
-      uint32_t magic_number = 0xA1B2C3D4;  //!< magic number
+      uint32_t magic_number = magicNumber;  //!< magic number
       uint16_t version_major = 2; //!< major version number
       uint16_t version_minor = 4; //!< minor version number
       int32_t  thiszone; //!< GMT to local correction
@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2023 Reinder Feenstra
+ * Copyright (C) 2023,2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -21,6 +21,7 @@
  */
 
 #include "pcapfile.hpp"
+#include "../utils/setthreadname.hpp"
 
 PCAPFile::PCAPFile(const std::filesystem::path& filename, uint32_t network)
 {
@@ -31,16 +32,66 @@ PCAPFile::PCAPFile(const std::filesystem::path& filename, uint32_t network)
 
   m_stream.open(filename, std::ios::binary | std::ios::out | std::ios::trunc);
 
+  m_buffer.reserve(bufferFlushSize);
   writeHeader(network);
+
+  m_thread = std::thread(&PCAPFile::run, this);
 }
 
 PCAPFile::~PCAPFile()
 {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_wakeUp.notify_one();
+  m_thread.join();
   m_stream.close();
 }
 
 void PCAPFile::write(const void* buffer, size_t size)
 {
-  m_stream.write(reinterpret_cast<const char*>(buffer), size);
-  m_stream.flush();
+  bool wakeUp;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto* bytes = reinterpret_cast<const char*>(buffer);
+    m_buffer.insert(m_buffer.end(), bytes, bytes + size);
+    wakeUp = (m_buffer.size() >= bufferFlushSize);
+  }
+  if(wakeUp)
+    m_wakeUp.notify_one();
+}
+
+void PCAPFile::run()
+{
+  setThreadName("pcap");
+
+  std::vector<char> buffer;
+  buffer.reserve(bufferFlushSize);
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  for(;;)
+  {
+    m_wakeUp.wait_for(lock, flushInterval,
+      [this]()
+      {
+        return m_stop || m_buffer.size() >= bufferFlushSize;
+      });
+
+    const bool stop = m_stop;
+    buffer.swap(m_buffer);
+    lock.unlock();
+
+    if(!buffer.empty())
+    {
+      m_stream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+      m_stream.flush();
+      buffer.clear();
+    }
+
+    if(stop)
+      break;
+
+    lock.lock();
+  }
 }
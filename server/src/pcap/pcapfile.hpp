@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2023 Reinder Feenstra
+ * Copyright (C) 2023,2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -24,13 +24,35 @@
 #define TRAINTASTIC_SERVER_PCAP_PCAPFILE_HPP
 
 #include "pcap.hpp"
+#include <chrono>
+#include <condition_variable>
 #include <filesystem>
 #include <fstream>
+#include <mutex>
+#include <thread>
+#include <vector>
 
+/**
+ * \brief PCAP capture file
+ *
+ * Records are appended to a memory buffer, a writer thread writes the buffer
+ * to disk and flushes the file. So the thread calling writeRecord(), usually
+ * a kernel thread, never waits for disk I/O.
+ */
 class PCAPFile final : public PCAP
 {
   private:
+    static constexpr auto flushInterval = std::chrono::seconds(1);
+    static constexpr size_t bufferFlushSize = 64 * 1024; //!< wake up the writer thread early if the buffer exceeds this size
+
     std::ofstream m_stream;
+    std::mutex m_mutex;
+    std::condition_variable m_wakeUp;
+    std::vector<char> m_buffer;
+    bool m_stop = false;
+    std::thread m_thread;
+
+    void run();
 
   protected:
     void write(const void* buffer, size_t size) final;
@@ -0,0 +1,92 @@
+/**
+ * server/src/pcap/pcapreader.cpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "pcapreader.hpp"
+#include <stdexcept>
+#include "pcap.hpp"
+
+static constexpr uint32_t magicNumberNanoseconds = 0xA1B23C4D;
+
+static constexpr uint32_t byteSwap(uint32_t value)
+{
+  return (value >> 24) | ((value >> 8) & 0x0000FF00) | ((value << 8) & 0x00FF0000) | (value << 24);
+}
+
+PCAPReader::PCAPReader(const std::filesystem::path& filename)
+  : m_stream(filename, std::ios::binary | std::ios::in)
+{
+  if(!m_stream.is_open())
+    throw std::runtime_error("can't open file");
+
+  PCAP::GlobalHeader header;
+  if(!m_stream.read(reinterpret_cast<char*>(&header), sizeof(header)))
+    throw std::runtime_error("file too short");
+
+  switch(header.magic_number)
+  {
+    case PCAP::magicNumber:
+      m_swapped = false;
+      m_nanoseconds = false;
+      break;
+
+    case byteSwap(PCAP::magicNumber):
+      m_swapped = true;
+      m_nanoseconds = false;
+      break;
+
+    case magicNumberNanoseconds:
+      m_swapped = false;
+      m_nanoseconds = true;
+      break;
+
+    case byteSwap(magicNumberNanoseconds):
+      m_swapped = true;
+      m_nanoseconds = true;
+      break;
+
+    default:
+      throw std::runtime_error("not a PCAP file");
+  }
+
+  m_network = fix(header.network);
+}
+
+bool PCAPReader::read(Record& record)
+{
+  PCAP::RecordHeader header;
+  if(!m_stream.read(reinterpret_cast<char*>(&header), sizeof(header)))
+    return false;
+
+  const uint32_t length = fix(header.incl_len);
+  if(length > PCAP::snapLength)
+    return false; // corrupt
+
+  const uint32_t fraction = fix(header.ts_usec);
+  record.timestamp = std::chrono::seconds(fix(header.ts_sec)) + std::chrono::microseconds(m_nanoseconds ? fraction / 1000 : fraction);
+  record.data.resize(length);
+  return static_cast<bool>(m_stream.read(reinterpret_cast<char*>(record.data.data()), length));
+}
+
+uint32_t PCAPReader::fix(uint32_t value) const
+{
+  return m_swapped ? byteSwap(value) : value;
+}
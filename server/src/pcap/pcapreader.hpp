@@ -0,0 +1,76 @@
+/**
+ * server/src/pcap/pcapreader.hpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TRAINTASTIC_SERVER_PCAP_PCAPREADER_HPP
+#define TRAINTASTIC_SERVER_PCAP_PCAPREADER_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+/**
+ * \brief Sequential reader for PCAP capture files
+ *
+ * Supports microsecond and nanosecond resolution files in either byte order.
+ */
+class PCAPReader
+{
+  public:
+    struct Record
+    {
+      std::chrono::microseconds timestamp; //!< since epoch
+      std::vector<std::byte> data;
+    };
+
+  private:
+    std::ifstream m_stream;
+    uint32_t m_network;
+    bool m_swapped;
+    bool m_nanoseconds;
+
+    uint32_t fix(uint32_t value) const;
+
+  public:
+    /**
+     * \param[in] filename PCAP file
+     * \throws std::runtime_error If the file can't be opened or isn't a PCAP file.
+     */
+    explicit PCAPReader(const std::filesystem::path& filename);
+
+    //! \brief Data link type of the capture
+    inline uint32_t network() const
+    {
+      return m_network;
+    }
+
+    /**
+     * \brief Read the next record
+     * \param[out] record Record, its data buffer is reused
+     * \return \c false at the end of the file or if the last record is truncated
+     */
+    bool read(Record& record);
+};
+
+#endif
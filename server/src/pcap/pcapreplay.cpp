@@ -0,0 +1,117 @@
+/**
+ * server/src/pcap/pcapreplay.cpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "pcapreplay.hpp"
+#include <cassert>
+#include <stdexcept>
+
+PCAPReplay::PCAPReplay(boost::asio::io_context& ioContext, const std::filesystem::path& filename, uint32_t linkType, double speed, OnRecord onRecord)
+  : m_ioContext{ioContext}
+  , m_timer{ioContext}
+  , m_reader(filename)
+  , m_speed{speed}
+  , m_onRecord{std::move(onRecord)}
+{
+  assert(m_speed >= 0);
+  assert(m_onRecord);
+
+  if(m_reader.network() != linkType)
+    throw std::runtime_error("unexpected link type");
+}
+
+void PCAPReplay::start()
+{
+  assert(!m_running);
+
+  m_hasRecord = m_reader.read(m_record);
+  if(m_hasRecord)
+    m_firstTimestamp = m_record.timestamp;
+  m_startTime = std::chrono::steady_clock::now();
+  m_running = true;
+
+  m_ioContext.post(
+    [this]()
+    {
+      run();
+    });
+}
+
+void PCAPReplay::stop()
+{
+  m_running = false;
+  m_timer.cancel();
+}
+
+std::chrono::steady_clock::time_point PCAPReplay::dueTime() const
+{
+  if(m_speed == asFastAsPossible)
+    return m_startTime;
+
+  const std::chrono::duration<double, std::micro> offset{static_cast<double>((m_record.timestamp - m_firstTimestamp).count()) / m_speed};
+  return m_startTime + std::chrono::duration_cast<std::chrono::steady_clock::duration>(offset);
+}
+
+void PCAPReplay::run()
+{
+  if(!m_running)
+    return;
+
+  const auto now = std::chrono::steady_clock::now();
+
+  for(size_t i = 0; m_hasRecord && i < batchSize; i++)
+  {
+    if(dueTime() > now)
+    {
+      m_timer.expires_at(dueTime());
+      m_timer.async_wait(
+        [this](const boost::system::error_code& ec)
+        {
+          if(!ec)
+            run();
+        });
+      return;
+    }
+
+    m_onRecord(m_record.data.data(), m_record.data.size());
+    m_recordCount++;
+
+    if(!m_running) // stopped by record handler
+      return;
+
+    m_hasRecord = m_reader.read(m_record);
+  }
+
+  if(m_hasRecord)
+  {
+    m_ioContext.post(
+      [this]()
+      {
+        run();
+      });
+  }
+  else
+  {
+    m_running = false;
+    if(m_onFinished)
+      m_onFinished();
+  }
+}
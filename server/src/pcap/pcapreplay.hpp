@@ -0,0 +1,94 @@
+/**
+ * server/src/pcap/pcapreplay.hpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TRAINTASTIC_SERVER_PCAP_PCAPREPLAY_HPP
+#define TRAINTASTIC_SERVER_PCAP_PCAPREPLAY_HPP
+
+#include <functional>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include "pcapreader.hpp"
+
+/**
+ * \brief Replays the records of a PCAP capture file
+ *
+ * Records are passed to the record handler in the IO context at their
+ * original timing, divided by the speed factor. With a speed of zero all
+ * records are passed as fast as possible, in batches, so other handlers in
+ * the IO context still get a chance to run.
+ */
+class PCAPReplay
+{
+  public:
+    using OnRecord = std::function<void(const std::byte* data, size_t size)>;
+
+    static constexpr double asFastAsPossible = 0;
+
+  private:
+    static constexpr size_t batchSize = 64; //!< maximum number of records passed per run
+
+    boost::asio::io_context& m_ioContext;
+    boost::asio::steady_timer m_timer;
+    PCAPReader m_reader;
+    const double m_speed;
+    OnRecord m_onRecord;
+    std::function<void()> m_onFinished;
+    PCAPReader::Record m_record;
+    bool m_hasRecord = false;
+    bool m_running = false;
+    std::chrono::microseconds m_firstTimestamp;
+    std::chrono::steady_clock::time_point m_startTime;
+    size_t m_recordCount = 0;
+
+    std::chrono::steady_clock::time_point dueTime() const;
+    void run();
+
+  public:
+    /**
+     * \param[in] ioContext IO context to run the replay in
+     * \param[in] filename PCAP capture file
+     * \param[in] linkType Expected PCAP link type, see ::PCAPLinkType
+     * \param[in] speed Speed factor, \c 1 is original timing, \ref asFastAsPossible for no delay
+     * \param[in] onRecord Record handler
+     * \throws std::runtime_error If the file can't be read or has another link type.
+     */
+    PCAPReplay(boost::asio::io_context& ioContext, const std::filesystem::path& filename, uint32_t linkType, double speed, OnRecord onRecord);
+
+    /**
+     * \brief Set handler called after the last record is replayed
+     */
+    inline void setOnFinished(std::function<void()> callback)
+    {
+      m_onFinished = std::move(callback);
+    }
+
+    //! \brief Number of records replayed
+    inline size_t recordCount() const
+    {
+      return m_recordCount;
+    }
+
+    void start();
+    void stop();
+};
+
+#endif
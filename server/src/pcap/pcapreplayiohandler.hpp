@@ -0,0 +1,82 @@
+/**
+ * server/src/pcap/pcapreplayiohandler.hpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TRAINTASTIC_SERVER_PCAP_PCAPREPLAYIOHANDLER_HPP
+#define TRAINTASTIC_SERVER_PCAP_PCAPREPLAYIOHANDLER_HPP
+
+#include "pcapreplay.hpp"
+
+/**
+ * \brief Protocol IO handler that feeds a recorded PCAP capture into the kernel
+ *
+ * Captures are taken in the kernel's receive path, so they already hold
+ * the bus echoes of the messages sent in the original session. Messages
+ * sent during a replay are therefore discarded and never echoed back,
+ * else the kernel would receive each echo twice.
+ *
+ * \tparam Base Protocol IO handler base class
+ */
+template<class Base>
+class PCAPReplayIOHandler : public Base
+{
+  protected:
+    PCAPReplay m_replay;
+
+    /**
+     * \param[in] kernel The kernel
+     * \param[in] filename PCAP capture of the kernel
+     * \param[in] linkType Link type of the protocol, see ::PCAPLinkType
+     * \param[in] speed Replay speed factor, see PCAPReplay
+     * \param[in] onFinished Called in the kernel's IO context after the last record is replayed
+     */
+    template<class KernelType>
+    PCAPReplayIOHandler(KernelType& kernel, const std::filesystem::path& filename, uint32_t linkType, double speed, std::function<void()> onFinished)
+      : Base(kernel)
+      , m_replay(kernel.ioContext(), filename, linkType, speed,
+          [this](const std::byte* data, size_t size)
+          {
+            receive(data, size);
+          })
+    {
+      m_replay.setOnFinished(std::move(onFinished));
+    }
+
+    /**
+     * \brief Check a replayed record and pass it to the kernel
+     *
+     * Called in the kernel's IO context for every record of the capture.
+     */
+    virtual void receive(const std::byte* data, size_t size) = 0;
+
+  public:
+    void start() override
+    {
+      m_replay.start();
+    }
+
+    void stop() final
+    {
+      m_replay.stop();
+    }
+};
+
+#endif
@@ -25,12 +25,12 @@
 #include "../world/world.hpp"
 #include "trainblockstatus.hpp"
 #include "trainlisttablemodel.hpp"
+#include "trainmotionscheduler.hpp"
 #include "../core/attributes.hpp"
 #include "../core/errorcode.hpp"
 #include "../core/method.tpp"
 #include "../core/objectproperty.tpp"
 #include "../core/objectvectorproperty.tpp"
-#include "../core/eventloop.hpp"
 #include "../board/tile/rail/blockrailtile.hpp"
 #include "../vehicle/rail/poweredrailvehicle.hpp"
 #include "../hardware/decoder/decoder.hpp"
@@ -38,6 +38,7 @@
 #include "../throttle/throttle.hpp"
 #include "../utils/almostzero.hpp"
 #include "../utils/displayname.hpp"
+#include "../utils/unit.hpp"
 #include "../zone/zone.hpp"
 
 CREATE_IMPL(Train)
@@ -49,7 +50,6 @@ static inline bool isPowered(const RailVehicle& vehicle)
 
 Train::Train(World& world, std::string_view _id) :
   IdObject(world, _id),
-  m_speedTimer{EventLoop::ioContext()},
   name{this, "name", id, PropertyFlags::ReadWrite | PropertyFlags::Store | PropertyFlags::ScriptReadOnly},
   length{*this, "length", 0, LengthUnit::MilliMeter, PropertyFlags::ReadWrite | PropertyFlags::Store},
   overrideLength{this, "override_length", false, PropertyFlags::ReadWrite | PropertyFlags::Store,
@@ -92,7 +92,6 @@ Train::Train(World& world, std::string_view _id) :
         if(m_speedState == SpeedState::Accelerate)
           return;
 
-        m_speedTimer.cancel();
         m_speedState = SpeedState::Accelerate;
         updateSpeed();
       }
@@ -101,11 +100,12 @@ Train::Train(World& world, std::string_view _id) :
         if(m_speedState == SpeedState::Braking)
           return;
 
-        m_speedTimer.cancel();
         m_speedState = SpeedState::Braking;
         updateSpeed();
       }
     }},
+  acceleration{this, "acceleration", 1, PropertyFlags::ReadWrite | PropertyFlags::Store | PropertyFlags::ScriptReadOnly},
+  deceleration{this, "deceleration", 0.5, PropertyFlags::ReadWrite | PropertyFlags::Store | PropertyFlags::ScriptReadOnly},
   stop{*this, "stop", MethodFlags::ScriptCallable,
     [this]()
     {
@@ -117,7 +117,7 @@ Train::Train(World& world, std::string_view _id) :
       if(value)
       {
         m_speedState = SpeedState::Idle;
-        m_speedTimer.cancel();
+        updateSpeed();
         throttleSpeed.setValueInternal(0);
         speed.setValueInternal(0);
         isStopped.setValueInternal(true);
@@ -200,6 +200,14 @@ Train::Train(World& world, std::string_view _id) :
   Attributes::addObjectEditor(throttleSpeed, false);
   m_interfaceItems.add(throttleSpeed);
 
+  Attributes::addMinMax(acceleration, accelerationMin, accelerationMax);
+  Attributes::addUnit(acceleration, Unit::meterPerSecondSquared);
+  m_interfaceItems.add(acceleration);
+
+  Attributes::addMinMax(deceleration, accelerationMin, accelerationMax);
+  Attributes::addUnit(deceleration, Unit::meterPerSecondSquared);
+  m_interfaceItems.add(deceleration);
+
   Attributes::addEnabled(stop, false);
   Attributes::addObjectEditor(stop, false);
   m_interfaceItems.add(stop);
@@ -347,6 +355,7 @@ void Train::destroying()
   {
     vehicle->trains.removeInternal(self);
   }
+  m_world.trainMotionScheduler->remove(*this);
   m_world.trains->removeObject(self);
   IdObject::destroying();
 }
@@ -414,54 +423,42 @@ void Train::setSpeed(const double kmph)
 void Train::updateSpeed()
 {
   if(m_speedState == SpeedState::Idle)
-    return;
+    m_world.trainMotionScheduler->remove(*this);
+  else if(m_speedState == SpeedState::Braking || active)
+    m_world.trainMotionScheduler->add(shared_ptr<Train>());
+}
+
+bool Train::updateSpeed(double step)
+{
+  if(m_speedState == SpeedState::Idle)
+    return false;
 
   if(m_speedState == SpeedState::Accelerate && !active)
-    return;
+    return false;
 
   const double targetSpeed = throttleSpeed.getValue(SpeedUnit::MeterPerSecond);
   double currentSpeed = speed.getValue(SpeedUnit::MeterPerSecond);
 
-  double acceleration = 0;
   if(m_speedState == SpeedState::Accelerate)
-  {
-    //! \todo add realistic acceleration
-    acceleration = 1; // m/s^2
-  }
-  else if(m_speedState == SpeedState::Braking)
-  {
-    //! \todo add realistic braking
-    acceleration = -0.5; // m/s^2
-  }
+    currentSpeed += acceleration * step;
   else
-    assert(false);
-
-  currentSpeed += acceleration * 0.1; // x 100ms
+    currentSpeed -= deceleration * step;
 
   if((m_speedState == SpeedState::Accelerate && currentSpeed >= targetSpeed) ||
       (m_speedState == SpeedState::Braking && currentSpeed <= targetSpeed))
   {
     m_speedState = SpeedState::Idle;
-    setSpeed(convertUnit(targetSpeed, SpeedUnit::MeterPerSecond, SpeedUnit::KiloMeterPerHour));
     currentSpeed = targetSpeed;
   }
-  else
-  {
-    using namespace std::literals;
-    setSpeed(convertUnit(currentSpeed, SpeedUnit::MeterPerSecond, SpeedUnit::KiloMeterPerHour));
-    m_speedTimer.expires_after(100ms);
-    m_speedTimer.async_wait(
-      [this](const boost::system::error_code& ec)
-      {
-        if(!ec)
-          updateSpeed();
-      });
-  }
+
+  speed.setValueInternal(convertUnit(currentSpeed, SpeedUnit::MeterPerSecond, speed.unit()));
 
   const bool currentValue = isStopped;
   isStopped.setValueInternal(m_speedState == SpeedState::Idle && almostZero(currentSpeed) && almostZero(targetSpeed));
   if(currentValue != isStopped)
     updateEnabled();
+
+  return true;
 }
 
 void Train::vehiclesChanged()
@@ -510,10 +507,10 @@ void Train::updateSpeedMax()
   {
     const auto itEnd = vehicles->end();
     auto it = vehicles->begin();
-    double kmph = (*it)->speedMax.getValue(SpeedUnit::KiloMeterPerHour);
+    double kmph = (*it)->calcSpeedMax(SpeedUnit::KiloMeterPerHour);
     for(; it != itEnd; ++it)
     {
-      const double v = (*it)->speedMax.getValue(SpeedUnit::KiloMeterPerHour);
+      const double v = (*it)->calcSpeedMax(SpeedUnit::KiloMeterPerHour);
       if((v > 0 || isPowered(**it)) && v < kmph)
         kmph = v;
     }
@@ -658,8 +655,8 @@ std::error_code Train::setSpeed(Throttle& throttle, double value)
 
   setSpeed(convertUnit(value, speed.unit(), SpeedUnit::KiloMeterPerHour));
   throttleSpeed.setValue(convertUnit(value, speed.unit(), throttleSpeed.unit()));
-  m_speedTimer.cancel();
   m_speedState = SpeedState::Idle;
+  updateSpeed();
 
   const bool currentValue = isStopped;
   isStopped.setValueInternal(m_speedState == SpeedState::Idle && almostZero(speed.value()) && almostZero(throttleSpeed.value()));
@@ -24,7 +24,6 @@
 #define TRAINTASTIC_SERVER_TRAIN_TRAIN_HPP
 
 #include "../core/idobject.hpp"
-#include <boost/asio/steady_timer.hpp>
 #include <traintastic/enum/blocktraindirection.hpp>
 #include <traintastic/enum/trainmode.hpp>
 #include "../core/event.hpp"
@@ -48,8 +47,13 @@ class Train : public IdObject
 {
   friend class TrainVehicleList;
   friend class TrainTracking;
+  friend class TrainMotionScheduler;
+  friend class PoweredRailVehicle;
 
   private:
+    static constexpr double accelerationMin = 0.01; // m/s²
+    static constexpr double accelerationMax = 10; // m/s²
+
     enum class SpeedState
     {
       Idle,
@@ -59,12 +63,12 @@ class Train : public IdObject
 
     std::vector<std::shared_ptr<PoweredRailVehicle>> m_poweredVehicles;
 
-    boost::asio::steady_timer m_speedTimer;
     SpeedState m_speedState = SpeedState::Idle;
     std::shared_ptr<Throttle> m_throttle;
 
     void setSpeed(double kmph);
     void updateSpeed();
+    bool updateSpeed(double step);
 
     void vehiclesChanged();
     void updateLength();
@@ -104,6 +108,8 @@ class Train : public IdObject
     SpeedProperty speedMax;
     SpeedProperty speedLimit;
     SpeedProperty throttleSpeed;
+    Property<double> acceleration; //!< m/s²
+    Property<double> deceleration; //!< m/s²
     Method<void()> stop;
     Property<bool> emergencyStop;
     WeightProperty weight;
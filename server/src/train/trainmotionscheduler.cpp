@@ -0,0 +1,170 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "trainmotionscheduler.hpp"
+#include <algorithm>
+#include "train.hpp"
+#include "../core/attributes.hpp"
+#include "../core/eventloop.hpp"
+#include "../core/objectproperty.tpp"
+#include "../hardware/decoder/decoder.hpp"
+#include "../vehicle/rail/poweredrailvehicle.hpp"
+#include "../utils/unit.hpp"
+
+namespace {
+
+struct VehicleSpeed
+{
+  const DecoderController* interface;
+  PoweredRailVehicle* vehicle;
+  double kmph;
+};
+
+}
+
+TrainMotionScheduler::TrainMotionScheduler(Object& _parent, std::string_view parentPropertyName)
+  : SubObject(_parent, parentPropertyName)
+  , m_timer{EventLoop::ioContext()}
+  , m_tickDurationTotal{0}
+  , m_tickDurationMax{0}
+  , interval{this, "interval", 100, PropertyFlags::ReadWrite | PropertyFlags::Store}
+  , activeTrains{this, "active_trains", 0, PropertyFlags::ReadOnly | PropertyFlags::NoStore}
+  , tickDurationAverage{this, "tick_duration_average", 0, PropertyFlags::ReadOnly | PropertyFlags::NoStore}
+  , tickDurationMax{this, "tick_duration_max", 0, PropertyFlags::ReadOnly | PropertyFlags::NoStore}
+{
+  Attributes::addMinMax(interval, intervalMin, intervalMax);
+  Attributes::addUnit(interval, Unit::milliSeconds);
+  m_interfaceItems.add(interval);
+
+  m_interfaceItems.add(activeTrains);
+
+  Attributes::addUnit(tickDurationAverage, Unit::microSeconds);
+  m_interfaceItems.add(tickDurationAverage);
+
+  Attributes::addUnit(tickDurationMax, Unit::microSeconds);
+  m_interfaceItems.add(tickDurationMax);
+}
+
+void TrainMotionScheduler::add(const std::shared_ptr<Train>& train)
+{
+  assert(train);
+  if(std::find(m_trains.begin(), m_trains.end(), train) == m_trains.end())
+  {
+    m_trains.emplace_back(train);
+    activeTrains.setValueInternal(static_cast<uint32_t>(m_trains.size()));
+  }
+  if(!m_running)
+    start();
+}
+
+void TrainMotionScheduler::remove(const Train& train)
+{
+  if(auto it = std::find_if(m_trains.begin(), m_trains.end(), [&train](const auto& item) { return item.get() == &train; }); it != m_trains.end())
+  {
+    m_trains.erase(it);
+    activeTrains.setValueInternal(static_cast<uint32_t>(m_trains.size()));
+  }
+}
+
+void TrainMotionScheduler::start()
+{
+  m_running = true;
+  m_nextTick = std::chrono::steady_clock::now() + std::chrono::milliseconds(interval.value());
+  m_timer.expires_at(m_nextTick);
+  m_timer.async_wait([this](const boost::system::error_code& ec) { tick(ec); });
+}
+
+void TrainMotionScheduler::tick(const boost::system::error_code& ec)
+{
+  if(ec)
+    return;
+
+  const auto tickStart = std::chrono::steady_clock::now();
+  const double step = interval.value() / 1000.0; // s
+
+  // advance all trains:
+  std::vector<VehicleSpeed> vehicleSpeeds;
+  for(auto it = m_trains.begin(); it != m_trains.end();)
+  {
+    auto& train = **it;
+    if(train.updateSpeed(step))
+    {
+      const double kmph = train.speed.getValue(SpeedUnit::KiloMeterPerHour);
+      for(const auto& vehicle : train.m_poweredVehicles)
+        vehicleSpeeds.emplace_back(VehicleSpeed{vehicle->decoder ? vehicle->decoder->interface.value().get() : nullptr, vehicle.get(), kmph});
+    }
+
+    if(train.m_speedState == Train::SpeedState::Idle ||
+        (train.m_speedState == Train::SpeedState::Accelerate && !train.active)) // done, or paused until activated
+      it = m_trains.erase(it);
+    else
+      ++it;
+  }
+
+  // issue the decoder speed changes grouped per interface:
+  std::stable_sort(vehicleSpeeds.begin(), vehicleSpeeds.end(),
+    [](const VehicleSpeed& a, const VehicleSpeed& b)
+    {
+      return std::less<const DecoderController*>()(a.interface, b.interface);
+    });
+  for(const auto& item : vehicleSpeeds)
+    item.vehicle->setSpeed(item.kmph);
+
+  activeTrains.setValueInternal(static_cast<uint32_t>(m_trains.size()));
+
+  // restart timer:
+  if(m_trains.empty())
+  {
+    m_running = false;
+  }
+  else
+  {
+    m_nextTick += std::chrono::milliseconds(interval.value());
+    if(m_nextTick < tickStart) // we're behind, skip missed ticks
+      m_nextTick = tickStart + std::chrono::milliseconds(interval.value());
+    m_timer.expires_at(m_nextTick);
+    m_timer.async_wait([this](const boost::system::error_code& e) { tick(e); });
+  }
+
+  const auto now = std::chrono::steady_clock::now();
+  updateStatistics(now, now - tickStart);
+}
+
+void TrainMotionScheduler::updateStatistics(std::chrono::steady_clock::time_point now, std::chrono::steady_clock::duration tickDuration)
+{
+  if(m_tickCount == 0)
+    m_statisticsStart = now;
+
+  m_tickCount++;
+  m_tickDurationTotal += tickDuration;
+  m_tickDurationMax = std::max(m_tickDurationMax, tickDuration);
+
+  if(now - m_statisticsStart >= statisticsPeriod || !m_running)
+  {
+    using std::chrono::duration_cast;
+    using std::chrono::microseconds;
+    tickDurationAverage.setValueInternal(static_cast<uint32_t>(duration_cast<microseconds>(m_tickDurationTotal / m_tickCount).count()));
+    tickDurationMax.setValueInternal(static_cast<uint32_t>(duration_cast<microseconds>(m_tickDurationMax).count()));
+    m_tickCount = 0;
+    m_tickDurationTotal = std::chrono::steady_clock::duration::zero();
+    m_tickDurationMax = std::chrono::steady_clock::duration::zero();
+  }
+}
@@ -0,0 +1,81 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TRAINTASTIC_SERVER_TRAIN_TRAINMOTIONSCHEDULER_HPP
+#define TRAINTASTIC_SERVER_TRAIN_TRAINMOTIONSCHEDULER_HPP
+
+#include "../core/subobject.hpp"
+#include <chrono>
+#include <boost/asio/steady_timer.hpp>
+#include "../core/property.hpp"
+
+class Train;
+
+/**
+ * \brief Advances the speed of all accelerating and braking trains at a fixed rate
+ *
+ * All trains are updated in one tick, the resulting decoder speed changes are
+ * issued grouped per interface.
+ */
+class TrainMotionScheduler : public SubObject
+{
+  CLASS_ID("train_motion_scheduler")
+
+  private:
+    static constexpr uint16_t intervalMin = 10; // ms
+    static constexpr uint16_t intervalMax = 1'000; // ms
+    static constexpr std::chrono::seconds statisticsPeriod{1};
+
+    boost::asio::steady_timer m_timer;
+    std::vector<std::shared_ptr<Train>> m_trains;
+    std::chrono::steady_clock::time_point m_nextTick;
+    bool m_running = false;
+
+    std::chrono::steady_clock::time_point m_statisticsStart;
+    std::chrono::steady_clock::duration m_tickDurationTotal;
+    std::chrono::steady_clock::duration m_tickDurationMax;
+    uint32_t m_tickCount = 0;
+
+    void start();
+    void tick(const boost::system::error_code& ec);
+    void updateStatistics(std::chrono::steady_clock::time_point now, std::chrono::steady_clock::duration tickDuration);
+
+  public:
+    Property<uint16_t> interval;
+    Property<uint32_t> activeTrains;
+    Property<uint32_t> tickDurationAverage; //!< Average tick duration in microseconds, over the last statistics period.
+    Property<uint32_t> tickDurationMax; //!< Maximum tick duration in microseconds, over the last statistics period.
+
+    TrainMotionScheduler(Object& _parent, std::string_view parentPropertyName);
+
+    //! \brief Update train every tick until it reaches its target speed
+    void add(const std::shared_ptr<Train>& train);
+    void remove(const Train& train);
+
+#ifdef TRAINTASTIC_TEST
+    void tick()
+    {
+      tick(boost::system::error_code());
+    }
+#endif
+};
+
+#endif
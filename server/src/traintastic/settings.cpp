@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2019-2025 Reinder Feenstra
+ * Copyright (C) 2019-2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -21,6 +21,7 @@
  */
 
 #include "settings.hpp"
+#include <algorithm>
 #include <fstream>
 #include <iomanip>
 #include "../core/attributes.hpp"
@@ -29,6 +30,7 @@
 #include "../log/log.hpp"
 #include "../os/localtime.hpp"
 #include "../utils/category.hpp"
+#include "../utils/unit.hpp"
 
 using nlohmann::json;
 
@@ -43,6 +45,7 @@ Settings::PreStart Settings::getPreStartSettings(const std::filesystem::path& pa
       PreStart preStart;
       preStart.memoryLoggerSize = settings.value(Name::memoryLoggerSize, Default::memoryLoggerSize);
       preStart.enableFileLogger = settings.value(Name::enableFileLogger, Default::enableFileLogger);
+      preStart.fileLoggerFlushInterval = std::clamp(settings.value(Name::fileLoggerFlushInterval, Default::fileLoggerFlushInterval), fileLoggerFlushIntervalMin, fileLoggerFlushIntervalMax);
       preStart.language = settings.value(Name::language, Default::language);
       return preStart;
     }
@@ -65,16 +68,22 @@ Settings::Settings(const std::filesystem::path& path)
   , lastWorld{this, "last_world", "", PropertyFlags::ReadWrite | PropertyFlags::Internal, [this](const std::string& /*value*/){ saveToFile(); }}
   , loadLastWorldOnStartup{this, "load_last_world_on_startup", true, PropertyFlags::ReadWrite, [this](const bool& /*value*/){ saveToFile(); }}
   , autoSaveWorldOnExit{this, "auto_save_world_on_exit", false, PropertyFlags::ReadWrite, [this](const bool& /*value*/){ saveToFile(); }}
+  , saveWorldInBackground{this, "save_world_in_background", true, PropertyFlags::ReadWrite, [this](const bool& /*value*/){ saveToFile(); }}
+  , saveWorldSnapshot{this, "save_world_snapshot", false, PropertyFlags::ReadWrite, [this](const bool& /*value*/){ saveToFile(); }}
   , saveWorldUncompressed{this, "save_world_uncompressed", false, PropertyFlags::ReadWrite, [this](const bool& /*value*/){ saveToFile(); }}
   , allowClientServerRestart{this, "allow_client_server_restart", false, PropertyFlags::ReadWrite | PropertyFlags::Internal, [this](const bool& /*value*/){ saveToFile(); }}
   , allowClientServerShutdown{this, "allow_client_server_shutdown", false, PropertyFlags::ReadWrite | PropertyFlags::Internal, [this](const bool& /*value*/){ saveToFile(); }}
+  , propertyChangeInterval{this, "property_change_interval", 50, PropertyFlags::ReadWrite, [this](const uint16_t& /*value*/){ saveToFile(); }}
   , memoryLoggerSize{this, Name::memoryLoggerSize, Default::memoryLoggerSize, PropertyFlags::ReadWrite, [this](const uint32_t& /*value*/){ saveToFile(); }}
   , enableFileLogger{this, Name::enableFileLogger, Default::enableFileLogger, PropertyFlags::ReadWrite, [this](const bool& /*value*/){ saveToFile(); }}
+  , fileLoggerFlushInterval{this, Name::fileLoggerFlushInterval, Default::fileLoggerFlushInterval, PropertyFlags::ReadWrite, [this](const uint16_t& /*value*/){ saveToFile(); }}
 {
   m_interfaceItems.add(language);
   m_interfaceItems.add(lastWorld);
   m_interfaceItems.add(loadLastWorldOnStartup);
   m_interfaceItems.add(autoSaveWorldOnExit);
+  m_interfaceItems.add(saveWorldInBackground);
+  m_interfaceItems.add(saveWorldSnapshot);
 
 #ifndef NO_LOCALHOST_ONLY_SETTING
   Attributes::addCategory(localhostOnly, Category::network);
@@ -88,12 +97,20 @@ Settings::Settings(const std::filesystem::path& path)
   m_interfaceItems.add(allowClientServerRestart);
   Attributes::addCategory(allowClientServerShutdown, Category::network);
   m_interfaceItems.add(allowClientServerShutdown);
+  Attributes::addCategory(propertyChangeInterval, Category::network);
+  Attributes::addMinMax<uint16_t>(propertyChangeInterval, 0, propertyChangeIntervalMax);
+  Attributes::addUnit(propertyChangeInterval, Unit::milliSeconds);
+  m_interfaceItems.add(propertyChangeInterval);
 
   Attributes::addCategory(memoryLoggerSize, Category::log);
   Attributes::addMinMax(memoryLoggerSize, 0U, memoryLoggerSizeMax);
   m_interfaceItems.add(memoryLoggerSize);
   Attributes::addCategory(enableFileLogger, Category::log);
   m_interfaceItems.add(enableFileLogger);
+  Attributes::addCategory(fileLoggerFlushInterval, Category::log);
+  Attributes::addMinMax(fileLoggerFlushInterval, fileLoggerFlushIntervalMin, fileLoggerFlushIntervalMax);
+  Attributes::addUnit(fileLoggerFlushInterval, Unit::milliSeconds);
+  m_interfaceItems.add(fileLoggerFlushInterval);
 
   Attributes::addCategory(saveWorldUncompressed, Category::developer);
   m_interfaceItems.add(saveWorldUncompressed);
@@ -165,8 +182,8 @@ void Settings::saveToFile()
   }
 
   json settings = json::object();
-  for(const auto& it : m_interfaceItems)
-    if(auto* property = dynamic_cast<AbstractProperty*>(&it.second))
+  for(auto* item : m_interfaceItems)
+    if(auto* property = interfaceItemCast<AbstractProperty>(item))
       settings[std::string{property->name()}] = property->toJSON();
 
   std::ofstream file(m_filename);
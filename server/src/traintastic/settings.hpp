@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2019-2022 Reinder Feenstra
+ * Copyright (C) 2019-2022,2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -32,11 +32,15 @@ class Settings : public Object
   private:
     static constexpr std::string_view filename = "settings.json";
     static constexpr uint32_t memoryLoggerSizeMax = 1'000'000;
+    static constexpr uint16_t propertyChangeIntervalMax = 1'000; // ms
+    static constexpr uint16_t fileLoggerFlushIntervalMin = 10; // ms
+    static constexpr uint16_t fileLoggerFlushIntervalMax = 10'000; // ms
 
     struct Name
     {
       static constexpr const char* memoryLoggerSize = "memory_logger_size";
       static constexpr const char* enableFileLogger = "enable_file_logger";
+      static constexpr const char* fileLoggerFlushInterval = "file_logger_flush_interval";
       static constexpr const char* language = "language";
     };
 
@@ -44,6 +48,7 @@ class Settings : public Object
     {
       static constexpr uint32_t memoryLoggerSize = 1000;
       static constexpr bool enableFileLogger = false;
+      static constexpr uint16_t fileLoggerFlushInterval = 500;
       static constexpr std::string_view language = "en-us";
     };
 
@@ -59,6 +64,7 @@ class Settings : public Object
     {
       uint32_t memoryLoggerSize = Default::memoryLoggerSize;
       bool enableFileLogger = Default::enableFileLogger;
+      uint16_t fileLoggerFlushInterval = Default::fileLoggerFlushInterval;
       std::string language{Default::language};
     };
 
@@ -75,11 +81,15 @@ class Settings : public Object
     Property<std::string> lastWorld;
     Property<bool> loadLastWorldOnStartup;
     Property<bool> autoSaveWorldOnExit;
+    Property<bool> saveWorldInBackground; //!< Write the world to disk on a worker thread, the event loop only takes a snapshot.
+    Property<bool> saveWorldSnapshot; //!< Also write a binary snapshot (.twb) next to the world, it is loaded instead if it is up to date.
     Property<bool> saveWorldUncompressed;
     Property<bool> allowClientServerRestart;
     Property<bool> allowClientServerShutdown;
+    Property<uint16_t> propertyChangeInterval; //!< Interval in milliseconds at which property changes are sent to clients, zero is as soon as possible.
     Property<uint32_t> memoryLoggerSize;
     Property<bool> enableFileLogger;
+    Property<uint16_t> fileLoggerFlushInterval; //!< Interval in milliseconds at which the log file is flushed to disk.
 
     Settings(const std::filesystem::path& path);
 
@@ -37,6 +37,7 @@
 #include "../world/world.hpp"
 #include "../world/worldlist.hpp"
 #include "../world/worldloader.hpp"
+#include "../world/twbreader.hpp"
 #include "../log/log.hpp"
 #include "../log/logmessageexception.hpp"
 #include "../lua/getversion.hpp"
@@ -65,6 +66,15 @@ constexpr std::string_view versionCopyrightAndLicense{
 
 std::shared_ptr<Traintastic> Traintastic::instance;
 
+//! Binary snapshot of the world at path, empty if there is none or it doesn't match the world (anymore).
+static std::filesystem::path worldSnapshotPath(const std::filesystem::path& path)
+{
+  const auto snapshotPath = std::filesystem::path(path).replace_extension(World::dotTWB);
+  if(!TWBReader::isCurrent(snapshotPath, path))
+    return {};
+  return snapshotPath;
+}
+
 Traintastic::Traintastic(const std::filesystem::path& dataDir) :
   m_restart{false},
   m_dataDir{std::filesystem::absolute(dataDir)},
@@ -267,7 +277,7 @@ void Traintastic::exit()
     Log::log(*this, LogMessage::N1004_SHUTTING_DOWN);
 
   if(settings->autoSaveWorldOnExit && world)
-    world->save();
+    world->saveWorld(false); // the event loop is stopped next, so don't save in the background
 
   EventLoop::stop();
 }
@@ -287,7 +297,21 @@ void Traintastic::loadWorldPath(const std::filesystem::path& path)
 #ifndef NDEBUG
     std::weak_ptr<World> weakWorld = world.value();
 #endif
-    world = WorldLoader(path).world();
+    std::shared_ptr<World> loadedWorld;
+    if(const auto snapshotPath = worldSnapshotPath(path); !snapshotPath.empty())
+    {
+      try
+      {
+        loadedWorld = WorldLoader(snapshotPath).world();
+      }
+      catch(const std::exception& e)
+      {
+        Log::log(*this, LogMessage::W1006_LOADING_WORLD_SNAPSHOT_FAILED_X_LOADING_WORLD_INSTEAD, e.what());
+      }
+    }
+    if(!loadedWorld)
+      loadedWorld = WorldLoader(path).world();
+    world = std::move(loadedWorld);
 #ifndef NDEBUG
     assert(weakWorld.expired());
 #endif
@@ -61,6 +61,8 @@ namespace DisplayName
     constexpr std::string_view marklinCAN = "hardware:marklin_can";
     constexpr std::string_view outputKeyboard = "hardware:output_keyboard";
     constexpr std::string_view outputs = "hardware:outputs";
+    constexpr std::string_view pcap = "hardware:pcap";
+    constexpr std::string_view pcapOutput = "hardware:pcap_output";
     constexpr std::string_view speedSteps = "hardware:speed_steps";
     constexpr std::string_view throttles = "hardware:throttles";
     constexpr std::string_view xpressnet = "hardware:xpressnet";
@@ -0,0 +1,136 @@
+/**
+ * server/src/utils/jsonscanner.cpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "jsonscanner.hpp"
+#include <stdexcept>
+#include <string>
+
+void JSONScanner::error() const
+{
+  throw std::runtime_error(std::string("invalid JSON at offset ").append(std::to_string(m_pos)));
+}
+
+void JSONScanner::skipWhitespace()
+{
+  while(m_pos < m_text.size() && (m_text[m_pos] == ' ' || m_text[m_pos] == '\n' || m_text[m_pos] == '\r' || m_text[m_pos] == '\t'))
+    m_pos++;
+}
+
+void JSONScanner::skipString()
+{
+  // m_pos is at the opening quote
+  for(m_pos++; m_pos < m_text.size(); m_pos++)
+  {
+    if(m_text[m_pos] == '\\')
+      m_pos++; // skip escaped character
+    else if(m_text[m_pos] == '"')
+    {
+      m_pos++;
+      return;
+    }
+  }
+  error();
+}
+
+void JSONScanner::expect(char c)
+{
+  if(!next(c))
+    error();
+}
+
+bool JSONScanner::next(char c)
+{
+  skipWhitespace();
+  if(m_pos < m_text.size() && m_text[m_pos] == c)
+  {
+    m_pos++;
+    return true;
+  }
+  return false;
+}
+
+std::string_view JSONScanner::readString()
+{
+  skipWhitespace();
+  if(m_pos >= m_text.size() || m_text[m_pos] != '"')
+    error();
+  const size_t start = m_pos;
+  skipString();
+  return m_text.substr(start + 1, m_pos - start - 2);
+}
+
+std::string_view JSONScanner::readValue()
+{
+  skipWhitespace();
+  if(m_pos >= m_text.size())
+    error();
+
+  const size_t start = m_pos;
+  switch(m_text[m_pos])
+  {
+    case '"':
+      skipString();
+      break;
+
+    case '{':
+    case '[':
+    {
+      size_t depth = 0;
+      do
+      {
+        if(m_pos >= m_text.size())
+          error();
+        switch(m_text[m_pos])
+        {
+          case '"':
+            skipString();
+            continue;
+
+          case '{':
+          case '[':
+            depth++;
+            break;
+
+          case '}':
+          case ']':
+            depth--;
+            break;
+        }
+        m_pos++;
+      }
+      while(depth != 0);
+      break;
+    }
+    case '}':
+    case ']':
+    case ',':
+    case ':':
+      error();
+
+    default: // number, true, false or null
+      while(m_pos < m_text.size() && m_text[m_pos] != ',' && m_text[m_pos] != '}' && m_text[m_pos] != ']' &&
+          m_text[m_pos] != ' ' && m_text[m_pos] != '\n' && m_text[m_pos] != '\r' && m_text[m_pos] != '\t')
+        m_pos++;
+      break;
+  }
+  return m_text.substr(start, m_pos - start);
+}
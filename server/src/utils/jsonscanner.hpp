@@ -0,0 +1,97 @@
+/**
+ * server/src/utils/jsonscanner.hpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TRAINTASTIC_SERVER_UTILS_JSONSCANNER_HPP
+#define TRAINTASTIC_SERVER_UTILS_JSONSCANNER_HPP
+
+#include <string_view>
+
+/**
+ * \brief Pull parser that only finds the boundaries of JSON values
+ *
+ * Values aren't decoded, the raw text of a value can be parsed later
+ * (or never), strings are returned with their escape sequences intact.
+ * Throws std::runtime_error on malformed input.
+ */
+class JSONScanner
+{
+  private:
+    std::string_view m_text;
+    size_t m_pos = 0;
+
+    [[noreturn]] void error() const;
+    void skipWhitespace();
+    void skipString();
+    void expect(char c);
+    bool next(char c);
+
+  public:
+    explicit JSONScanner(std::string_view text)
+      : m_text{text}
+    {
+    }
+
+    inline size_t position() const
+    {
+      return m_pos;
+    }
+
+    //! \brief Read a string value, returns its raw content without quotes
+    std::string_view readString();
+
+    //! \brief Read any value, returns its raw text
+    std::string_view readValue();
+
+    //! \brief Read an object, \a member is called with each key and must read the value
+    template<class F>
+    void readObject(F&& member)
+    {
+      expect('{');
+      if(next('}'))
+        return;
+      do
+      {
+        const std::string_view key = readString();
+        expect(':');
+        member(key);
+      }
+      while(next(','));
+      expect('}');
+    }
+
+    //! \brief Read an array, \a item is called for each item and must read it
+    template<class F>
+    void readArray(F&& item)
+    {
+      expect('[');
+      if(next(']'))
+        return;
+      do
+      {
+        item();
+      }
+      while(next(','));
+      expect(']');
+    }
+};
+
+#endif
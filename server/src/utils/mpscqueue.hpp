@@ -0,0 +1,126 @@
+/**
+ * server/src/utils/mpscqueue.hpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TRAINTASTIC_SERVER_UTILS_MPSCQUEUE_HPP
+#define TRAINTASTIC_SERVER_UTILS_MPSCQUEUE_HPP
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+
+/**
+ * \brief Bounded lock-free multi producer, single consumer queue
+ *
+ * Ring buffer with a sequence number per cell (Vyukov), producers claim a
+ * cell with a single CAS and never wait on each other or on the consumer.
+ * When the queue is full tryPush() fails, it is up to the caller to drop
+ * or retry.
+ *
+ * \tparam T Must be default constructible and move assignable.
+ */
+template<class T>
+class MPSCQueue
+{
+  private:
+    struct Cell
+    {
+      std::atomic_size_t sequence;
+      T value;
+    };
+
+    const size_t m_mask;
+    std::unique_ptr<Cell[]> m_cells;
+    alignas(64) std::atomic_size_t m_enqueuePos = 0;
+    alignas(64) std::atomic_size_t m_dequeuePos = 0; //!< only written by the consumer, atomic so size() can be used by producers
+
+  public:
+    /**
+     * \param[in] capacity Maximum number of items, must be a power of two.
+     */
+    explicit MPSCQueue(size_t capacity)
+      : m_mask{capacity - 1}
+      , m_cells{std::make_unique<Cell[]>(capacity)}
+    {
+      assert(capacity >= 2 && (capacity & (capacity - 1)) == 0);
+      for(size_t i = 0; i < capacity; i++)
+        m_cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    MPSCQueue(const MPSCQueue&) = delete;
+    MPSCQueue& operator =(const MPSCQueue&) = delete;
+
+    inline size_t capacity() const
+    {
+      return m_mask + 1;
+    }
+
+    //! \brief Number of queued items, only exact if there are no concurrent operations
+    inline size_t size() const
+    {
+      const size_t dequeuePos = m_dequeuePos.load(std::memory_order_relaxed);
+      const size_t enqueuePos = m_enqueuePos.load(std::memory_order_relaxed);
+      return enqueuePos > dequeuePos ? enqueuePos - dequeuePos : 0;
+    }
+
+    //! \brief Add an item, safe to call from multiple threads
+    //! \return \c false if the queue is full, \a value is left untouched
+    bool tryPush(T&& value)
+    {
+      Cell* cell;
+      size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+      for(;;)
+      {
+        cell = &m_cells[pos & m_mask];
+        const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        const auto diff = static_cast<std::ptrdiff_t>(sequence - pos);
+        if(diff == 0)
+        {
+          if(m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            break;
+        }
+        else if(diff < 0) // full
+          return false;
+        else // another producer claimed the cell
+          pos = m_enqueuePos.load(std::memory_order_relaxed);
+      }
+      cell->value = std::move(value);
+      cell->sequence.store(pos + 1, std::memory_order_release);
+      return true;
+    }
+
+    //! \brief Remove the oldest item, must only be called from the consumer thread
+    //! \return \c false if the queue is empty
+    bool tryPop(T& value)
+    {
+      const size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+      Cell& cell = m_cells[pos & m_mask];
+      if(static_cast<std::ptrdiff_t>(cell.sequence.load(std::memory_order_acquire) - (pos + 1)) < 0) // empty or not yet published
+        return false;
+      value = std::move(cell.value);
+      cell.sequence.store(pos + m_mask + 1, std::memory_order_release);
+      m_dequeuePos.store(pos + 1, std::memory_order_relaxed);
+      return true;
+    }
+};
+
+#endif
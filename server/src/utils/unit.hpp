@@ -28,6 +28,8 @@ struct Unit
 {
   static constexpr std::string_view ampere{"A"};
   static constexpr std::string_view degreeCelcius{"\u00B0C"};
+  static constexpr std::string_view meterPerSecondSquared{"m/s\u00B2"};
+  static constexpr std::string_view microSeconds{"\u00B5s"};
   static constexpr std::string_view milliSeconds{"ms"};
   static constexpr std::string_view percent{"%"};
   static constexpr std::string_view seconds{"s"};
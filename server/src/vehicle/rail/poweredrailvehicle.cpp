@@ -22,6 +22,7 @@
 
 #include "poweredrailvehicle.hpp"
 #include "../../core/attributes.hpp"
+#include "../../core/method.tpp"
 #include "../../core/objectproperty.tpp"
 #include "../../utils/almostzero.hpp"
 #include "../../utils/displayname.hpp"
@@ -34,6 +35,18 @@
 PoweredRailVehicle::PoweredRailVehicle(World& world, std::string_view id_)
   : RailVehicle(world, id_)
   , power{*this, "power", 0, PowerUnit::KiloWatt, PropertyFlags::ReadWrite | PropertyFlags::Store}
+  , setSpeedProfilePoint{*this, "set_speed_profile_point", MethodFlags::ScriptCallable,
+      [this](double throttle, double kmph)
+      {
+        m_speedProfile.set(throttle, kmph);
+        speedProfileChanged();
+      }}
+  , clearSpeedProfile{*this, "clear_speed_profile", MethodFlags::ScriptCallable,
+      [this]()
+      {
+        m_speedProfile.clear();
+        speedProfileChanged();
+      }}
 {
   const bool editable = contains(m_world.state.value(), WorldState::Edit);
 
@@ -43,6 +56,28 @@ PoweredRailVehicle::PoweredRailVehicle(World& world, std::string_view id_)
   Attributes::addEnabled(power, editable);
   Attributes::addObjectEditor(power, false); // FIXME: remove once used
   m_interfaceItems.add(power);
+
+  Attributes::addObjectEditor(setSpeedProfilePoint, false);
+  m_interfaceItems.add(setSpeedProfilePoint);
+
+  Attributes::addObjectEditor(clearSpeedProfile, false);
+  m_interfaceItems.add(clearSpeedProfile);
+}
+
+void PoweredRailVehicle::load(WorldLoader& loader, const nlohmann::json& data)
+{
+  RailVehicle::load(loader, data);
+
+  if(auto it = data.find("speed_profile"); it != data.end())
+    m_speedProfile.fromJSON(*it);
+}
+
+void PoweredRailVehicle::save(WorldSaver& saver, nlohmann::json& data, nlohmann::json& state) const
+{
+  RailVehicle::save(saver, data, state);
+
+  if(!m_speedProfile.empty())
+    data["speed_profile"] = m_speedProfile.toJSON();
 }
 
 void PoweredRailVehicle::setDirection(Direction value)
@@ -68,14 +103,20 @@ void PoweredRailVehicle::setSpeed(double kmph)
     return;
   }
 
-  //! \todo Implement speed profile
+  const uint8_t steps = decoder->speedSteps;
 
-  // No speed profile -> linear
+  if(!m_speedProfile.empty())
+  {
+    if(steps == Decoder::speedStepsAuto)
+      decoder->throttle.setValue(m_speedProfile.throttle(kmph));
+    else
+      decoder->throttle.setValue(static_cast<double>(m_speedProfile.step(kmph, steps)) / steps);
+  }
+  else // No speed profile -> linear
   {
     const double max = speedMax.getValue(SpeedUnit::KiloMeterPerHour);
     if(max > 0)
     {
-      const uint8_t steps = decoder->speedSteps;
       if(steps == Decoder::speedStepsAuto)
         decoder->throttle.setValue(kmph / max);
       else
@@ -86,6 +127,20 @@ void PoweredRailVehicle::setSpeed(double kmph)
   }
 }
 
+double PoweredRailVehicle::calcSpeedMax(SpeedUnit unit) const
+{
+  // the measured top speed is the maximum speed, trains use it to match their vehicles:
+  if(!m_speedProfile.empty())
+    return convertUnit(m_speedProfile.speedMax(), SpeedUnit::KiloMeterPerHour, unit);
+  return RailVehicle::calcSpeedMax(unit);
+}
+
+void PoweredRailVehicle::speedProfileChanged()
+{
+  for(const auto& train : trains)
+    train->updateSpeedMax();
+}
+
 void PoweredRailVehicle::worldEvent(WorldState state, WorldEvent event)
 {
   RailVehicle::worldEvent(state, event);
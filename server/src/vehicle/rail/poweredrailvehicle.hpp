@@ -26,16 +26,33 @@
 #include "railvehicle.hpp"
 #include <traintastic/enum/direction.hpp>
 #include "../../core/powerproperty.hpp"
+#include "speedprofile.hpp"
 
 class PoweredRailVehicle : public RailVehicle
 {
+  private:
+    SpeedProfile m_speedProfile;
+
+    void speedProfileChanged();
+
   protected:
     PoweredRailVehicle(World& world, std::string_view id_);
 
+    void load(WorldLoader& loader, const nlohmann::json& data) override;
+    void save(WorldSaver& saver, nlohmann::json& data, nlohmann::json& state) const override;
     void worldEvent(WorldState state, WorldEvent event) override;
 
   public:
     PowerProperty power;
+    Method<void(double, double)> setSpeedProfilePoint;
+    Method<void()> clearSpeedProfile;
+
+    const SpeedProfile& speedProfile() const
+    {
+      return m_speedProfile;
+    }
+
+    double calcSpeedMax(SpeedUnit unit) const override;
 
     void setDirection(Direction value);
     void setEmergencyStop(bool value);
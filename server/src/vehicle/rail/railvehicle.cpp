@@ -221,6 +221,11 @@ void RailVehicle::worldEvent(WorldState state, WorldEvent event)
   }
 }
 
+double RailVehicle::calcSpeedMax(SpeedUnit unit) const
+{
+  return speedMax.getValue(unit);
+}
+
 double RailVehicle::calcTotalWeight(WeightUnit unit) const
 {
   return weight.getValue(unit);
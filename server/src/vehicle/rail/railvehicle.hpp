@@ -64,6 +64,9 @@ class RailVehicle : public Vehicle
 
     void setActiveTrain(const std::shared_ptr<Train>& train);
 
+    //! \brief Maximum speed the vehicle can run at, defaults to the speed_max property
+    virtual double calcSpeedMax(SpeedUnit unit) const;
+
     void updateMute();
     void updateNoSmoke();
 };
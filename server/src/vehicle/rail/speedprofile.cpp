@@ -0,0 +1,152 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "speedprofile.hpp"
+#include <algorithm>
+#include <cassert>
+
+static constexpr SpeedProfile::Point zero{0, 0};
+
+void SpeedProfile::clear()
+{
+  m_points.clear();
+  update();
+}
+
+void SpeedProfile::set(double throttle, double speed)
+{
+  if(!(throttle > 0 && throttle <= 1) || !(speed >= 0)) // also rejects NaN
+    return;
+
+  const Point point{static_cast<float>(throttle), static_cast<float>(speed)};
+  auto it = std::lower_bound(m_points.begin(), m_points.end(), point.throttle,
+    [](const Point& p, float value)
+    {
+      return p.throttle < value;
+    });
+  if(it != m_points.end() && it->throttle == point.throttle)
+    *it = point;
+  else
+    m_points.insert(it, point);
+
+  update();
+}
+
+double SpeedProfile::speed(double throttle) const
+{
+  assert(!empty());
+
+  if(throttle <= 0)
+    return 0;
+
+  auto it = std::upper_bound(m_curve.begin(), m_curve.end(), throttle,
+    [](double value, const Point& p)
+    {
+      return value < p.throttle;
+    });
+  if(it == m_curve.end())
+    return m_curve.back().speed;
+
+  const Point& prev = (it == m_curve.begin()) ? zero : *(it - 1);
+  return prev.speed + (throttle - prev.throttle) * (it->speed - prev.speed) / (it->throttle - prev.throttle);
+}
+
+double SpeedProfile::throttle(double speed) const
+{
+  assert(!empty());
+
+  if(speed <= 0)
+    return 0;
+
+  // first point that is at least as fast:
+  auto it = std::lower_bound(m_curve.begin(), m_curve.end(), speed,
+    [](const Point& p, double value)
+    {
+      return p.speed < value;
+    });
+  if(it == m_curve.end())
+    return m_curve.back().throttle;
+
+  const Point& prev = (it == m_curve.begin()) ? zero : *(it - 1);
+  return prev.throttle + (speed - prev.speed) * (it->throttle - prev.throttle) / (it->speed - prev.speed);
+}
+
+uint8_t SpeedProfile::step(double speed, uint8_t steps) const
+{
+  assert(!empty());
+  assert(steps > 0);
+
+  if(speed <= 0)
+    return 0;
+
+  if(m_stepSpeeds.size() != static_cast<size_t>(steps) + 1)
+  {
+    m_stepSpeeds.resize(static_cast<size_t>(steps) + 1);
+    for(size_t i = 0; i <= steps; i++)
+      m_stepSpeeds[i] = static_cast<float>(this->speed(static_cast<double>(i) / steps));
+  }
+
+  // skip the steps at which the vehicle doesn't move yet, a requested speed must result in movement:
+  const auto first = std::upper_bound(m_stepSpeeds.begin() + 1, m_stepSpeeds.end(), 0.0f);
+  if(first == m_stepSpeeds.end())
+    return 0;
+
+  auto it = std::lower_bound(first, m_stepSpeeds.end(), speed,
+    [](float value, double s)
+    {
+      return value < s;
+    });
+  if(it == m_stepSpeeds.end())
+    return steps;
+  if(it != first && speed - *(it - 1) < *it - speed) // previous step is closer
+    --it;
+  return static_cast<uint8_t>(it - m_stepSpeeds.begin());
+}
+
+nlohmann::json SpeedProfile::toJSON() const
+{
+  nlohmann::json data = nlohmann::json::array();
+  for(const auto& point : m_points)
+    data.push_back(nlohmann::json::array({point.throttle, point.speed}));
+  return data;
+}
+
+void SpeedProfile::fromJSON(const nlohmann::json& data)
+{
+  m_points.clear();
+  if(data.is_array())
+  {
+    for(const auto& point : data)
+      if(point.is_array() && point.size() == 2 && point[0].is_number() && point[1].is_number())
+        set(point[0].get<double>(), point[1].get<double>());
+  }
+  update();
+}
+
+void SpeedProfile::update()
+{
+  // speed must not decrease with throttle, else it can't be inverted:
+  m_curve = m_points;
+  for(size_t i = 1; i < m_curve.size(); i++)
+    m_curve[i].speed = std::max(m_curve[i].speed, m_curve[i - 1].speed);
+
+  m_stepSpeeds.clear();
+}
@@ -0,0 +1,87 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TRAINTASTIC_SERVER_VEHICLE_RAIL_SPEEDPROFILE_HPP
+#define TRAINTASTIC_SERVER_VEHICLE_RAIL_SPEEDPROFILE_HPP
+
+#include <cstdint>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+/**
+ * \brief Measured speed curve of a powered rail vehicle
+ *
+ * The profile is a table of (throttle, speed) points sorted by throttle,
+ * speeds in between are linearly interpolated. Throttle zero is always
+ * zero speed and isn't stored. The measured points are kept as is, lookups
+ * use a derived curve in which speed doesn't decrease so it can be inverted.
+ */
+class SpeedProfile
+{
+  public:
+    struct Point
+    {
+      float throttle; //!< 0 < throttle <= 1
+      float speed; //!< km/h
+    };
+
+  private:
+    std::vector<Point> m_points; //!< as measured
+    std::vector<Point> m_curve; //!< m_points with non-decreasing speed, used for lookups
+    mutable std::vector<float> m_stepSpeeds; //!< speed per speed step for the last used step count, index 0 is stop
+
+    void update();
+
+  public:
+    inline bool empty() const
+    {
+      return m_points.empty();
+    }
+
+    //! \brief Measured points, sorted by throttle
+    inline const std::vector<Point>& points() const
+    {
+      return m_points;
+    }
+
+    //! \brief Speed at full throttle in km/h
+    inline double speedMax() const
+    {
+      return m_curve.empty() ? 0 : m_curve.back().speed;
+    }
+
+    void clear();
+    void set(double throttle, double speed);
+
+    //! \brief Speed in km/h for throttle, O(log n)
+    double speed(double throttle) const;
+
+    //! \brief Throttle for speed in km/h, O(log n)
+    double throttle(double speed) const;
+
+    //! \brief Speed step closest to speed in km/h, uses a table precomputed per step count
+    uint8_t step(double speed, uint8_t steps) const;
+
+    nlohmann::json toJSON() const;
+    void fromJSON(const nlohmann::json& data);
+};
+
+#endif
@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2021-2022 Reinder Feenstra
+ * Copyright (C) 2021-2022,2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -112,3 +112,13 @@ bool CTWReader::readFile(const std::filesystem::path& filename, std::string& tex
   text.assign(reinterpret_cast<const char*>(it->second.data()), it->second.size());
   return true;
 }
+
+bool CTWReader::getFile(const std::filesystem::path& filename, std::string_view& text) const
+{
+  auto it = m_files.find(filename.generic_string());
+  if(it == m_files.end())
+    return false;
+
+  text = {reinterpret_cast<const char*>(it->second.data()), it->second.size()};
+  return true;
+}
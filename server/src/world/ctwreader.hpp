@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2021-2022 Reinder Feenstra
+ * Copyright (C) 2021-2022,2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -46,6 +46,9 @@ class CTWReader
 
     bool readFile(const std::filesystem::path& filename, nlohmann::json& data);
     bool readFile(const std::filesystem::path& filename, std::string& text);
+
+    //! \brief Get file contents without copying, valid for the lifetime of the reader
+    bool getFile(const std::filesystem::path& filename, std::string_view& text) const;
 };
 
 #endif
\ No newline at end of file
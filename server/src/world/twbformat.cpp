@@ -0,0 +1,56 @@
+/**
+ * server/src/world/twbformat.cpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "twbformat.hpp"
+#include <vector>
+#include "world.hpp"
+
+uint64_t TWB::sourceStamp(const std::filesystem::path& world)
+{
+  std::error_code ec;
+  std::vector<std::filesystem::path> files;
+  if(std::filesystem::is_directory(world, ec))
+    files = {world / World::filename, world / World::filenameState};
+  else
+    files = {world};
+
+  // FNV-1a over the size and time of each file:
+  uint64_t stamp = 14695981039346656037ULL;
+  const auto add =
+    [&stamp](uint64_t value)
+    {
+      stamp = (stamp ^ value) * 1099511628211ULL;
+    };
+
+  for(const auto& filename : files)
+  {
+    const auto size = std::filesystem::file_size(filename, ec);
+    if(ec)
+      return 0;
+    const auto time = std::filesystem::last_write_time(filename, ec);
+    if(ec)
+      return 0;
+    add(size);
+    add(static_cast<uint64_t>(time.time_since_epoch().count()));
+  }
+  return stamp != 0 ? stamp : 1; // zero is reserved for unknown
+}
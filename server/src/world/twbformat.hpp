@@ -0,0 +1,93 @@
+/**
+ * server/src/world/twbformat.hpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TRAINTASTIC_SERVER_WORLD_TWBFORMAT_HPP
+#define TRAINTASTIC_SERVER_WORLD_TWBFORMAT_HPP
+
+#include <cstdint>
+#include <traintastic/utils/stdfilesystem.hpp>
+
+/**
+ * \brief Binary world snapshot (.twb) file layout
+ *
+ * All integers are in host byte order, a snapshot written on a host with a
+ * different byte order fails the version check. Offsets are relative to
+ * the start of the file and 8 byte aligned, so the file can be used in
+ * place (read or mapped) without further decoding:
+ *
+ * | Header                                                 |
+ * | Blob strings[stringCount]        object ids, class ids and file names |
+ * | Entry objects[objectCount]       sorted by class id, then id |
+ * | Entry stateObjects[stateObjectCount] |
+ * | Entry states[stateCount]         classId unused |
+ * | Entry files[fileCount]           classId unused |
+ * | data                             strings, CBOR encoded objects and file contents |
+ */
+namespace TWB {
+
+constexpr char magic[4] = {'T', 'T', 'W', 'B'};
+constexpr uint32_t version = 2;
+constexpr uint32_t alignment = 8;
+
+struct Blob
+{
+  uint64_t offset;
+  uint64_t size;
+};
+static_assert(sizeof(Blob) == 16);
+
+struct Entry
+{
+  uint32_t name; //!< index in string table
+  uint32_t classId; //!< index in string table
+  Blob data;
+};
+static_assert(sizeof(Entry) == 24);
+
+struct Header
+{
+  char magic[4];
+  uint32_t version;
+  uint32_t stringCount;
+  uint32_t objectCount;
+  uint32_t stateObjectCount;
+  uint32_t stateCount;
+  uint32_t fileCount;
+  uint32_t reserved;
+  Blob world; //!< CBOR encoded world properties
+  uint64_t source; //!< sourceStamp() of the world the snapshot was written for, zero if unknown
+};
+static_assert(sizeof(Header) == 56);
+
+/**
+ * \brief Stamp of a world directory or \c .ctw archive, based on file sizes and modification times
+ *
+ * A snapshot is only current if its stamp still matches the world, unlike
+ * comparing times alone this also detects a world restored from a backup.
+ *
+ * \return Stamp, zero if a world file can't be accessed
+ */
+uint64_t sourceStamp(const std::filesystem::path& world);
+
+}
+
+#endif
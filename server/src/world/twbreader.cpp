@@ -0,0 +1,169 @@
+/**
+ * server/src/world/twbreader.cpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "twbreader.hpp"
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+static void corrupt()
+{
+  throw std::runtime_error("corrupt world snapshot");
+}
+
+bool TWBReader::isSnapshot(const std::vector<std::byte>& memory)
+{
+  return memory.size() >= sizeof(TWB::Header) && std::memcmp(memory.data(), TWB::magic, sizeof(TWB::magic)) == 0;
+}
+
+bool TWBReader::isCurrent(const std::filesystem::path& filename, const std::filesystem::path& world)
+{
+  std::ifstream file(filename, std::ios::in | std::ios::binary);
+  TWB::Header header;
+  if(!file.read(reinterpret_cast<char*>(&header), sizeof(header)))
+    return false;
+  return
+    std::memcmp(header.magic, TWB::magic, sizeof(header.magic)) == 0 &&
+    header.version == TWB::version &&
+    header.source != 0 &&
+    header.source == TWB::sourceStamp(world);
+}
+
+TWBReader::TWBReader(const std::filesystem::path& filename)
+{
+  std::ifstream file(filename, std::ios::in | std::ios::binary | std::ios::ate);
+  if(!file.is_open())
+    throw std::runtime_error("can't open " + filename.string());
+  const auto size = static_cast<size_t>(file.tellg());
+  m_data.resize(size);
+  file.seekg(std::ios::beg);
+  file.read(reinterpret_cast<char*>(m_data.data()), static_cast<std::streamsize>(size));
+  if(!file)
+    throw std::runtime_error("can't read " + filename.string());
+
+  init();
+}
+
+TWBReader::TWBReader(const std::vector<std::byte>& memory)
+  : m_data{memory}
+{
+  init();
+}
+
+void TWBReader::init()
+{
+  if(!isSnapshot(m_data))
+    corrupt();
+
+  std::memcpy(&m_header, m_data.data(), sizeof(m_header));
+  if(m_header.version != TWB::version)
+    throw std::runtime_error("unsupported world snapshot version");
+
+  // tables must fit, blobs are checked when used:
+  if(sectionOffset(Section::Files) + static_cast<uint64_t>(m_header.fileCount) * sizeof(TWB::Entry) > m_data.size())
+    corrupt();
+}
+
+size_t TWBReader::sectionOffset(Section section) const
+{
+  size_t offset = sizeof(TWB::Header) + static_cast<size_t>(m_header.stringCount) * sizeof(TWB::Blob);
+  switch(section)
+  {
+    case Section::Files:
+      offset += static_cast<size_t>(m_header.stateCount) * sizeof(TWB::Entry);
+      [[fallthrough]];
+    case Section::States:
+      offset += static_cast<size_t>(m_header.stateObjectCount) * sizeof(TWB::Entry);
+      [[fallthrough]];
+    case Section::StateObjects:
+      offset += static_cast<size_t>(m_header.objectCount) * sizeof(TWB::Entry);
+      [[fallthrough]];
+    case Section::Objects:
+      break;
+  }
+  return offset;
+}
+
+uint32_t TWBReader::count(Section section) const
+{
+  switch(section)
+  {
+    case Section::Objects:
+      return m_header.objectCount;
+    case Section::StateObjects:
+      return m_header.stateObjectCount;
+    case Section::States:
+      return m_header.stateCount;
+    case Section::Files:
+      return m_header.fileCount;
+  }
+  return 0;
+}
+
+TWB::Entry TWBReader::entry(Section section, uint32_t index) const
+{
+  if(index >= count(section))
+    corrupt();
+  TWB::Entry entry;
+  std::memcpy(&entry, m_data.data() + sectionOffset(section) + index * sizeof(TWB::Entry), sizeof(entry));
+  return entry;
+}
+
+std::string_view TWBReader::string(uint32_t index) const
+{
+  if(index >= m_header.stringCount)
+    corrupt();
+  TWB::Blob b;
+  std::memcpy(&b, m_data.data() + sizeof(TWB::Header) + index * sizeof(TWB::Blob), sizeof(b));
+  return blob(b);
+}
+
+std::string_view TWBReader::blob(const TWB::Blob& blob) const
+{
+  if(blob.offset > m_data.size() || blob.size > m_data.size() - blob.offset)
+    corrupt();
+  return {reinterpret_cast<const char*>(m_data.data()) + blob.offset, static_cast<size_t>(blob.size)};
+}
+
+bool TWBReader::getFile(const std::filesystem::path& filename, std::string_view& data) const
+{
+  const std::string name = filename.generic_string();
+  for(uint32_t i = 0; i < m_header.fileCount; i++)
+  {
+    const auto file = entry(Section::Files, i);
+    if(string(file.name) == name)
+    {
+      data = blob(file.data);
+      return true;
+    }
+  }
+  return false;
+}
+
+bool TWBReader::readFile(const std::filesystem::path& filename, std::string& data) const
+{
+  std::string_view sv;
+  if(!getFile(filename, sv))
+    return false;
+  data.assign(sv);
+  return true;
+}
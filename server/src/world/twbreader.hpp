@@ -0,0 +1,82 @@
+/**
+ * server/src/world/twbreader.hpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TRAINTASTIC_SERVER_WORLD_TWBREADER_HPP
+#define TRAINTASTIC_SERVER_WORLD_TWBREADER_HPP
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <traintastic/utils/stdfilesystem.hpp>
+#include "twbformat.hpp"
+
+/**
+ * \brief Reader for binary world snapshots
+ *
+ * \see TWB
+ */
+class TWBReader
+{
+  public:
+    enum class Section
+    {
+      Objects,
+      StateObjects,
+      States,
+      Files,
+    };
+
+  private:
+    std::vector<std::byte> m_data;
+    TWB::Header m_header;
+
+    void init();
+    size_t sectionOffset(Section section) const;
+
+  public:
+    //! \brief Check if memory contains a snapshot (or a CTW)
+    static bool isSnapshot(const std::vector<std::byte>& memory);
+
+    //! \brief Check if the snapshot file is written for the current state of \p world, only reads the header
+    static bool isCurrent(const std::filesystem::path& filename, const std::filesystem::path& world);
+
+    TWBReader(const std::filesystem::path& filename);
+    TWBReader(const std::vector<std::byte>& memory);
+
+    uint32_t count(Section section) const;
+    TWB::Entry entry(Section section, uint32_t index) const;
+
+    std::string_view string(uint32_t index) const;
+    std::string_view blob(const TWB::Blob& blob) const;
+
+    //! \brief CBOR encoded world properties
+    std::string_view world() const
+    {
+      return blob(m_header.world);
+    }
+
+    bool getFile(const std::filesystem::path& filename, std::string_view& data) const;
+    bool readFile(const std::filesystem::path& filename, std::string& data) const;
+};
+
+#endif
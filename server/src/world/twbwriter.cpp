@@ -0,0 +1,166 @@
+/**
+ * server/src/world/twbwriter.cpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "twbwriter.hpp"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+using nlohmann::json;
+
+static void pad(std::string& data)
+{
+  data.resize((data.size() + TWB::alignment - 1) & ~static_cast<size_t>(TWB::alignment - 1), '\0');
+}
+
+template<class T>
+static void append(std::string& data, const T& value)
+{
+  data.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+uint32_t TWBWriter::addString(std::string_view value)
+{
+  if(auto it = m_stringIndex.find(value); it != m_stringIndex.end())
+    return it->second;
+
+  const auto index = static_cast<uint32_t>(m_stringBlobs.size());
+  const auto& str = m_strings.emplace_back(value); // deque: references stay valid
+  m_stringIndex.emplace(str, index);
+  m_stringBlobs.emplace_back(addData(str));
+  return index;
+}
+
+TWB::Blob TWBWriter::addData(std::string_view data)
+{
+  pad(m_data);
+  const TWB::Blob blob{m_data.size(), data.size()};
+  m_data.append(data);
+  return blob;
+}
+
+TWB::Blob TWBWriter::addCBOR(const json& data)
+{
+  pad(m_data);
+  const uint64_t offset = m_data.size();
+  json::to_cbor(data, m_data); // appends
+  return {offset, m_data.size() - offset};
+}
+
+void TWBWriter::writeWorld(const json& data, const json& state)
+{
+  {
+    json world = json::object();
+    for(const auto& [key, value] : data.items())
+      if(key != "objects")
+        world[key] = value;
+    m_world = addCBOR(world);
+  }
+
+  if(auto objects = data.find("objects"); objects != data.end() && objects->is_array())
+  {
+    // sorted by class, objects of the same class are created after each other which keeps
+    // the allocator and instruction cache warm while loading:
+    std::vector<const json*> sorted;
+    sorted.reserve(objects->size());
+    for(const auto& object : *objects)
+      if(object.is_object())
+        sorted.emplace_back(&object);
+    std::stable_sort(sorted.begin(), sorted.end(),
+      [](const json* a, const json* b)
+      {
+        return a->value("class_id", "") < b->value("class_id", "");
+      });
+
+    m_objects.reserve(sorted.size());
+    for(const json* object : sorted)
+      m_objects.push_back({addString(object->value("id", "")), addString(object->value("class_id", "")), addCBOR(*object)});
+  }
+
+  if(auto objects = state.find("objects"); objects != state.end() && objects->is_array())
+  {
+    m_stateObjects.reserve(objects->size());
+    for(const auto& object : *objects)
+      if(object.is_object())
+        m_stateObjects.push_back({addString(object.value("id", "")), addString(object.value("class_id", "")), addCBOR(object)});
+  }
+
+  if(auto states = state.find("states"); states != state.end() && states->is_object())
+  {
+    m_states.reserve(states->size());
+    for(const auto& [id, value] : states->items())
+      m_states.push_back({addString(id), 0, addCBOR(value)});
+  }
+}
+
+void TWBWriter::writeFile(const std::filesystem::path& filename, std::string_view data)
+{
+  const auto name = addString(filename.generic_string());
+  const auto blob = addData(data);
+  m_files.push_back({name, 0, blob});
+}
+
+std::string TWBWriter::finish()
+{
+  const uint64_t dataOffset =
+    sizeof(TWB::Header) +
+    m_stringBlobs.size() * sizeof(TWB::Blob) +
+    (m_objects.size() + m_stateObjects.size() + m_states.size() + m_files.size()) * sizeof(TWB::Entry);
+  static_assert(sizeof(TWB::Header) % TWB::alignment == 0);
+  static_assert(sizeof(TWB::Blob) % TWB::alignment == 0);
+  static_assert(sizeof(TWB::Entry) % TWB::alignment == 0);
+
+  const auto relocate =
+    [dataOffset](TWB::Blob blob)
+    {
+      blob.offset += dataOffset;
+      return blob;
+    };
+
+  TWB::Header header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, TWB::magic, sizeof(header.magic));
+  header.version = TWB::version;
+  header.stringCount = static_cast<uint32_t>(m_stringBlobs.size());
+  header.objectCount = static_cast<uint32_t>(m_objects.size());
+  header.stateObjectCount = static_cast<uint32_t>(m_stateObjects.size());
+  header.stateCount = static_cast<uint32_t>(m_states.size());
+  header.fileCount = static_cast<uint32_t>(m_files.size());
+  header.world = relocate(m_world);
+  header.source = m_source;
+
+  std::string out;
+  out.reserve(dataOffset + m_data.size());
+  append(out, header);
+  for(const auto& blob : m_stringBlobs)
+    append(out, relocate(blob));
+  for(const auto* entries : {&m_objects, &m_stateObjects, &m_states, &m_files})
+    for(auto entry : *entries)
+    {
+      entry.data = relocate(entry.data);
+      append(out, entry);
+    }
+  if(out.size() != dataOffset)
+    throw std::logic_error("TWB table size mismatch");
+  out.append(m_data);
+  return out;
+}
@@ -0,0 +1,79 @@
+/**
+ * server/src/world/twbwriter.hpp
+ *
+ * This file is part of the traintastic source code.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TRAINTASTIC_SERVER_WORLD_TWBWRITER_HPP
+#define TRAINTASTIC_SERVER_WORLD_TWBWRITER_HPP
+
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include <traintastic/utils/stdfilesystem.hpp>
+#include "twbformat.hpp"
+
+/**
+ * \brief Writer for binary world snapshots
+ *
+ * \see TWB
+ */
+class TWBWriter
+{
+  private:
+    std::deque<std::string> m_strings;
+    std::unordered_map<std::string_view, uint32_t> m_stringIndex;
+    std::vector<TWB::Blob> m_stringBlobs;
+    std::vector<TWB::Entry> m_objects;
+    std::vector<TWB::Entry> m_stateObjects;
+    std::vector<TWB::Entry> m_states;
+    std::vector<TWB::Entry> m_files;
+    TWB::Blob m_world{0, 0};
+    uint64_t m_source = 0;
+    std::string m_data; //!< data area, offsets are relative until finish()
+
+    uint32_t addString(std::string_view value);
+    TWB::Blob addData(std::string_view data);
+    TWB::Blob addCBOR(const nlohmann::json& data);
+
+  public:
+    /**
+     * \brief Add the world and its state
+     *
+     * \param[in] data World as stored in \ref World::filename
+     * \param[in] state State as stored in \ref World::filenameState
+     */
+    void writeWorld(const nlohmann::json& data, const nlohmann::json& state);
+
+    void writeFile(const std::filesystem::path& filename, std::string_view data);
+
+    //! \brief Set the TWB::sourceStamp() of the world the snapshot belongs to
+    void setSource(uint64_t stamp)
+    {
+      m_source = stamp;
+    }
+
+    //! \brief Build the snapshot
+    std::string finish();
+};
+
+#endif
@@ -28,9 +28,11 @@
 
 #include "worldsaver.hpp"
 
+#include "../core/eventloop.hpp"
 #include "../log/log.hpp"
 #include "../log/logmessageexception.hpp"
 #include "../utils/datetimestr.hpp"
+#include "../utils/setthreadname.hpp"
 #include "../utils/displayname.hpp"
 #include "../traintastic/traintastic.hpp"
 
@@ -64,6 +66,7 @@
 #include "../board/list/linkrailtilelist.hpp"
 #include "../board/nx/nxmanager.hpp"
 #include "../board/pathfinder/trainpathfinder.hpp"
+#include "../board/pathfinder/trainroute.hpp"
 #include "../board/tile/rail/nxbuttonrailtile.hpp"
 
 #include "../zone/zone.hpp"
@@ -72,6 +75,7 @@
 #include "../throttle/list/throttlelist.hpp"
 #include "../train/train.hpp"
 #include "../train/trainlist.hpp"
+#include "../train/trainmotionscheduler.hpp"
 #include "../vehicle/rail/railvehiclelist.hpp"
 #include "../lua/scriptlist.hpp"
 #include "../status/simulationstatus.hpp"
@@ -85,6 +89,31 @@ constexpr auto outputListColumns = OutputListColumn::Interface | OutputListColum
 constexpr auto identificationListColumns = IdentificationListColumn::Id | IdentificationListColumn::Name | IdentificationListColumn::Interface /*| IdentificationListColumn::Channel*/ | IdentificationListColumn::Address;
 constexpr auto throttleListColumns = ThrottleListColumn::Name | ThrottleListColumn::Train | ThrottleListColumn::Interface;
 
+static void saved(const WorldSaver::Result& result, const std::string& uuid, const std::string& name, const std::filesystem::path& savePath)
+{
+  if(result.createBackupDirectory)
+    Log::log(World::id, LogMessage::C1007_CREATING_WORLD_BACKUP_DIRECTORY_FAILED_X, result.createBackupDirectory);
+  if(result.createBackup)
+    Log::log(World::id, LogMessage::C1006_CREATING_WORLD_BACKUP_FAILED_X, result.createBackup);
+
+  if(!result.error.empty())
+  {
+    Log::log(World::id, LogMessage::C1005_SAVING_WORLD_FAILED_X, result.error);
+    return;
+  }
+
+  if(!result.snapshotError.empty())
+    Log::log(World::id, LogMessage::W1005_WRITING_WORLD_SNAPSHOT_FAILED_X, result.snapshotError);
+
+  if(Traintastic::instance)
+  {
+    Traintastic::instance->settings->lastWorld = uuid;
+    Traintastic::instance->worldList->update(uuid, name, savePath);
+  }
+
+  Log::log(World::id, LogMessage::N1022_SAVED_WORLD_X, name);
+}
+
 template<class T>
 inline static void deleteAll(T& objectList)
 {
@@ -145,6 +174,7 @@ void World::init(World& world)
   world.linkRailTiles.setValueInternal(std::make_shared<LinkRailTileList>(world, world.linkRailTiles.name()));
   world.nxManager.setValueInternal(std::make_shared<NXManager>(world, world.nxManager.name()));
   world.trainPathFinder.setValueInternal(std::make_shared<TrainPathFinder>(world, world.trainPathFinder.name()));
+  world.trainMotionScheduler.setValueInternal(std::make_shared<TrainMotionScheduler>(world, world.trainMotionScheduler.name()));
 
   world.simulationStatus.setValueInternal(std::make_shared<SimulationStatus>(world, world.simulationStatus.name()));
 }
@@ -205,6 +235,7 @@ World::World(Private /*unused*/) :
   linkRailTiles{this, "link_rail_tiles", nullptr, PropertyFlags::ReadOnly | PropertyFlags::SubObject | PropertyFlags::NoStore},
   nxManager{this, "nx_manager", nullptr, PropertyFlags::ReadOnly | PropertyFlags::SubObject | PropertyFlags::NoStore},
   trainPathFinder{this, "train_path_finder", nullptr, PropertyFlags::ReadOnly | PropertyFlags::SubObject | PropertyFlags::NoStore | PropertyFlags::ScriptReadOnly},
+  trainMotionScheduler{this, "train_motion_scheduler", nullptr, PropertyFlags::ReadOnly | PropertyFlags::SubObject | PropertyFlags::Store},
   statuses(*this, "statuses", {}, PropertyFlags::ReadOnly | PropertyFlags::Store),
   hardwareThrottles{this, "hardware_throttles", 0, PropertyFlags::ReadOnly | PropertyFlags::NoStore | PropertyFlags::NoScript},
   state{this, "state", WorldState(), PropertyFlags::ReadOnly | PropertyFlags::NoStore | PropertyFlags::ScriptReadOnly},
@@ -282,55 +313,7 @@ World::World(Private /*unused*/) :
   save{*this, "save", MethodFlags::NoScript,
     [this]()
     {
-      try
-      {
-        // backup world:
-        const std::filesystem::path worldDir = Traintastic::instance->worldDir();
-        const std::filesystem::path worldBackupDir = Traintastic::instance->worldBackupDir();
-
-        if(!std::filesystem::is_directory(worldBackupDir))
-        {
-          std::error_code ec;
-          std::filesystem::create_directories(worldBackupDir, ec);
-          if(ec)
-            Log::log(*this, LogMessage::C1007_CREATING_WORLD_BACKUP_DIRECTORY_FAILED_X, ec);
-        }
-
-        if(std::filesystem::is_directory(worldDir / uuid.value()))
-        {
-          std::error_code ec;
-          std::filesystem::rename(worldDir / uuid.value(), worldBackupDir / uuid.value() += dateTimeStr(), ec);
-          if(ec)
-            Log::log(*this, LogMessage::C1006_CREATING_WORLD_BACKUP_FAILED_X, ec);
-        }
-
-        if(std::filesystem::is_regular_file(worldDir / uuid.value() += dotCTW))
-        {
-          std::error_code ec;
-          std::filesystem::rename(worldDir / uuid.value() += dotCTW, worldBackupDir / uuid.value() += dateTimeStr() += dotCTW, ec);
-          if(ec)
-            Log::log(*this, LogMessage::C1006_CREATING_WORLD_BACKUP_FAILED_X, ec);
-        }
-
-        // save world:
-        std::filesystem::path savePath = worldDir / uuid.value();
-        if(!Traintastic::instance->settings->saveWorldUncompressed)
-          savePath += dotCTW;
-
-        WorldSaver saver(*this, savePath);
-
-        if(Traintastic::instance)
-        {
-          Traintastic::instance->settings->lastWorld = uuid.value();
-          Traintastic::instance->worldList->update(*this, savePath);
-        }
-
-        Log::log(*this, LogMessage::N1022_SAVED_WORLD_X, name.value());
-      }
-      catch(const std::exception& e)
-      {
-        Log::log(*this, LogMessage::C1005_SAVING_WORLD_FAILED_X, e);
-      }
+      saveWorld(Traintastic::instance->settings->saveWorldInBackground);
     }}
   , getObject_{*this, "get_object", MethodFlags::Internal | MethodFlags::ScriptCallable,
       [this](const std::string& objectId)
@@ -440,6 +423,8 @@ World::World(Private /*unused*/) :
   m_interfaceItems.add(nxManager);
   Attributes::addObjectEditor(trainPathFinder, false);
   m_interfaceItems.add(trainPathFinder);
+  Attributes::addObjectEditor(trainMotionScheduler, false);
+  m_interfaceItems.add(trainMotionScheduler);
 
   Attributes::addObjectEditor(statuses, false);
   m_interfaceItems.add(statuses);
@@ -489,6 +474,7 @@ World::World(Private /*unused*/) :
 
 World::~World()
 {
+  waitForSave();
   luaScripts->stopAll(); // no surprise event actions during destruction
 
   deleteAll(*interfaces);
@@ -578,6 +564,71 @@ void World::export_(std::vector<std::byte>& data)
   }
 }
 
+void World::saveWorld(bool background)
+{
+  // one save at a time, the next snapshot must not overtake the previous one:
+  if(background && m_saveThread.joinable())
+  {
+    m_savePending = true; // don't block the event loop, save the then current state when the running save is finished
+    return;
+  }
+  waitForSave();
+  m_savePending = false;
+
+  std::unique_ptr<WorldSaver> saver;
+  try
+  {
+    saver = std::make_unique<WorldSaver>(*this); // snapshot, must be taken on the event loop
+  }
+  catch(const std::exception& e)
+  {
+    Log::log(*this, LogMessage::C1005_SAVING_WORLD_FAILED_X, e);
+    return;
+  }
+
+  const std::filesystem::path worldDir = Traintastic::instance->worldDir();
+  const std::filesystem::path worldBackupDir = Traintastic::instance->worldBackupDir();
+
+  std::filesystem::path savePath = worldDir / uuid.value();
+  if(!Traintastic::instance->settings->saveWorldUncompressed)
+    savePath += dotCTW;
+  const std::filesystem::path backupPath = worldBackupDir / uuid.value() += dateTimeStr();
+  const bool snapshot = Traintastic::instance->settings->saveWorldSnapshot;
+
+  if(!background)
+  {
+    saved(saver->save(savePath, backupPath, snapshot), uuid, name, savePath);
+    return;
+  }
+
+  m_saveThread = std::thread(
+    [saver=std::move(saver), savePath, backupPath, snapshot, worldUuid=uuid.value(), worldName=name.value(), weak=weak_from_this()]()
+    {
+      setThreadName("world-save");
+      auto result = saver->save(savePath, backupPath, snapshot);
+      EventLoop::call(
+        [result=std::move(result), worldUuid, worldName, savePath, weak]()
+        {
+          saved(result, worldUuid, worldName, savePath);
+          if(auto object = weak.lock())
+            static_cast<World&>(*object).saveFinished();
+        });
+    });
+}
+
+void World::saveFinished()
+{
+  waitForSave(); // the save thread is done, only its exit is left
+  if(m_savePending)
+    saveWorld(true);
+}
+
+void World::waitForSave()
+{
+  if(m_saveThread.joinable())
+    m_saveThread.join();
+}
+
 void World::loaded()
 {
   updateFeatures();
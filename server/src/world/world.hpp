@@ -30,6 +30,7 @@
 #include "../core/method.hpp"
 #include "../core/event.hpp"
 #include <unordered_map>
+#include <thread>
 #include <boost/uuid/uuid.hpp>
 #include <traintastic/enum/externaloutputchangeaction.hpp>
 #include <traintastic/enum/worldevent.hpp>
@@ -57,6 +58,7 @@ class BlockRailTileList;
 class LinkRailTileList;
 class NXManager;
 class TrainPathFinder;
+class TrainMotionScheduler;
 class Clock;
 class ThrottleList;
 class TrainList;
@@ -82,7 +84,12 @@ class World : public Object
     struct Private {};
 
     WorldFeatures m_features;
+    std::thread m_saveThread;
+    bool m_savePending = false; //!< save again when the running background save is finished
 
+    void saveWorld(bool background);
+    void saveFinished();
+    void waitForSave();
     void updateEnabled();
     void updateFeatures();
     void updateScaleRatio();
@@ -104,6 +111,7 @@ class World : public Object
 
     static constexpr std::string_view id = classId;
     static constexpr std::string_view dotCTW = ".ctw";
+    static constexpr std::string_view dotTWB = ".twb"; //!< binary snapshot, see \ref TWB
     static constexpr std::string_view filename = "traintastic.json";
     static constexpr std::string_view filenameState = "traintastic.state.json";
 
@@ -152,6 +160,7 @@ class World : public Object
     ObjectProperty<LinkRailTileList> linkRailTiles;
     ObjectProperty<NXManager> nxManager;
     ObjectProperty<TrainPathFinder> trainPathFinder;
+    ObjectProperty<TrainMotionScheduler> trainMotionScheduler;
 
     ObjectVectorProperty<Status> statuses;
     Property<uint32_t> hardwareThrottles; //<! number of connected hardware throttles
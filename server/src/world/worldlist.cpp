@@ -104,18 +104,18 @@ void WorldList::buildIndex()
   //  model->setRowCount(m_items.size());
 }
 
-void WorldList::update(World& world, const std::filesystem::path& path)
+void WorldList::update(const std::string& uuid, const std::string& name, const std::filesystem::path& path)
 {
-  const auto uuid = boost::uuids::string_generator()(world.uuid.value());
+  const auto worldUuid = boost::uuids::string_generator()(uuid);
 
-  if(auto it = std::find_if(m_items.begin(), m_items.end(), [&uuid](const auto& item){ return item.uuid == uuid; }); it != m_items.end())
+  if(auto it = std::find_if(m_items.begin(), m_items.end(), [&worldUuid](const auto& item){ return item.uuid == worldUuid; }); it != m_items.end())
   {
-    it->name = world.name;
+    it->name = name;
     it->path = path;
   }
   else // new world
   {
-    m_items.emplace_back(WorldInfo{uuid, world.name.value(), path});
+    m_items.emplace_back(WorldInfo{worldUuid, name, path});
   }
 }
 
@@ -29,7 +29,6 @@
 #include <vector>
 #include <boost/uuid/uuid.hpp>
 
-class World;
 class WorldListTableModel;
 
 class WorldList : public Object, public Table
@@ -76,7 +75,7 @@ class WorldList : public Object, public Table
 
     void buildIndex();
 
-    void update(World& world, const std::filesystem::path& path);
+    void update(const std::string& uuid, const std::string& name, const std::filesystem::path& path);
 
     TableModelPtr getModel() final;
 };
@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2019-2025 Reinder Feenstra
+ * Copyright (C) 2019-2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -22,14 +22,15 @@
 
 #include "worldloader.hpp"
 #include <fstream>
-#include <boost/algorithm/string.hpp>
 #include <boost/uuid/string_generator.hpp>
 #include <boost/uuid/uuid_io.hpp>
 #include "world.hpp"
 #include "../core/isvalidobjectid.hpp"
+#include "../utils/jsonscanner.hpp"
 #include "../utils/startswith.hpp"
 #include "../utils/stripsuffix.hpp"
 #include "ctwreader.hpp"
+#include "twbreader.hpp"
 #include "../log/logmessageexception.hpp"
 #include <version.hpp>
 
@@ -60,6 +61,8 @@ WorldLoader::WorldLoader(std::filesystem::path path)
 {
   if(path.extension() == World::dotCTW)
     m_ctw = std::make_unique<CTWReader>(path);
+  else if(path.extension() == World::dotTWB)
+    m_twb = std::make_unique<TWBReader>(path);
   else
     m_path = std::move(path);
 
@@ -69,30 +72,35 @@ WorldLoader::WorldLoader(std::filesystem::path path)
 WorldLoader::WorldLoader(const std::vector<std::byte>& memory)
   : WorldLoader()
 {
-  m_ctw = std::make_unique<CTWReader>(memory);
+  if(TWBReader::isSnapshot(memory))
+    m_twb = std::make_unique<TWBReader>(memory);
+  else
+    m_ctw = std::make_unique<CTWReader>(memory);
 
   load();
 }
 
-WorldLoader::~WorldLoader() = default; // default here, so we can use a forward declaration of CTWReader in the header.
+WorldLoader::~WorldLoader() = default; // default here, so we can use a forward declaration of CTWReader/TWBReader in the header.
 
 ObjectPtr WorldLoader::getObject(std::string_view id)
 {
-  std::vector<std::string> ids;
-  boost::split(ids, id, [](char c){ return c == '.'; });
-  auto itId = ids.cbegin();
+  // id is: object_id[.property[.property...]]
+  auto pos = id.find('.');
 
   ObjectPtr obj;
-  if(auto it = m_objects.find(*itId); it != m_objects.end())
+  if(auto it = m_objects.find(id.substr(0, pos)); it != m_objects.end())
   {
     if(!it->second.object)
       createObject(it->second);
     obj = it->second.object;
   }
 
-  while(obj && ++itId != ids.cend())
+  while(obj && pos != std::string_view::npos)
   {
-    AbstractProperty* property = obj->getProperty(*itId);
+    id.remove_prefix(pos + 1);
+    pos = id.find('.');
+
+    AbstractProperty* property = obj->getProperty(id.substr(0, pos));
     if(property && property->type() == ValueType::Object)
       obj = property->toObject();
     else
@@ -104,37 +112,14 @@ ObjectPtr WorldLoader::getObject(std::string_view id)
 
 json WorldLoader::getState(const std::string& id) const
 {
-  return m_states.value(id, json::object());
+  if(auto it = m_states.find(id); it != m_states.end())
+    return parse(it->second);
+  return json::object();
 }
 
 void WorldLoader::load()
 {
-  m_states = json::object();
-
-  json data;
-  json state;
-
-  // load file(s):
-  if(m_ctw)
-  {
-    if(!m_ctw->readFile(World::filename, data))
-      throw std::runtime_error(std::string("can't read ").append(World::filename));
-
-    if(!m_ctw->readFile(World::filenameState, state))
-      throw std::runtime_error(std::string("can't read ").append(World::filenameState));
-  }
-  else
-  {
-    std::ifstream file(m_path / World::filename);
-    if(!file.is_open())
-      throw std::runtime_error("can't open " + (m_path / World::filename).string());
-    data = json::parse(file);
-
-    std::ifstream stateFile(m_path / World::filenameState);
-    if(!stateFile.is_open())
-      throw std::runtime_error("can't open " + (m_path / World::filenameState).string());
-    state = json::parse(stateFile);
-  }
+  json data = m_twb ? indexSnapshot() : indexJSON();
 
   // check if UUID is valid:
   m_world->uuid.setValueInternal(to_string(boost::uuids::string_generator()(std::string(data["uuid"]))));
@@ -163,64 +148,35 @@ void WorldLoader::load()
     }
   }
 
-  // state data
-  if(state.is_object() && state["uuid"] == data["uuid"])
-  {
-    m_states = state["states"];
-    auto stateObjects = state.value("objects", json::array());
-    data["objects"].insert(data["objects"].end(), stateObjects.begin(), stateObjects.end());
-  }
-
-  // create a list of all objects
-  m_objects.insert({m_world->getObjectId(), {data, m_world, false}});
-  for(json object : data["objects"])
-  {
-    //! \todo Remove in v0.4
-    if(object["class_id"].get<std::string_view>() == "output") // don't create Output objects, no longer stored in file.
-    {
-      continue;
-    }
-
-    if(auto it = object.find("id"); it != object.end())
-    {
-      auto id = it.value().get<std::string>();
-      if(!isValidObjectId(id))
-        throw std::runtime_error("invalid object id value");
-      m_objects.insert({std::move(id), {object, nullptr, false}});
-    }
-    else
-      throw std::runtime_error("id missing");
-  }
+  m_objects.insert({World::classId, {{}, {}, std::move(data), m_world, false}});
 
   //! \todo Remove in v0.4
   {
     // patch for input refactor:
     for(auto& objectData : m_objects)
     {
-      if(!objectData.second.json.contains("class_id"))
-      {
-        continue;
-      }
-      auto classId = objectData.second.json["class_id"].get<std::string_view>();
+      const auto classId = objectData.second.classId;
       if(classId == "board_tile.rail.sensor" ||
           classId == "board_tile.rail.nx_button" ||
           classId == "input_map_item.block")
       {
-        const auto& input = objectData.second.json["input"];
+        json& objectJSON = parse(objectData.second);
+        const auto& input = objectJSON["input"];
         if(input.is_string())
         {
-          if(auto it = m_objects.find(input.get<std::string>()); it != m_objects.end()) [[likely]]
+          if(auto it = m_objects.find(input.get<std::string_view>()); it != m_objects.end()) [[likely]]
           {
-            objectData.second.json["interface"] = it->second.json["interface"];
-            objectData.second.json["channel"] = it->second.json["channel"];
-            objectData.second.json["address"] = it->second.json["address"];
+            json& inputJSON = parse(it->second);
+            objectJSON["interface"] = inputJSON["interface"];
+            objectJSON["channel"] = inputJSON["channel"];
+            objectJSON["address"] = inputJSON["address"];
           }
         }
-        objectData.second.json.erase("input");
+        objectJSON.erase("input");
       }
       else if(classId == "board_tile.rail.block")
       {
-        auto& inputMap = objectData.second.json["input_map"];
+        auto& inputMap = parse(objectData.second)["input_map"];
         if(inputMap.is_object())
         {
           auto& items = inputMap["items"];
@@ -231,17 +187,18 @@ void WorldLoader::load()
               const auto& input = item["input"];
               if(input.is_string())
               {
-                if(auto it = m_objects.find(input.get<std::string>()); it != m_objects.end()) [[likely]]
+                if(auto it = m_objects.find(input.get<std::string_view>()); it != m_objects.end()) [[likely]]
                 {
-                  item["interface"] = it->second.json["interface"];
-                  const int ch = it->second.json["channel"].get<int>();
+                  json& inputJSON = parse(it->second);
+                  item["interface"] = inputJSON["interface"];
+                  const int ch = inputJSON["channel"].get<int>();
                   if(ch == 0)
                   {
                     item["channel"] = "input";
                   }
-                  else if(auto interface = m_objects.find(item["interface"].get<std::string>()); it != m_objects.end()) [[likely]]
+                  else if(auto interface = m_objects.find(item["interface"].get<std::string_view>()); it != m_objects.end()) [[likely]]
                   {
-                    const auto interfaceClassId = interface->second.json["class_id"].get<std::string_view>();
+                    const auto interfaceClassId = interface->second.classId;
                     if(interfaceClassId == "interface.ecos")
                     {
                       if(ch == 1)
@@ -296,7 +253,7 @@ void WorldLoader::load()
                       assert(false);
                     }
                   }
-                  item["address"] = it->second.json["address"];
+                  item["address"] = inputJSON["address"];
                 }
               }
               item.erase("input");
@@ -308,7 +265,7 @@ void WorldLoader::load()
     // remove all input objects:
     for(auto it = m_objects.begin(); it != m_objects.end();)
     {
-      if(it->second.json.contains("class_id") && it->second.json["class_id"].get<std::string_view>() == "input")
+      if(it->second.classId == "input")
       {
         it = m_objects.erase(it);
       }
@@ -334,10 +291,179 @@ void WorldLoader::load()
     it.second.object->loaded();
 }
 
+json WorldLoader::indexJSON()
+{
+  std::string_view worldText;
+  std::string_view stateText;
+
+  // load file(s):
+  if(m_ctw)
+  {
+    if(!m_ctw->getFile(World::filename, worldText))
+      throw std::runtime_error(std::string("can't read ").append(World::filename));
+
+    if(!m_ctw->getFile(World::filenameState, stateText))
+      throw std::runtime_error(std::string("can't read ").append(World::filenameState));
+  }
+  else
+  {
+    if(!readFile(World::filename, m_worldText))
+      throw std::runtime_error("can't open " + (m_path / World::filename).string());
+    worldText = m_worldText;
+
+    if(!readFile(World::filenameState, m_stateText))
+      throw std::runtime_error("can't open " + (m_path / World::filenameState).string());
+    stateText = m_stateText;
+  }
+
+  // scan world file, only the world's own properties are parsed:
+  json data = json::object();
+  std::string_view objects;
+  {
+    JSONScanner scanner(worldText);
+    scanner.readObject(
+      [&scanner, &data, &objects](std::string_view key)
+      {
+        if(key == "objects")
+          objects = scanner.readValue();
+        else
+          data[std::string(key)] = json::parse(scanner.readValue());
+      });
+  }
+
+  // scan state file:
+  json stateUUID;
+  std::string_view stateObjects;
+  std::string_view states;
+  {
+    JSONScanner scanner(stateText);
+    scanner.readObject(
+      [&scanner, &stateUUID, &stateObjects, &states](std::string_view key)
+      {
+        if(key == "uuid")
+          stateUUID = json::parse(scanner.readValue());
+        else if(key == "objects")
+          stateObjects = scanner.readValue();
+        else if(key == "states")
+          states = scanner.readValue();
+        else
+          scanner.readValue();
+      });
+  }
+
+  // create a list of all objects
+  indexObjects(objects);
+
+  // state data
+  if(stateUUID == data["uuid"])
+  {
+    if(!states.empty() && states != "null")
+    {
+      JSONScanner scanner(states);
+      scanner.readObject(
+        [this, &scanner](std::string_view id)
+        {
+          m_states.emplace(id, scanner.readValue());
+        });
+    }
+    if(!stateObjects.empty())
+      indexObjects(stateObjects);
+  }
+
+  return data;
+}
+
+json WorldLoader::indexSnapshot()
+{
+  // the snapshot contains the index, world and state are always written together:
+  using Section = TWBReader::Section;
+
+  for(auto section : {Section::Objects, Section::StateObjects})
+  {
+    const uint32_t count = m_twb->count(section);
+    m_objects.reserve(m_objects.size() + count);
+    for(uint32_t i = 0; i < count; i++)
+    {
+      const auto entry = m_twb->entry(section, i);
+      const auto id = m_twb->string(entry.name);
+      if(!isValidObjectId(id))
+        throw std::runtime_error("invalid object id value");
+      m_objects.insert({id, {m_twb->blob(entry.data), m_twb->string(entry.classId), {}, nullptr, false}});
+    }
+  }
+
+  const uint32_t count = m_twb->count(Section::States);
+  m_states.reserve(count);
+  for(uint32_t i = 0; i < count; i++)
+  {
+    const auto entry = m_twb->entry(Section::States, i);
+    m_states.emplace(m_twb->string(entry.name), m_twb->blob(entry.data));
+  }
+
+  return parse(m_twb->world());
+}
+
+void WorldLoader::indexObjects(std::string_view objects)
+{
+  // only the id and class id are read, the object is parsed when it is created:
+  JSONScanner scanner(objects);
+  scanner.readArray(
+    [this, &scanner, objects]()
+    {
+      std::string_view id;
+      std::string_view classId;
+
+      // value starts after the separator, skip whitespace:
+      const size_t start = objects.find_first_not_of(" \t\r\n", scanner.position());
+      scanner.readObject(
+        [&scanner, &id, &classId](std::string_view key)
+        {
+          if(key == "id")
+            id = scanner.readString();
+          else if(key == "class_id")
+            classId = scanner.readString();
+          else
+            scanner.readValue();
+        });
+      const auto text = objects.substr(start, scanner.position() - start);
+
+      //! \todo Remove in v0.4
+      if(classId == "output") // don't create Output objects, no longer stored in file.
+      {
+        return;
+      }
+
+      if(id.empty())
+        throw std::runtime_error("id missing");
+      if(!isValidObjectId(id))
+        throw std::runtime_error("invalid object id value");
+      m_objects.insert({id, {text, classId, {}, nullptr, false}});
+    });
+}
+
+json WorldLoader::parse(std::string_view text) const
+{
+  if(m_twb)
+    return json::from_cbor(text.begin(), text.end());
+  return json::parse(text);
+}
+
+json& WorldLoader::parse(ObjectData& objectData) const
+{
+  if(!objectData.text.empty())
+  {
+    objectData.json = parse(objectData.text);
+    objectData.text = {};
+  }
+  return objectData.json;
+}
+
 void WorldLoader::createObject(ObjectData& objectData)
 {
   assert(!objectData.object);
 
+  parse(objectData);
+
   std::string_view classId = objectData.json["class_id"].get<std::string_view>();
   std::string_view id = objectData.json["id"].get<std::string_view>();
 
@@ -442,8 +568,9 @@ void WorldLoader::loadObject(ObjectData& objectData)
 {
   assert(objectData.object);
   assert(!objectData.loaded);
-  objectData.object->load(*this, objectData.json);
+  objectData.object->load(*this, parse(objectData));
   objectData.loaded = true;
+  objectData.json = json(); // no longer needed
 }
 
 bool WorldLoader::readFile(const std::filesystem::path& filename, std::string& data)
@@ -453,6 +580,11 @@ bool WorldLoader::readFile(const std::filesystem::path& filename, std::string& d
     if(!m_ctw->readFile(filename, data))
       return false;
   }
+  else if(m_twb)
+  {
+    if(!m_twb->readFile(filename, data))
+      return false;
+  }
   else
   {
     std::ifstream file(m_path / filename, std::ios::in | std::ios::binary | std::ios::ate);
@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2019-2022,2024 Reinder Feenstra
+ * Copyright (C) 2019-2022,2024,2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -34,12 +34,26 @@
 class Object;
 class World;
 class CTWReader;
+class TWBReader;
 
+/**
+ * \brief Loads a world from disk or memory
+ *
+ * The world and state files aren't parsed into a single JSON document,
+ * they are scanned for the objects they contain and an index from object id
+ * to the object's JSON text is built. An object is only parsed when it is
+ * created and its JSON is released once it is loaded.
+ *
+ * A binary snapshot (\ref TWB) has its index stored in the file, objects
+ * are CBOR encoded and decoded when created.
+ */
 class WorldLoader
 {
   private:
     struct ObjectData
     {
+      std::string_view text; //!< unparsed JSON or CBOR, empty once parsed
+      std::string_view classId;
       nlohmann::json json;
       std::shared_ptr<Object> object;
       bool loaded;
@@ -47,13 +61,21 @@ class WorldLoader
 
     std::filesystem::path m_path;
     std::unique_ptr<CTWReader> m_ctw;
+    std::unique_ptr<TWBReader> m_twb;
+    std::string m_worldText; //!< only used if loaded from directory
+    std::string m_stateText; //!< only used if loaded from directory
     std::shared_ptr<World> m_world;
-    std::unordered_map<std::string, ObjectData> m_objects;
-    nlohmann::json m_states;
+    std::unordered_map<std::string_view, ObjectData> m_objects; //!< keys point into the file text
+    std::unordered_map<std::string_view, std::string_view> m_states; //!< object id to unparsed JSON or CBOR
 
     WorldLoader();
     void load();
+    nlohmann::json indexJSON();
+    nlohmann::json indexSnapshot();
+    void indexObjects(std::string_view objects);
 
+    nlohmann::json parse(std::string_view text) const;
+    nlohmann::json& parse(ObjectData& objectData) const;
     void createObject(ObjectData& objectData);
     void loadObject(ObjectData& objectData);
 
@@ -3,7 +3,7 @@
  *
  * This file is part of the traintastic source code.
  *
- * Copyright (C) 2019-2025 Reinder Feenstra
+ * Copyright (C) 2019-2026 Reinder Feenstra
  *
  * This program is free software; you can redistribute it and/or
  * modify it under the terms of the GNU General Public License
@@ -22,6 +22,14 @@
 
 #include "worldsaver.hpp"
 #include <fstream>
+#include <system_error>
+#ifdef WIN32
+  #include <io.h>
+  #include <fcntl.h>
+#else
+  #include <fcntl.h>
+  #include <unistd.h>
+#endif
 #include <boost/uuid/uuid_io.hpp>
 #include <version.hpp>
 #include "world.hpp"
@@ -30,6 +38,7 @@
 #include "../status/simulationstatus.hpp"
 #include "../utils/sha1.hpp"
 #include "ctwwriter.hpp"
+#include "twbwriter.hpp"
 
 using nlohmann::json;
 
@@ -113,11 +122,44 @@ WorldSaver::WorldSaver(const World& world)
 
 WorldSaver::WorldSaver(const World& world, const std::filesystem::path& path)
   : WorldSaver(world)
+{
+  write(path);
+}
+
+WorldSaver::WorldSaver(const World& world, std::vector<std::byte>& memory)
+  : WorldSaver(world)
+{
+  CTWWriter ctw(memory);
+  writeCTW(ctw);
+}
+
+void WorldSaver::write(const std::filesystem::path& path)
 {
   if(path.extension() == World::dotCTW)
   {
-    CTWWriter ctw(path);
-    writeCTW(ctw);
+    {
+      CTWWriter ctw(path);
+      writeCTW(ctw);
+    } // archive is closed here
+    syncFile(path);
+  }
+  else if(path.extension() == World::dotTWB)
+  {
+    TWBWriter twb;
+    twb.writeWorld(m_data, m_state);
+    twb.setSource(m_snapshotSource);
+    for(const auto& file : m_writeFiles)
+      twb.writeFile(file.first, file.second);
+    const std::string data = twb.finish();
+    {
+      std::ofstream file(path, std::ios::out | std::ios::binary | std::ios::trunc);
+      if(!file.is_open())
+        throw std::runtime_error("file not open");
+      file.write(data.data(), static_cast<std::streamsize>(data.size()));
+      if(!file)
+        throw std::runtime_error("write failed");
+    }
+    syncFile(path);
   }
   else
   {
@@ -128,11 +170,70 @@ WorldSaver::WorldSaver(const World& world, const std::filesystem::path& path)
   }
 }
 
-WorldSaver::WorldSaver(const World& world, std::vector<std::byte>& memory)
-  : WorldSaver(world)
+WorldSaver::Result WorldSaver::save(const std::filesystem::path& savePath, const std::filesystem::path& backupPath, bool snapshot)
 {
-  CTWWriter ctw(memory);
-  writeCTW(ctw);
+  Result result;
+  try
+  {
+    const std::filesystem::path backupDir = std::filesystem::path(backupPath).remove_filename();
+    if(!std::filesystem::is_directory(backupDir))
+      std::filesystem::create_directories(backupDir, result.createBackupDirectory);
+
+    // keep the extension, it determines the format write() uses:
+    std::filesystem::path tmpPath = savePath;
+    tmpPath.replace_extension(".tmp").concat(savePath.extension().string());
+    std::filesystem::remove_all(tmpPath);
+    write(tmpPath);
+
+    // backup world:
+    std::filesystem::path worldPath = std::filesystem::path(savePath).replace_extension();
+    if(std::filesystem::is_directory(worldPath))
+      std::filesystem::rename(worldPath, backupPath, result.createBackup);
+
+    worldPath += World::dotCTW;
+    if(std::filesystem::is_regular_file(worldPath))
+    {
+      std::filesystem::path ctwBackupPath = backupPath;
+      ctwBackupPath += World::dotCTW;
+      std::filesystem::rename(worldPath, ctwBackupPath, result.createBackup);
+    }
+
+    std::filesystem::rename(tmpPath, savePath);
+    syncDirectory(std::filesystem::path(savePath).remove_filename()); // make the rename durable
+  }
+  catch(const std::exception& e)
+  {
+    result.error = e.what();
+    return result;
+  }
+
+  // binary snapshot, stamped with the saved world so a restored or edited world isn't shadowed by it:
+  const std::filesystem::path snapshotPath = std::filesystem::path(savePath).replace_extension(World::dotTWB);
+  if(snapshot)
+  {
+    try
+    {
+      m_snapshotSource = TWB::sourceStamp(savePath);
+      if(m_snapshotSource == 0)
+        throw std::runtime_error("can't stamp world");
+      std::filesystem::path tmpPath = snapshotPath;
+      tmpPath.replace_extension(".tmp").concat(World::dotTWB);
+      write(tmpPath);
+      std::filesystem::rename(tmpPath, snapshotPath);
+      syncDirectory(std::filesystem::path(snapshotPath).remove_filename());
+    }
+    catch(const std::exception& e)
+    {
+      result.snapshotError = e.what();
+    }
+  }
+  else
+  {
+    std::error_code ec;
+    std::filesystem::remove(snapshotPath, ec); // a stale snapshot would be loaded instead of the world
+  }
+
+  return result;
 }
 
 void WorldSaver::writeCTW(CTWWriter& ctw)
@@ -196,15 +297,18 @@ void WorldSaver::saveToDisk(const json& data, const std::filesystem::path& filen
   if(!std::filesystem::is_directory(dir))
     std::filesystem::create_directories(dir);
 
-  std::ofstream file(filename);
-  if(file.is_open())
   {
-    file << data.dump(2);
-    //Traintastic::instance->console->notice(classId, "Saved world " + name.value());
+    std::ofstream file(filename);
+    if(file.is_open())
+    {
+      file << data.dump(2);
+      //Traintastic::instance->console->notice(classId, "Saved world " + name.value());
+    }
+    else
+      throw std::runtime_error("file not open");
+      //Traintastic::instance->console->critical(classId, "Can't write to world file");
   }
-  else
-    throw std::runtime_error("file not open");
-    //Traintastic::instance->console->critical(classId, "Can't write to world file");
+  syncFile(filename);
 }
 
 void WorldSaver::saveToDisk(const std::string& data, const std::filesystem::path& filename)
@@ -219,13 +323,58 @@ void WorldSaver::saveToDisk(const std::string& data, const std::filesystem::path
   if(!std::filesystem::is_directory(dir))
     std::filesystem::create_directories(dir);
 
-  std::ofstream file(filename);
-  if(file.is_open())
   {
-    file << data;
-    //Traintastic::instance->console->notice(classId, "Saved world " + name.value());
+    std::ofstream file(filename);
+    if(file.is_open())
+    {
+      file << data;
+      //Traintastic::instance->console->notice(classId, "Saved world " + name.value());
+    }
+    else
+      throw std::runtime_error("file not open");
+      //Traintastic::instance->console->critical(classId, "Can't write to world file");
   }
-  else
-    throw std::runtime_error("file not open");
-    //Traintastic::instance->console->critical(classId, "Can't write to world file");
+  syncFile(filename);
+}
+
+void WorldSaver::syncFile(const std::filesystem::path& filename)
+{
+#ifdef WIN32
+  const int fd = _wopen(filename.c_str(), _O_RDWR | _O_BINARY);
+  if(fd < 0 || _commit(fd) != 0)
+  {
+    const int error = errno;
+    if(fd >= 0)
+      _close(fd);
+    throw std::system_error(error, std::generic_category(), "sync failed");
+  }
+  _close(fd);
+#else
+  const int fd = ::open(filename.c_str(), O_RDONLY);
+  if(fd < 0 || ::fsync(fd) != 0)
+  {
+    const int error = errno;
+    if(fd >= 0)
+      ::close(fd);
+    throw std::system_error(error, std::generic_category(), "sync failed");
+  }
+  ::close(fd);
+#endif
+}
+
+void WorldSaver::syncDirectory(const std::filesystem::path& path)
+{
+#ifdef WIN32
+  (void)path; // directory entries can't be flushed on Windows, NTFS journals them
+#else
+  const int fd = ::open(path.empty() ? "." : path.c_str(), O_RDONLY | O_DIRECTORY);
+  if(fd < 0 || ::fsync(fd) != 0)
+  {
+    const int error = errno;
+    if(fd >= 0)
+      ::close(fd);
+    throw std::system_error(error, std::generic_category(), "sync failed");
+  }
+  ::close(fd);
+#endif
 }
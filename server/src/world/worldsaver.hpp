@@ -24,6 +24,8 @@
 #define TRAINTASTIC_SERVER_WORLD_WORLDSAVER_HPP
 
 #include <list>
+#include <string>
+#include <system_error>
 #include "../core/objectptr.hpp"
 #include <traintastic/utils/stdfilesystem.hpp>
 #include "../utils/json.hpp"
@@ -40,8 +42,7 @@ class WorldSaver
     nlohmann::json m_state;
     std::list<std::filesystem::path> m_deleteFiles;
     std::list<std::pair<std::filesystem::path, std::string>> m_writeFiles;
-
-    WorldSaver(const World& world);
+    uint64_t m_snapshotSource = 0; //!< TWB::sourceStamp() of the saved world, set by save()
 
     void writeCTW(CTWWriter& ctw);
 
@@ -49,14 +50,44 @@ class WorldSaver
     void writeFiles(const std::filesystem::path& basePath);
     static void saveToDisk(const nlohmann::json& data, const std::filesystem::path& filename);
     static void saveToDisk(const std::string& data, const std::filesystem::path& filename);
+    static void syncFile(const std::filesystem::path& filename);
+    static void syncDirectory(const std::filesystem::path& path);
 
   public:
+    struct Result
+    {
+      std::error_code createBackupDirectory;
+      std::error_code createBackup;
+      std::string error; //!< empty if saved successfully
+      std::string snapshotError; //!< empty if binary snapshot is written successfully or not enabled
+    };
+
+    /**
+     * \brief Take a snapshot of the world
+     *
+     * Must be called from the event loop, the snapshot can be written by write() from any thread.
+     */
+    explicit WorldSaver(const World& world);
     WorldSaver(const World& world, const std::filesystem::path& path);
     WorldSaver(const World& world, std::vector<std::byte>& memory);
 
     nlohmann::json saveObject(const ObjectPtr& object);
     nlohmann::json saveStateObject(const std::shared_ptr<StateObject>& object);
 
+    //! Write the snapshot to disk and flush it to the storage device
+    void write(const std::filesystem::path& path);
+
+    /**
+     * \brief Write the snapshot next to the existing world, backup the existing world and then move the new one in place
+     *
+     * Doesn't touch the world itself, so it is safe to call from another thread.
+     *
+     * \param[in] savePath World directory or \c .ctw archive
+     * \param[in] backupPath Backup path of the existing world, without extension
+     * \param[in] snapshot \c true to write a binary snapshot too, \c false to remove it
+     */
+    Result save(const std::filesystem::path& savePath, const std::filesystem::path& backupPath, bool snapshot);
+
     void deleteFile(std::filesystem::path filename);
     void writeFile(std::filesystem::path filename, std::string data);
 };
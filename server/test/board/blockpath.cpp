@@ -0,0 +1,172 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "../../src/core/eventloop.hpp"
+#include "../../src/world/world.hpp"
+#include "../../src/core/method.tpp"
+#include "../../src/core/objectproperty.tpp"
+#include "../../src/board/board.hpp"
+#include "../../src/board/boardlist.hpp"
+#include "../../src/board/map/blockpath.hpp"
+#include "../../src/board/tile/rail/blockrailtile.hpp"
+#include "../../src/board/tile/rail/bridge90railtile.hpp"
+#include "../../src/board/tile/rail/straightrailtile.hpp"
+#include "../../src/board/tile/rail/turnout/turnoutleft45railtile.hpp"
+#include "../../src/board/tile/rail/turnout/turnoutright45railtile.hpp"
+
+namespace {
+
+std::shared_ptr<BlockPath> findPath(const BlockRailTile& from, const BlockRailTile& to)
+{
+  for(const auto& path : from.paths())
+    if(path->toBlock().get() == &to)
+      return path;
+  return {};
+}
+
+}
+
+TEST_CASE("Board: block paths are kept up to date", "[board][board-path]")
+{
+  EventLoop::reset();
+
+  auto world = World::create();
+
+  // Board:
+  // +--------+                     +--------+
+  // | block1 |--------\---/--------| block2 |
+  // +--------+         \ /         +--------+
+  //                     X <- bridge
+  // +--------+         / \         +--------+
+  // | block3 |--------/---\--------| block4 |
+  // +--------+                     +--------+
+  auto board = world->boards->create();
+
+  REQUIRE(board->addTile(0, 0, TileRotate::Deg90, BlockRailTile::classId, false));
+  REQUIRE(board->addTile(1, 0, TileRotate::Deg90, StraightRailTile::classId, false));
+  REQUIRE(board->addTile(2, 0, TileRotate::Deg90, TurnoutRight45RailTile::classId, false));
+  REQUIRE(board->addTile(3, 0, TileRotate::Deg90, StraightRailTile::classId, false));
+  REQUIRE(board->addTile(4, 0, TileRotate::Deg270, TurnoutLeft45RailTile::classId, false));
+  REQUIRE(board->addTile(5, 0, TileRotate::Deg90, StraightRailTile::classId, false));
+  REQUIRE(board->addTile(6, 0, TileRotate::Deg90, BlockRailTile::classId, false));
+
+  REQUIRE(board->addTile(3, 1, TileRotate::Deg45, Bridge90RailTile::classId, false));
+
+  REQUIRE(board->addTile(0, 2, TileRotate::Deg90, BlockRailTile::classId, false));
+  REQUIRE(board->addTile(1, 2, TileRotate::Deg90, StraightRailTile::classId, false));
+  REQUIRE(board->addTile(2, 2, TileRotate::Deg90, TurnoutLeft45RailTile::classId, false));
+  REQUIRE(board->addTile(3, 2, TileRotate::Deg90, StraightRailTile::classId, false));
+  REQUIRE(board->addTile(4, 2, TileRotate::Deg270, TurnoutRight45RailTile::classId, false));
+  REQUIRE(board->addTile(5, 2, TileRotate::Deg90, StraightRailTile::classId, false));
+  REQUIRE(board->addTile(6, 2, TileRotate::Deg90, BlockRailTile::classId, false));
+
+  auto block1 = std::dynamic_pointer_cast<BlockRailTile>(board->getTile({0, 0}));
+  REQUIRE(block1);
+  auto block2 = std::dynamic_pointer_cast<BlockRailTile>(board->getTile({6, 0}));
+  REQUIRE(block2);
+  auto block3 = std::dynamic_pointer_cast<BlockRailTile>(board->getTile({0, 2}));
+  REQUIRE(block3);
+  auto block4 = std::dynamic_pointer_cast<BlockRailTile>(board->getTile({6, 2}));
+  REQUIRE(block4);
+
+  world->run(); // this will build the board network and block paths
+
+  REQUIRE(block1->paths().size() == 2);
+  auto path12 = findPath(*block1, *block2);
+  REQUIRE(path12);
+  auto path14 = findPath(*block1, *block4);
+  REQUIRE(path14);
+  REQUIRE_FALSE(findPath(*block1, *block3));
+  REQUIRE(block1->getPath(path12->fromSide(), *block2, path12->toSide()) == path12);
+  REQUIRE(block1->getPath(path14->fromSide(), *block4, path14->toSide()) == path14);
+  REQUIRE_FALSE(block1->getPath(path12->fromSide(), *block2, path12->toSide() == BlockSide::A ? BlockSide::B : BlockSide::A));
+
+  REQUIRE(block3->paths().size() == 2);
+  REQUIRE(findPath(*block3, *block2));
+  REQUIRE(findPath(*block3, *block4));
+
+  world->stop();
+
+  // remove the bridge, only the diagonal paths are gone:
+  REQUIRE(board->deleteTile(3, 1));
+
+  world->run();
+
+  REQUIRE(block1->paths().size() == 1);
+  REQUIRE(findPath(*block1, *block2) == path12); // unchanged paths are kept
+  REQUIRE_FALSE(findPath(*block1, *block4));
+  REQUIRE_FALSE(block1->getPath(path14->fromSide(), *block4, path14->toSide()));
+  REQUIRE(block3->paths().size() == 1);
+  REQUIRE(findPath(*block3, *block4));
+}
+
+TEST_CASE("Board: find block paths benchmark", "[.][benchmark][board-path]")
+{
+  static constexpr int16_t sectionCount = 8; // 2^8 paths per block side
+
+  EventLoop::reset();
+
+  auto world = World::create();
+  auto board = world->boards->create();
+
+  // Board, sections of two tracks with a bridge between them:
+  // +--------+                             +--------+
+  // | block1 |----\---/-------\---/- ... --| block2 |
+  // +--------+     \ /         \ /         +--------+
+  //                 X           X
+  // +--------+     / \         / \         +--------+
+  // | block3 |----/---\-------/---\- ... --| block4 |
+  // +--------+                             +--------+
+  REQUIRE(board->addTile(0, 0, TileRotate::Deg90, BlockRailTile::classId, false));
+  REQUIRE(board->addTile(0, 2, TileRotate::Deg90, BlockRailTile::classId, false));
+  for(int16_t i = 0; i < sectionCount; i++)
+  {
+    const int16_t x = 1 + i * 4;
+    REQUIRE(board->addTile(x, 0, TileRotate::Deg90, StraightRailTile::classId, false));
+    REQUIRE(board->addTile(x + 1, 0, TileRotate::Deg90, TurnoutRight45RailTile::classId, false));
+    REQUIRE(board->addTile(x + 2, 0, TileRotate::Deg90, StraightRailTile::classId, false));
+    REQUIRE(board->addTile(x + 3, 0, TileRotate::Deg270, TurnoutLeft45RailTile::classId, false));
+    REQUIRE(board->addTile(x + 2, 1, TileRotate::Deg45, Bridge90RailTile::classId, false));
+    REQUIRE(board->addTile(x, 2, TileRotate::Deg90, StraightRailTile::classId, false));
+    REQUIRE(board->addTile(x + 1, 2, TileRotate::Deg90, TurnoutLeft45RailTile::classId, false));
+    REQUIRE(board->addTile(x + 2, 2, TileRotate::Deg90, StraightRailTile::classId, false));
+    REQUIRE(board->addTile(x + 3, 2, TileRotate::Deg270, TurnoutRight45RailTile::classId, false));
+  }
+  const int16_t x = 1 + sectionCount * 4;
+  REQUIRE(board->addTile(x, 0, TileRotate::Deg90, StraightRailTile::classId, false));
+  REQUIRE(board->addTile(x + 1, 0, TileRotate::Deg90, BlockRailTile::classId, false));
+  REQUIRE(board->addTile(x, 2, TileRotate::Deg90, StraightRailTile::classId, false));
+  REQUIRE(board->addTile(x + 1, 2, TileRotate::Deg90, BlockRailTile::classId, false));
+
+  auto block = std::dynamic_pointer_cast<BlockRailTile>(board->getTile({0, 0}));
+  REQUIRE(block);
+
+  world->run(); // build the board network
+
+  REQUIRE(block->paths().size() == (1 << sectionCount));
+
+  BENCHMARK("Find block paths")
+  {
+    return BlockPath::find(*block).size();
+  };
+}
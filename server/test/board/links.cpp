@@ -0,0 +1,160 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <random>
+#include <algorithm>
+#include "../../src/core/eventloop.hpp"
+#include "../../src/world/world.hpp"
+#include "../../src/core/method.tpp"
+#include "../../src/core/objectproperty.tpp"
+#include "../../src/board/board.hpp"
+#include "../../src/board/boardlist.hpp"
+#include "../../src/board/map/link.hpp"
+#include "../../src/board/map/node.hpp"
+#include "../../src/board/tile/hidden/hiddencrossoverrailtile.hpp"
+#include "../../src/board/tile/rail/blockrailtile.hpp"
+#include "../../src/board/tile/rail/bufferstoprailtile.hpp"
+#include "../../src/board/tile/rail/cross45railtile.hpp"
+#include "../../src/board/tile/rail/curve45railtile.hpp"
+#include "../../src/board/tile/rail/curve90railtile.hpp"
+#include "../../src/board/tile/rail/straightrailtile.hpp"
+#include "../../src/board/tile/rail/turnout/turnoutleft45railtile.hpp"
+#include "../../src/board/tile/rail/turnout/turnoutright45railtile.hpp"
+
+namespace {
+
+struct LinkInfo
+{
+  TileLocation location;
+  TileId tileId;
+  size_t index;
+  TileLocation nextLocation;
+  TileId nextTileId;
+  std::vector<TileLocation> tiles;
+
+  auto key() const
+  {
+    return std::tie(location.x, location.y, index);
+  }
+
+  bool operator ==(const LinkInfo& other) const
+  {
+    return location == other.location && tileId == other.tileId && index == other.index &&
+      nextLocation == other.nextLocation && nextTileId == other.nextTileId && tiles == other.tiles;
+  }
+};
+
+std::vector<LinkInfo> getLinks(Board& board)
+{
+  std::vector<LinkInfo> links;
+
+  const auto addLinks =
+    [&links](Tile& tile)
+    {
+      auto& node = tile.node()->get();
+      for(size_t i = 0; i < node.links().size(); i++)
+      {
+        const auto& link = node.links()[i];
+        if(!link)
+          continue;
+        const auto& next = link->getNext(node);
+        auto& info = links.emplace_back(LinkInfo{tile.location(), tile.tileId, i, next.tile().location(), next.tile().tileId, {}});
+        for(const auto& linkTile : link->tiles())
+          info.tiles.emplace_back(linkTile->location());
+      }
+    };
+
+  for(const auto& [location, tile] : board.tileMap())
+    if(tile->node() && location == tile->location())
+      addLinks(*tile);
+
+  for(const auto& [location, crossOver] : board.railCrossOver())
+    addLinks(*crossOver);
+
+  std::sort(links.begin(), links.end(), [](const LinkInfo& a, const LinkInfo& b) { return a.key() < b.key(); });
+  return links;
+}
+
+}
+
+TEST_CASE("Board: incremental link update equals full rebuild", "[board]")
+{
+  static constexpr int16_t boardSize = 8;
+  static constexpr size_t batchCount = 50;
+  static constexpr size_t editsPerBatch = 4;
+  static constexpr std::string_view classIds[] = {
+    StraightRailTile::classId,
+    StraightRailTile::classId,
+    Curve45RailTile::classId,
+    Curve90RailTile::classId,
+    TurnoutLeft45RailTile::classId,
+    TurnoutRight45RailTile::classId,
+    BlockRailTile::classId,
+    BufferStopRailTile::classId,
+    Cross45RailTile::classId,
+  };
+
+  EventLoop::reset();
+
+  auto world = World::create();
+  auto board = world->boards->create();
+
+  std::mt19937 random(20260101); // fixed seed, failures must be reproducible
+  const auto randomCoordinate = [&random]() { return static_cast<int16_t>(random() % boardSize); };
+  const auto randomRotate = [&random]() { return static_cast<TileRotate>(random() % 8); };
+
+  for(size_t batch = 0; batch < batchCount; batch++)
+  {
+    for(size_t edit = 0; edit < editsPerBatch; edit++)
+    {
+      const int16_t x = randomCoordinate();
+      const int16_t y = randomCoordinate();
+
+      switch(random() % 4)
+      {
+        case 0:
+        case 1:
+          board->addTile(x, y, randomRotate(), classIds[random() % std::size(classIds)], true);
+          break;
+
+        case 2:
+          board->deleteTile(x, y);
+          break;
+
+        case 3:
+          board->moveTile(x, y, randomCoordinate(), randomCoordinate(), randomRotate(), true);
+          break;
+      }
+    }
+
+    world->run(); // updates the links around the edited tiles
+    const auto incremental = getLinks(*board);
+    world->stop();
+
+    board->rebuildLinks();
+    const auto full = getLinks(*board);
+
+    INFO("batch " << batch);
+    REQUIRE(incremental.size() == full.size());
+    REQUIRE(incremental == full);
+  }
+}
@@ -0,0 +1,207 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "../../src/core/eventloop.hpp"
+#include "../../src/world/world.hpp"
+#include "../../src/core/method.tpp"
+#include "../../src/core/objectproperty.tpp"
+#include "../../src/board/board.hpp"
+#include "../../src/board/boardlist.hpp"
+#include "../../src/board/pathfinder/trainpathfinder.hpp"
+#include "../../src/board/pathfinder/trainroute.hpp"
+#include "../../src/board/tile/rail/blockrailtile.hpp"
+#include "../../src/board/tile/rail/bridge90railtile.hpp"
+#include "../../src/board/tile/rail/linkrailtile.hpp"
+#include "../../src/board/tile/rail/straightrailtile.hpp"
+#include "../../src/board/tile/rail/turnout/turnoutleft45railtile.hpp"
+#include "../../src/board/tile/rail/turnout/turnoutright45railtile.hpp"
+#include "../../src/hardware/decoder/decoder.hpp"
+#include "../../src/vehicle/rail/railvehiclelist.hpp"
+#include "../../src/vehicle/rail/locomotive.hpp"
+#include "../../src/train/trainlist.hpp"
+#include "../../src/train/train.hpp"
+#include "../../src/train/trainvehiclelist.hpp"
+#include "../../src/zone/zone.hpp"
+#include "../../src/zone/zonelist.hpp"
+#include "../../src/zone/blockzonelist.hpp"
+
+namespace {
+
+/**
+ * Adds sections of two tracks with a bridge between them:
+ * +----+           +----+           +----+
+ * | b0 |---\---/---| b1 |---\---/---| b2 | ...
+ * +----+    \ /    +----+    \ /    +----+
+ *            X                X
+ * +----+    / \    +----+    / \    +----+
+ * | b0 |---/---\---| b1 |---/---\---| b2 | ...
+ * +----+           +----+           +----+
+ * \return The blocks of both tracks
+ */
+std::array<std::vector<std::shared_ptr<BlockRailTile>>, 2> addSections(Board& board, int16_t x, int16_t y, int16_t sectionCount)
+{
+  std::array<std::vector<std::shared_ptr<BlockRailTile>>, 2> blocks;
+
+  for(int16_t i = 0; i < sectionCount; i++, x += 4)
+  {
+    REQUIRE(board.addTile(x, y, TileRotate::Deg90, BlockRailTile::classId, false));
+    REQUIRE(board.addTile(x + 1, y, TileRotate::Deg90, TurnoutRight45RailTile::classId, false));
+    REQUIRE(board.addTile(x + 2, y, TileRotate::Deg90, StraightRailTile::classId, false));
+    REQUIRE(board.addTile(x + 3, y, TileRotate::Deg270, TurnoutLeft45RailTile::classId, false));
+    REQUIRE(board.addTile(x + 2, y + 1, TileRotate::Deg45, Bridge90RailTile::classId, false));
+    REQUIRE(board.addTile(x, y + 2, TileRotate::Deg90, BlockRailTile::classId, false));
+    REQUIRE(board.addTile(x + 1, y + 2, TileRotate::Deg90, TurnoutLeft45RailTile::classId, false));
+    REQUIRE(board.addTile(x + 2, y + 2, TileRotate::Deg90, StraightRailTile::classId, false));
+    REQUIRE(board.addTile(x + 3, y + 2, TileRotate::Deg270, TurnoutRight45RailTile::classId, false));
+  }
+  REQUIRE(board.addTile(x, y, TileRotate::Deg90, BlockRailTile::classId, false));
+  REQUIRE(board.addTile(x, y + 2, TileRotate::Deg90, BlockRailTile::classId, false));
+
+  for(size_t track = 0; track < blocks.size(); track++)
+  {
+    for(int16_t i = 0; i <= sectionCount; i++)
+    {
+      auto block = std::dynamic_pointer_cast<BlockRailTile>(board.getTile({static_cast<int16_t>(x - (sectionCount - i) * 4), static_cast<int16_t>(y + track * 2)}));
+      REQUIRE(block);
+      blocks[track].emplace_back(std::move(block));
+    }
+  }
+
+  return blocks;
+}
+
+}
+
+TEST_CASE("TrainPathFinder: find route", "[board][board-path]")
+{
+  EventLoop::reset();
+
+  auto world = World::create();
+  auto board = world->boards->create();
+  const auto blocks = addSections(*board, 0, 0, 2);
+  const auto& track1 = blocks[0];
+  const auto& track2 = blocks[1];
+
+  world->run(); // this will build the board network
+
+  for(const auto& track : blocks)
+    for(const auto& block : track)
+      REQUIRE(block->setStateFree());
+
+  // both routes are equal, make the one over track 2 longer:
+  track2[1]->length.setValueInternal(100.0, LengthUnit::Meter);
+
+  auto route = TrainPathFinder::find(*track1[0], BlockTrainDirection::TowardsB, *track1[2]);
+  REQUIRE(route);
+  REQUIRE(route->paths().size() == 2);
+  REQUIRE(route->blocks.size() == 3);
+  REQUIRE(route->blocks[0] == track1[0]);
+  REQUIRE(route->blocks[1] == track1[1]);
+  REQUIRE(route->blocks[2] == track1[2]);
+
+  // wrong direction:
+  REQUIRE_FALSE(TrainPathFinder::find(*track1[0], BlockTrainDirection::TowardsA, *track1[2]));
+
+  // zone speed limit makes the short route slower:
+  auto zone = world->zones->create();
+  zone->speedLimit.setValueInternal(0.5, SpeedUnit::KiloMeterPerHour);
+  track1[1]->zones->add(zone);
+
+  route = TrainPathFinder::find(*track1[0], BlockTrainDirection::TowardsB, *track1[2]);
+  REQUIRE(route);
+  REQUIRE(route->blocks.size() == 3);
+  REQUIRE(route->blocks[1] == track2[1]);
+
+  // occupied blocks are avoided:
+  auto locomotive = world->railVehicles->create(Locomotive::classId);
+  auto train = world->trains->create();
+  train->vehicles->add(locomotive);
+  track2[1]->assignTrain(train);
+  REQUIRE(track2[1]->state == BlockState::Reserved);
+
+  route = TrainPathFinder::find(*track1[0], BlockTrainDirection::TowardsB, *track1[2]);
+  REQUIRE(route);
+  REQUIRE(route->blocks[1] == track1[1]);
+
+  // script callable method:
+  route = world->trainPathFinder->findRoute(track1[0], BlockTrainDirection::TowardsB, track2[2]);
+  REQUIRE(route);
+  REQUIRE(route->blocks.size() == 3);
+  REQUIRE(route->blocks[2] == track2[2]);
+  REQUIRE_FALSE(world->trainPathFinder->findRoute(track1[0], BlockTrainDirection::TowardsB, track1[0]));
+}
+
+TEST_CASE("TrainPathFinder: find route benchmark", "[.][benchmark][board-path]")
+{
+  static constexpr int16_t sectionCount = 200;
+  static constexpr int16_t rowCount = 5; // 5 rows of 2 x 201 blocks
+  static constexpr size_t trainCount = 40;
+
+  EventLoop::reset();
+
+  auto world = World::create();
+  auto board = world->boards->create();
+
+  // rows are connected using link tiles, end of row N to start of row N + 1:
+  std::vector<std::array<std::vector<std::shared_ptr<BlockRailTile>>, 2>> rows;
+  for(int16_t row = 0; row < rowCount; row++)
+  {
+    const int16_t y = row * 4;
+    rows.emplace_back(addSections(*board, 1, y, sectionCount));
+    for(int16_t track = 0; track < 2; track++)
+    {
+      REQUIRE(board->addTile(0, y + track * 2, TileRotate::Deg90, LinkRailTile::classId, false));
+      REQUIRE(board->addTile(2 + sectionCount * 4, y + track * 2, TileRotate::Deg270, LinkRailTile::classId, false));
+      if(row > 0)
+      {
+        auto start = std::dynamic_pointer_cast<LinkRailTile>(board->getTile({0, static_cast<int16_t>(y + track * 2)}));
+        auto end = std::dynamic_pointer_cast<LinkRailTile>(board->getTile({2 + sectionCount * 4, static_cast<int16_t>(y - 4 + track * 2)}));
+        REQUIRE(start);
+        REQUIRE(end);
+        end->link = start;
+      }
+    }
+  }
+
+  world->run(); // build the board network
+
+  for(const auto& row : rows)
+    for(const auto& track : row)
+      for(const auto& block : track)
+        REQUIRE(block->setStateFree());
+
+  const auto& destination = rows.back()[1].back();
+  REQUIRE(TrainPathFinder::find(*rows.front()[0].front(), BlockTrainDirection::TowardsB, *destination));
+
+  BENCHMARK("Find route for 40 trains")
+  {
+    size_t found = 0;
+    for(size_t i = 0; i < trainCount; i++)
+    {
+      const auto& from = rows[i % rowCount][i % 2][(i * 7) % sectionCount];
+      if(TrainPathFinder::find(*from, BlockTrainDirection::TowardsB, *destination))
+        found++;
+    }
+    return found;
+  };
+}
@@ -0,0 +1,111 @@
+/**
+ * server/test/core/filelogger.cpp
+ *
+ * This file is part of the traintastic test suite.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../../src/log/filelogger.hpp"
+
+namespace {
+
+std::vector<std::string> readLines(const std::filesystem::path& path)
+{
+  std::vector<std::string> lines;
+  std::ifstream file(path);
+  for(std::string line; std::getline(file, line);)
+    lines.emplace_back(std::move(line));
+  return lines;
+}
+
+//! \brief Logged message with object id \a objectId
+bool isMessage(const std::string& line, std::string_view objectId)
+{
+  return line.find(std::string(";").append(objectId).append(";N1001;")) != std::string::npos;
+}
+
+}
+
+TEST_CASE("FileLogger: full queue drops messages", "[filelogger]")
+{
+  const auto dir = std::filesystem::temp_directory_path() / "traintastic-test-filelogger";
+  const auto path = dir / "drop.log";
+  std::filesystem::remove_all(dir);
+  const auto time = std::chrono::system_clock::now();
+
+  {
+    FileLogger logger(path, std::chrono::hours(1), 4);
+    logger.pauseWriter(true);
+
+    for(int i = 0; i < 6; i++)
+      logger.log(time, std::string("m").append(std::to_string(i)), LogMessage::N1001_RECEIVED_SIGNAL_X, {"x"});
+
+    auto statistics = logger.statistics();
+    REQUIRE(statistics.written == 0);
+    REQUIRE(statistics.dropped == 2); // m4 and m5
+    REQUIRE(statistics.backpressure == 3); // m1..m3 queued at or above high water
+
+    // queued messages are written after resume:
+    logger.pauseWriter(false);
+    for(int i = 0; i < 5000 && logger.statistics().written != 4; i++)
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    REQUIRE(logger.statistics().written == 4);
+
+    logger.log(time, "m6", LogMessage::N1001_RECEIVED_SIGNAL_X);
+  } // flushed on destruction
+
+  const auto lines = readLines(path);
+  REQUIRE(lines.size() == 8);
+  REQUIRE(lines[0].starts_with("=== Traintastic v"));
+  for(size_t i = 0; i < 4; i++)
+    REQUIRE(isMessage(lines[1 + i], std::string("m").append(std::to_string(i))));
+  REQUIRE(lines[5] == "=== Dropped 2 log messages, queue full");
+  REQUIRE(isMessage(lines[6], "m6"));
+  REQUIRE(lines[7] == "=== Log statistics: written 5, dropped 2, backpressure 3");
+
+  std::filesystem::remove_all(dir);
+}
+
+TEST_CASE("FileLogger: queued messages are written on destruction", "[filelogger]")
+{
+  const auto dir = std::filesystem::temp_directory_path() / "traintastic-test-filelogger";
+  const auto path = dir / "shutdown.log";
+  std::filesystem::remove_all(dir);
+  const auto time = std::chrono::system_clock::now();
+
+  {
+    FileLogger logger(path, std::chrono::hours(1), 64);
+    logger.pauseWriter(true);
+    for(int i = 0; i < 16; i++)
+      logger.log(time, std::string("m").append(std::to_string(i)), LogMessage::N1001_RECEIVED_SIGNAL_X);
+    REQUIRE(logger.statistics().written == 0);
+    REQUIRE(logger.statistics().dropped == 0);
+  } // writer is still paused, stop must still drain and flush
+
+  const auto lines = readLines(path);
+  REQUIRE(lines.size() == 1 + 16); // no statistics line, nothing dropped or above high water
+  for(size_t i = 0; i < 16; i++)
+    REQUIRE(isMessage(lines[1 + i], std::string("m").append(std::to_string(i))));
+
+  std::filesystem::remove_all(dir);
+}
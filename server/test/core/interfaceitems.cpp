@@ -0,0 +1,70 @@
+/**
+ * server/test/core/interfaceitems.cpp
+ *
+ * This file is part of the traintastic test suite.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include "../../src/core/eventloop.hpp"
+#include "../../src/core/method.tpp"
+#include "../../src/core/objectproperty.tpp"
+#include "../../src/core/abstractunitproperty.hpp"
+#include "../../src/world/world.hpp"
+#include "../../src/train/train.hpp"
+#include "../../src/train/trainlist.hpp"
+
+TEST_CASE("InterfaceItems: lookup", "[interfaceitems]")
+{
+  EventLoop::reset();
+
+  auto world = World::create();
+  auto train1 = world->trains->create();
+  auto train2 = world->trains->create();
+
+  const auto& items1 = train1->interfaceItems();
+  const auto& items2 = train2->interfaceItems();
+  REQUIRE(items1.size() == items2.size());
+
+  // same class, same slots:
+  const auto slot = items1.slot("name");
+  REQUIRE(slot != InterfaceItems::noSlot);
+  REQUIRE(items2.slot("name") == slot);
+  REQUIRE(&items1[slot] == &train1->name);
+  REQUIRE(&items2[slot] == &train2->name);
+  REQUIRE(items1.slot("does_not_exist") == InterfaceItems::noSlot);
+  REQUIRE(items1.find("does_not_exist") == nullptr);
+
+  // cached slot:
+  uint16_t cachedSlot = InterfaceItems::noSlot;
+  REQUIRE(items1.find("speed", cachedSlot) == &train1->speed);
+  REQUIRE(cachedSlot == items1.slot("speed"));
+  REQUIRE(items2.find("speed", cachedSlot) == &train2->speed);
+  REQUIRE(items1.find("name", cachedSlot) == &train1->name); // stale cache
+  REQUIRE(cachedSlot == slot);
+
+  // kind, without RTTI:
+  REQUIRE(train1->getProperty("name") == &train1->name);
+  REQUIRE(train1->getMethod("name") == nullptr);
+  REQUIRE(train1->getObjectProperty("name") == nullptr);
+  REQUIRE(train1->getObjectProperty("vehicles") == &train1->vehicles);
+  REQUIRE(interfaceItemCast<AbstractUnitProperty>(train1->getItem("speed")) == &train1->speed);
+  REQUIRE(interfaceItemCast<AbstractUnitProperty>(train1->getItem("name")) == nullptr);
+  REQUIRE(interfaceItemCast<AbstractProperty>(train1->getItem("speed")) == &train1->speed);
+  REQUIRE(interfaceItemCast<BaseProperty>(train1->getItem("speed")) == &train1->speed);
+}
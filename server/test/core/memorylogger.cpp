@@ -0,0 +1,95 @@
+/**
+ * server/test/core/memorylogger.cpp
+ *
+ * This file is part of the traintastic test suite.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <thread>
+#include "../../src/core/eventloop.hpp"
+#include "../../src/log/memorylogger.hpp"
+
+TEST_CASE("MemoryLogger: ring buffer", "[memorylogger]")
+{
+  EventLoop::reset();
+  EventLoop::threadId = std::this_thread::get_id();
+
+  MemoryLogger logger(3);
+  uint32_t changed = 0;
+  logger.changed.connect([&changed](const MemoryLogger&) { changed++; });
+
+  const auto time = std::chrono::system_clock::now();
+  REQUIRE(logger.size() == 0);
+  REQUIRE(logger.firstSequence() == 0);
+  REQUIRE(logger.nextSequence() == 0);
+
+  logger.log(time, "world", LogMessage::N1001_RECEIVED_SIGNAL_X, {"a"});
+  logger.log(time, "train_1", LogMessage::N1001_RECEIVED_SIGNAL_X, {"b"});
+  logger.log(time, "world", LogMessage::N1001_RECEIVED_SIGNAL_X);
+  REQUIRE(changed == 3);
+  REQUIRE(logger.size() == 3);
+  REQUIRE(logger.firstSequence() == 0);
+  REQUIRE(logger.nextSequence() == 3);
+  REQUIRE(logger[0].objectId == logger[2].objectId); // interned
+  REQUIRE(logger.objectId(logger[1]) == "train_1");
+
+  // full, oldest is overwritten:
+  const std::string longArg(100, 'x');
+  logger.log(time, "train_2", LogMessage::N1001_RECEIVED_SIGNAL_X, {"c", longArg});
+  REQUIRE(logger.size() == 3);
+  REQUIRE(logger.firstSequence() == 1);
+  REQUIRE(logger.nextSequence() == 4);
+  REQUIRE(logger.objectId(logger[1]) == "train_1");
+  REQUIRE(logger[1].args.size() == 1);
+  REQUIRE(logger[1].args[0] == "b");
+  REQUIRE(logger[2].args.size() == 0);
+  REQUIRE(logger.objectId(logger[3]) == "train_2");
+  REQUIRE(logger[3].args.size() == 2);
+  REQUIRE(logger[3].args[0] == "c");
+  REQUIRE(logger[3].args[1] == longArg); // doesn't fit inline
+
+  // slot with heap args reused for inline args:
+  for(int i = 0; i < 3; i++)
+    logger.log(time, "world", LogMessage::N1001_RECEIVED_SIGNAL_X, {std::to_string(i)});
+  REQUIRE(logger.firstSequence() == 4);
+  REQUIRE(logger.nextSequence() == 7);
+  for(uint64_t sequence = 4; sequence < 7; sequence++)
+  {
+    REQUIRE(logger.objectId(logger[sequence]) == "world");
+    REQUIRE(logger[sequence].args[0] == std::to_string(sequence - 4));
+  }
+}
+
+TEST_CASE("MemoryLogger: unused object ids are dropped", "[memorylogger]")
+{
+  EventLoop::reset();
+  EventLoop::threadId = std::this_thread::get_id();
+
+  MemoryLogger logger(10);
+  const auto time = std::chrono::system_clock::now();
+  for(int i = 0; i < 10'000; i++)
+    logger.log(time, "object_" + std::to_string(i), LogMessage::N1001_RECEIVED_SIGNAL_X);
+
+  REQUIRE(logger.size() == 10);
+  for(uint64_t sequence = logger.firstSequence(); sequence < logger.nextSequence(); sequence++)
+  {
+    REQUIRE(logger.objectId(logger[sequence]) == "object_" + std::to_string(sequence));
+    REQUIRE(logger[sequence].objectId < 2048);
+  }
+}
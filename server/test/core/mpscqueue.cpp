@@ -0,0 +1,97 @@
+/**
+ * server/test/core/mpscqueue.cpp
+ *
+ * This file is part of the traintastic test suite.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <thread>
+#include <vector>
+#include "../../src/utils/mpscqueue.hpp"
+
+TEST_CASE("MPSCQueue: full and empty", "[mpscqueue]")
+{
+  MPSCQueue<int> queue(4);
+  REQUIRE(queue.capacity() == 4);
+  REQUIRE(queue.size() == 0);
+
+  int value = 0;
+  REQUIRE_FALSE(queue.tryPop(value));
+
+  for(int i = 1; i <= 4; i++)
+    REQUIRE(queue.tryPush(int{i}));
+  REQUIRE(queue.size() == 4);
+  REQUIRE_FALSE(queue.tryPush(5));
+
+  REQUIRE(queue.tryPop(value));
+  REQUIRE(value == 1);
+  REQUIRE(queue.tryPush(5)); // wraps around
+
+  for(int i = 2; i <= 5; i++)
+  {
+    REQUIRE(queue.tryPop(value));
+    REQUIRE(value == i);
+  }
+  REQUIRE_FALSE(queue.tryPop(value));
+  REQUIRE(queue.size() == 0);
+}
+
+TEST_CASE("MPSCQueue: multiple producers", "[mpscqueue]")
+{
+  constexpr size_t producerCount = 4;
+  constexpr uint32_t itemsPerProducer = 100'000;
+
+  MPSCQueue<uint32_t> queue(1024);
+
+  std::vector<std::thread> producers;
+  for(uint32_t producer = 0; producer < producerCount; producer++)
+  {
+    producers.emplace_back(
+      [&queue, producer]()
+      {
+        for(uint32_t i = 0; i < itemsPerProducer; i++)
+          while(!queue.tryPush((producer << 24) | i))
+            std::this_thread::yield();
+      });
+  }
+
+  // every item must arrive exactly once and in order per producer:
+  std::array<uint32_t, producerCount> next{};
+  size_t received = 0;
+  uint32_t value;
+  while(received < producerCount * itemsPerProducer)
+  {
+    if(queue.tryPop(value))
+    {
+      const uint32_t producer = value >> 24;
+      REQUIRE(producer < producerCount);
+      REQUIRE((value & 0xFFFFFF) == next[producer]);
+      next[producer]++;
+      received++;
+    }
+    else
+      std::this_thread::yield();
+  }
+
+  for(auto& producer : producers)
+    producer.join();
+
+  REQUIRE_FALSE(queue.tryPop(value));
+}
@@ -0,0 +1,166 @@
+/**
+ * server/test/core/objectlist.cpp
+ *
+ * This file is part of the traintastic test suite.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include "../../src/core/eventloop.hpp"
+#include "../../src/core/method.tpp"
+#include "../../src/core/objectproperty.tpp"
+#include "../../src/core/tablemodel.hpp"
+#include "../../src/world/world.hpp"
+#include "../../src/zone/zone.hpp"
+#include "../../src/zone/zonelist.hpp"
+
+TEST_CASE("ObjectList: table model row updates", "[objectlist]")
+{
+  EventLoop::reset();
+
+  auto world = World::create();
+  auto model = world->zones->getModel();
+  REQUIRE(model);
+
+  std::vector<uint32_t> removedRows;
+  std::vector<TableModel::Region> updatedRegions;
+  model->rowRemoved =
+    [&removedRows](const TableModelPtr&, uint32_t row)
+    {
+      removedRows.emplace_back(row);
+    };
+  model->updateRegion =
+    [&updatedRegions](const TableModelPtr&, const TableModel::Region& region)
+    {
+      updatedRegions.emplace_back(region);
+    };
+
+  std::weak_ptr<Zone> zone1 = world->zones->create();
+  std::weak_ptr<Zone> zone2 = world->zones->create();
+  std::weak_ptr<Zone> zone3 = world->zones->create();
+  REQUIRE(model->rowCount() == 3);
+
+  // property change only updates the changed cell:
+  zone3.lock()->name = "Zone Three";
+  REQUIRE(updatedRegions.size() == 1);
+  REQUIRE(updatedRegions.back() == TableModel::Region(1, 1, 2, 2));
+
+  // remove middle row:
+  world->zones->delete_(zone2.lock());
+  REQUIRE(zone2.expired());
+  REQUIRE(model->rowCount() == 2);
+  REQUIRE(removedRows == std::vector<uint32_t>{1});
+  REQUIRE(updatedRegions.size() == 1); // no refresh of the rows below
+
+  // rows below the removed row are reindexed:
+  zone3.lock()->name = "Zone 3";
+  REQUIRE(updatedRegions.size() == 2);
+  REQUIRE(updatedRegions.back() == TableModel::Region(1, 1, 1, 1));
+  REQUIRE(model->getText(1, 1) == "Zone 3");
+
+  zone1.lock()->name = "Zone 1";
+  REQUIRE(updatedRegions.size() == 3);
+  REQUIRE(updatedRegions.back() == TableModel::Region(1, 1, 0, 0));
+
+  // remove first row:
+  world->zones->delete_(zone1.lock());
+  REQUIRE(model->rowCount() == 1);
+  REQUIRE(removedRows == std::vector<uint32_t>{1, 0});
+  REQUIRE(model->getText(1, 0) == "Zone 3");
+}
+
+TEST_CASE("ObjectList: table model row removed in region", "[objectlist]")
+{
+  EventLoop::reset();
+
+  auto world = World::create();
+  auto model = world->zones->getModel();
+  REQUIRE(model);
+
+  std::vector<std::weak_ptr<Zone>> zones;
+  for(int i = 0; i < 4; i++)
+    zones.emplace_back(world->zones->create());
+  REQUIRE(model->rowCount() == 4);
+
+  std::vector<TableModel::Region> updatedRegions;
+  model->rowRemoved = [](const TableModelPtr&, uint32_t) {};
+  model->updateRegion =
+    [&updatedRegions](const TableModelPtr&, const TableModel::Region& region)
+    {
+      updatedRegions.emplace_back(region);
+    };
+
+  model->setRegion(TableModel::Region(0, 1, 0, 2)); // client shows first three rows
+  updatedRegions.clear();
+
+  // row 3 moves into the region:
+  world->zones->delete_(zones[0].lock());
+  REQUIRE(updatedRegions.size() == 1);
+  REQUIRE(updatedRegions.back() == TableModel::Region(0, 1, 2, 2));
+
+  // no row left to move into the region:
+  world->zones->delete_(zones[1].lock());
+  REQUIRE(updatedRegions.size() == 1);
+}
+
+TEST_CASE("ObjectList: table model row removed without row removed support", "[objectlist]")
+{
+  EventLoop::reset();
+
+  auto world = World::create();
+  auto model = world->zones->getModel();
+  REQUIRE(model);
+
+  std::vector<std::weak_ptr<Zone>> zones;
+  for(int i = 0; i < 4; i++)
+    zones.emplace_back(world->zones->create());
+  REQUIRE(model->rowCount() == 4);
+
+  std::vector<uint32_t> rowCounts;
+  std::vector<TableModel::Region> updatedRegions;
+  model->rowCountChanged =
+    [&rowCounts](const TableModelPtr& tableModel)
+    {
+      rowCounts.emplace_back(tableModel->rowCount());
+    };
+  model->updateRegion =
+    [&updatedRegions](const TableModelPtr&, const TableModel::Region& region)
+    {
+      updatedRegions.emplace_back(region);
+    };
+
+  model->setRegion(TableModel::Region(0, 1, 0, 2)); // client shows first three rows
+  updatedRegions.clear();
+
+  // all rows in the region moved up:
+  world->zones->delete_(zones[0].lock());
+  REQUIRE(rowCounts == std::vector<uint32_t>{3});
+  REQUIRE(updatedRegions.size() == 1);
+  REQUIRE(updatedRegions.back() == TableModel::Region(0, 1, 0, 2));
+
+  // only rows below the removed row, limited to the remaining rows:
+  world->zones->delete_(zones[2].lock());
+  REQUIRE(rowCounts == std::vector<uint32_t>{3, 2});
+  REQUIRE(updatedRegions.size() == 2);
+  REQUIRE(updatedRegions.back() == TableModel::Region(0, 1, 1, 1));
+
+  // last row, nothing moved up:
+  world->zones->delete_(zones[3].lock());
+  REQUIRE(rowCounts == std::vector<uint32_t>{3, 2, 1});
+  REQUIRE(updatedRegions.size() == 2);
+}
@@ -0,0 +1,182 @@
+/**
+ * server/test/core/signal.cpp
+ *
+ * This file is part of the traintastic test suite.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "../../src/core/signal.hpp"
+#include "../../src/core/eventloop.hpp"
+#include "../../src/core/objectproperty.tpp"
+#include "../../src/core/method.tpp"
+#include "../../src/world/world.hpp"
+#include "../../src/train/trainlist.hpp"
+#include "../../src/train/train.hpp"
+
+TEST_CASE("Signal: connect, emit and disconnect", "[signal]")
+{
+  Signal<void(int)> signal;
+  int sum = 0;
+
+  REQUIRE(signal.empty());
+  SignalConnection connection = signal.connect([&sum](int value) { sum += value; });
+  REQUIRE(connection.connected());
+  REQUIRE_FALSE(signal.empty());
+
+  signal(1);
+  signal(2);
+  REQUIRE(sum == 3);
+
+  connection.disconnect();
+  REQUIRE_FALSE(connection.connected());
+  REQUIRE(signal.empty());
+
+  signal(4);
+  REQUIRE(sum == 3);
+}
+
+TEST_CASE("Signal: scoped connection", "[signal]")
+{
+  Signal<void()> signal;
+  int count = 0;
+
+  {
+    ScopedSignalConnection connection = signal.connect([&count]() { count++; });
+    signal();
+    REQUIRE(count == 1);
+  }
+
+  signal();
+  REQUIRE(count == 1);
+  REQUIRE(signal.empty());
+}
+
+TEST_CASE("Signal: disconnect during emit", "[signal]")
+{
+  Signal<void()> signal;
+  int count1 = 0;
+  int count2 = 0;
+  SignalConnection connection1;
+  SignalConnection connection2;
+
+  connection1 = signal.connect(
+    [&]()
+    {
+      count1++;
+      connection1.disconnect(); // disconnect self
+      connection2.disconnect(); // disconnect other, not yet called
+    });
+  connection2 = signal.connect([&]() { count2++; });
+
+  signal();
+  REQUIRE(count1 == 1);
+  REQUIRE(count2 == 0);
+  REQUIRE(signal.empty());
+
+  signal();
+  REQUIRE(count1 == 1);
+  REQUIRE(count2 == 0);
+}
+
+TEST_CASE("Signal: connect during emit", "[signal]")
+{
+  Signal<void()> signal;
+  int count = 0;
+  std::vector<SignalConnection> connections;
+
+  connections.emplace_back(signal.connect(
+    [&]()
+    {
+      for(int i = 0; i < 100; i++) // force reallocation of the slot list
+        connections.emplace_back(signal.connect([&count]() { count++; }));
+    }));
+
+  signal();
+  REQUIRE(count == 0); // slots connected during emit are not called
+
+  connections.front().disconnect();
+  signal();
+  REQUIRE(count == 100);
+}
+
+TEST_CASE("Signal: connection outlives signal", "[signal]")
+{
+  SignalConnection connection;
+  {
+    Signal<void()> signal;
+    connection = signal.connect([]() {});
+    REQUIRE(connection.connected());
+  }
+  REQUIRE_FALSE(connection.connected());
+  connection.disconnect(); // must be safe
+}
+
+TEST_CASE("Signal: owner destroyed during emit", "[signal]")
+{
+  struct Owner
+  {
+    Signal<void(int)> changed;
+  };
+
+  auto owner = std::make_unique<Owner>();
+  int count1 = 0;
+  int count2 = 0;
+  SignalConnection connection1 = owner->changed.connect(
+    [&, counter=std::make_shared<int>(0)](int value)
+    {
+      owner.reset(); // destroy owner and signal
+      (*counter)++; // captures of the running slot must still be alive
+      count1 += value * *counter;
+    });
+  SignalConnection connection2 = owner->changed.connect([&count2](int) { count2++; });
+
+  owner->changed(1);
+  REQUIRE_FALSE(owner);
+  REQUIRE(count1 == 1);
+  REQUIRE(count2 == 0); // not called after signal is destroyed
+  REQUIRE_FALSE(connection1.connected());
+  REQUIRE_FALSE(connection2.connected());
+  connection1.disconnect(); // must be safe
+}
+
+TEST_CASE("Signal: property changed benchmark", "[.][benchmark][signal]")
+{
+  static constexpr size_t trainCount = 5000;
+
+  EventLoop::reset();
+
+  auto world = World::create();
+  std::vector<std::shared_ptr<Train>> trains;
+  std::vector<ScopedSignalConnection> connections;
+  size_t changes = 0;
+
+  for(size_t i = 0; i < trainCount; i++)
+  {
+    auto& train = trains.emplace_back(world->trains->create());
+    connections.emplace_back(train->propertyChanged.connect([&changes](BaseProperty&) { changes++; }));
+  }
+
+  BENCHMARK("Change property of all trains")
+  {
+    for(auto& train : trains)
+      train->notes.setValueInternal(train->notes.value().empty() ? "x" : "");
+    return changes;
+  };
+}
@@ -0,0 +1,133 @@
+/**
+ * server/test/hardware/decodercontroller.cpp
+ *
+ * This file is part of the traintastic test suite.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "../src/core/eventloop.hpp"
+#include "../src/world/world.hpp"
+#include "../src/core/method.tpp"
+#include "../src/core/objectproperty.tpp"
+#include "../src/hardware/interface/interfacelist.hpp"
+#include "../src/hardware/interface/loconetinterface.hpp"
+#include "../src/hardware/interface/marklincaninterface.hpp"
+#include "../src/hardware/decoder/decoder.hpp"
+#include "../src/hardware/decoder/list/decoderlist.hpp"
+#include "../src/hardware/input/list/inputlist.hpp"
+#include "../src/hardware/output/list/outputlist.hpp"
+
+TEST_CASE("DecoderController: lookup follows protocol and address changes", "[decodercontroller]")
+{
+  EventLoop::reset();
+
+  auto world = World::create();
+  auto interface = std::dynamic_pointer_cast<MarklinCANInterface>(world->interfaces->create(MarklinCANInterface::classId));
+  REQUIRE(interface);
+
+  auto decoder1 = Decoder::create(*world);
+  decoder1->interface = interface;
+  decoder1->protocol = DecoderProtocol::DCCShort;
+  decoder1->address = 3;
+  REQUIRE(interface->decoders->length == 1);
+  REQUIRE(interface->getDecoder(DecoderProtocol::DCCShort, 3) == decoder1);
+  REQUIRE_FALSE(interface->getDecoder(DecoderProtocol::DCCLong, 3));
+
+  decoder1->address = 5;
+  REQUIRE_FALSE(interface->getDecoder(DecoderProtocol::DCCShort, 3));
+  REQUIRE(interface->getDecoder(DecoderProtocol::DCCShort, 5) == decoder1);
+
+  decoder1->protocol = DecoderProtocol::DCCLong;
+  REQUIRE_FALSE(interface->getDecoder(DecoderProtocol::DCCShort, 5));
+  REQUIRE(interface->getDecoder(DecoderProtocol::DCCLong, 5) == decoder1);
+
+  // same address, first added decoder is used:
+  auto decoder2 = Decoder::create(*world);
+  decoder2->interface = interface;
+  decoder2->protocol = DecoderProtocol::DCCLong;
+  decoder2->address = 5;
+  REQUIRE(interface->decoders->length == 2);
+  REQUIRE(interface->getDecoder(DecoderProtocol::DCCLong, 5) == decoder1);
+
+  decoder1->interface = nullptr;
+  REQUIRE(interface->decoders->length == 1);
+  REQUIRE(interface->getDecoder(DecoderProtocol::DCCLong, 5) == decoder2);
+
+  decoder1->interface = interface;
+  REQUIRE(interface->getDecoder(DecoderProtocol::DCCLong, 5) == decoder2);
+
+  // MFX decoders are found by UID only:
+  decoder1->protocol = DecoderProtocol::MFX;
+  decoder1->mfxUID = 0x12345678;
+  REQUIRE(interface->getDecoderMFX(0x12345678) == decoder1);
+  REQUIRE_FALSE(interface->getDecoder(DecoderProtocol::MFX, 0));
+  REQUIRE_FALSE(interface->getDecoderMFX(0));
+
+  decoder1->mfxUID = 0x87654321;
+  REQUIRE_FALSE(interface->getDecoderMFX(0x12345678));
+  REQUIRE(interface->getDecoderMFX(0x87654321) == decoder1);
+
+  decoder1->protocol = DecoderProtocol::Motorola;
+  REQUIRE_FALSE(interface->getDecoderMFX(0x87654321));
+
+  decoder2->destroy();
+  REQUIRE(interface->decoders->length == 1);
+  REQUIRE_FALSE(interface->getDecoder(DecoderProtocol::DCCLong, 5));
+}
+
+TEST_CASE("DecoderController: lookup benchmark", "[.][benchmark][decodercontroller]")
+{
+  static constexpr uint16_t decoderCount = 10000;
+  static constexpr size_t lookupCount = 100000;
+
+  EventLoop::reset();
+
+  auto world = World::create();
+  auto interface = std::dynamic_pointer_cast<LocoNetInterface>(world->interfaces->create(LocoNetInterface::classId));
+  REQUIRE(interface);
+
+  for(uint16_t address = 1; address <= decoderCount; address++)
+  {
+    auto decoder = Decoder::create(*world);
+    decoder->interface = interface;
+    decoder->protocol = DecoderProtocol::DCCLong;
+    decoder->address = address;
+  }
+  REQUIRE(interface->decoders->length == decoderCount);
+
+  // loco info for pseudo random addresses, like slot read data on a busy LocoNet:
+  std::vector<uint16_t> addresses;
+  addresses.reserve(lookupCount);
+  uint32_t seed = 1;
+  for(size_t i = 0; i < lookupCount; i++)
+  {
+    seed = seed * 1103515245 + 12345;
+    addresses.emplace_back(1 + (seed >> 16) % decoderCount);
+  }
+
+  BENCHMARK("Find decoder by address")
+  {
+    size_t found = 0;
+    for(auto address : addresses)
+      if(interface->getDecoder(DecoderProtocol::DCCLong, address))
+        found++;
+    return found;
+  };
+}
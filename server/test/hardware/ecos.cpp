@@ -0,0 +1,313 @@
+/**
+ * server/test/hardware/ecos.cpp
+ *
+ * This file is part of the traintastic test suite.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "../src/hardware/protocol/ecos/messages.hpp"
+
+using namespace std::string_view_literals;
+
+//! \brief Session as send by an ECoS with many objects, as captured after connecting
+static std::vector<std::string> createSession(size_t switchCount, size_t locomotiveCount, size_t s88Count, size_t feedbackEventCount)
+{
+  std::vector<std::string> session;
+
+  std::string message = "<REPLY queryObjects(10, addr, protocol)>\r\n";
+  for(size_t i = 0; i < locomotiveCount; i++)
+    message.append(std::to_string(1000 + i)).append(" addr[").append(std::to_string(1 + i)).append("] protocol[DCC28]\r\n");
+  message.append("<END 0 (OK)>\r\n");
+  session.emplace_back(std::move(message));
+
+  message = "<REPLY queryObjects(11, type)>\r\n";
+  for(size_t i = 0; i < switchCount; i++)
+    message.append(std::to_string(20000 + i)).append(" type[ACCESSORY]\r\n");
+  message.append("<END 0 (OK)>\r\n");
+  session.emplace_back(std::move(message));
+
+  message = "<REPLY queryObjects(26, ports)>\r\n";
+  for(size_t i = 0; i < s88Count; i++)
+    message.append(std::to_string(100 + i)).append(" ports[16]\r\n");
+  message.append("<END 0 (OK)>\r\n");
+  session.emplace_back(std::move(message));
+
+  for(size_t i = 0; i < switchCount; i++)
+  {
+    const auto id = std::to_string(20000 + i);
+    session.emplace_back(
+      std::string("<REPLY get(").append(id).append(", name1, name2, name3, type, symbol, addr, addrext, protocol, state, mode, duration, variant)>\r\n")
+        .append(id).append(" name1[\"Switch ").append(std::to_string(i)).append("\"]\r\n")
+        .append(id).append(" name2[\"\"]\r\n")
+        .append(id).append(" name3[\"[A, B]\"]\r\n")
+        .append(id).append(" type[ACCESSORY]\r\n")
+        .append(id).append(" symbol[0]\r\n")
+        .append(id).append(" addr[").append(std::to_string(1 + i)).append("]\r\n")
+        .append(id).append(" addrext[").append(std::to_string(1 + i)).append("r,").append(std::to_string(1 + i)).append("g]\r\n")
+        .append(id).append(" protocol[DCC]\r\n")
+        .append(id).append(" state[0]\r\n")
+        .append(id).append(" mode[SWITCH]\r\n")
+        .append(id).append(" duration[250]\r\n")
+        .append(id).append(" variant[0]\r\n")
+        .append("<END 0 (OK)>\r\n"));
+  }
+
+  for(size_t i = 0; i < locomotiveCount; i++)
+  {
+    const auto id = std::to_string(1000 + i);
+    session.emplace_back(
+      std::string("<REPLY get(").append(id).append(", dir, speedstep)>\r\n")
+        .append(id).append(" dir[0]\r\n")
+        .append(id).append(" speedstep[0]\r\n")
+        .append("<END 0 (OK)>\r\n"));
+  }
+
+  for(size_t i = 0; i < feedbackEventCount; i++)
+  {
+    const auto id = std::to_string(100 + i % s88Count);
+    session.emplace_back(
+      std::string("<EVENT ").append(id).append(">\r\n")
+        .append(id).append(" state[0x").append(std::to_string(i % 10)).append("]\r\n")
+        .append("<END 0 (OK)>\r\n"));
+  }
+
+  return session;
+}
+
+//! \brief Parse a message and walk all tokens, like the kernel and objects do
+template<class Visitor>
+static bool parseMessage(std::string_view message, Visitor&& visitor)
+{
+  auto visitLines = [&visitor](const ECoS::LineList& lines)
+  {
+    for(auto text : lines)
+    {
+      visitor(text);
+      ECoS::Line line;
+      if(ECoS::parseLine(text, line))
+      {
+        for(const auto& [option, value] : line.values)
+        {
+          visitor(option);
+          visitor(value);
+        }
+      }
+    }
+  };
+
+  if(ECoS::Reply reply; ECoS::parseReply(message, reply))
+  {
+    visitor(reply.command);
+    for(auto option : reply.options)
+      visitor(option);
+    visitLines(reply.lines);
+    visitor(reply.statusMessage);
+    return true;
+  }
+  if(ECoS::Event event; ECoS::parseEvent(message, event))
+  {
+    visitLines(event.lines);
+    visitor(event.statusMessage);
+    return true;
+  }
+  return false;
+}
+
+TEST_CASE("ECoS: parse reply", "[ecos]")
+{
+  const auto message = "<REPLY get(20000, name1, addrext, func[3])>\r\n20000 name1[\"a [b], c\"] addrext[5r,5g]\r\n20000 state[1]\r\n<END 0 (OK)>\r\n"sv;
+
+  ECoS::Reply reply;
+  REQUIRE(ECoS::parseReply(message, reply));
+  REQUIRE(reply.command == ECoS::Command::get);
+  REQUIRE(reply.objectId == 20000);
+  REQUIRE(reply.options.size() == 3);
+  REQUIRE(reply.options[0] == "name1");
+  REQUIRE(reply.options[1] == "addrext");
+  REQUIRE(reply.options[2] == "func[3]");
+  REQUIRE(reply.lines.size() == 2);
+  REQUIRE(reply.status == ECoS::Status::Ok);
+  REQUIRE(reply.statusMessage == "OK");
+
+  ECoS::Line line;
+  REQUIRE(ECoS::parseLine(reply.lines.front(), line));
+  REQUIRE(line.objectId == 20000);
+  std::string_view name;
+  REQUIRE(line.values.get(ECoS::Option::name1, name));
+  REQUIRE(name == "a [b], c");
+  std::string_view addrext;
+  REQUIRE(line.values.get(ECoS::Option::addrext, addrext));
+  REQUIRE(addrext == "5r,5g");
+  uint16_t state;
+  REQUIRE_FALSE(line.values.get(ECoS::Option::state, state));
+
+  REQUIRE(ECoS::parseLine(*std::next(reply.lines.begin()), line));
+  REQUIRE(line.values.get(ECoS::Option::state, state));
+  REQUIRE(state == 1);
+}
+
+TEST_CASE("ECoS: parse event", "[ecos]")
+{
+  const auto message = "<EVENT 11>\r\n11 msg[LIST_CHANGED]\r\n20001 appended\r\n<END 0 (OK)>\r\n"sv;
+
+  ECoS::Event event;
+  REQUIRE(ECoS::parseEvent(message, event));
+  REQUIRE(event.objectId == 11);
+  REQUIRE(event.lines.size() == 2);
+  REQUIRE(event.status == ECoS::Status::Ok);
+
+  ECoS::Line line;
+  REQUIRE(ECoS::parseLine(event.lines.front(), line));
+  std::string_view msg;
+  REQUIRE(line.values.get("msg", msg));
+  REQUIRE(msg == "LIST_CHANGED");
+
+  REQUIRE(ECoS::parseLine(*std::next(event.lines.begin()), line));
+  REQUIRE(line.objectId == 20001);
+  REQUIRE(line.values.empty());
+
+  REQUIRE_FALSE(ECoS::parseEvent("<EVENT 11>\r\n11 msg[LIST_CHANGED]\r\n"sv, event)); // no end
+
+  ECoS::Reply reply;
+  REQUIRE_FALSE(ECoS::parseReply(message, reply));
+}
+
+TEST_CASE("ECoS: format commands", "[ecos]")
+{
+  ECoS::Formatter formatter;
+  REQUIRE(formatter.get(1, {ECoS::Option::go, ECoS::Option::stop}) == "get(1, go, stop)\n");
+  REQUIRE(formatter.set(1000, ECoS::Option::speedStep, uint8_t{12}) == "set(1000, speedstep[12])\n");
+  REQUIRE(formatter.set(1000, ECoS::Option::func, uint8_t{3}, 1) == "set(1000, func[3,1])\n");
+  REQUIRE(formatter.set(11, ECoS::Option::switch_, "DCC12g"sv) == "set(11, switch[DCC12g])\n");
+  REQUIRE(formatter.queryObjects(26, {ECoS::Option::ports}) == "queryObjects(26, ports)\n");
+  REQUIRE(formatter.queryObjects(26) == "queryObjects(26)\n");
+
+  ECoS::Request request;
+  REQUIRE(ECoS::parseRequest(formatter.set(1000, ECoS::Option::func, uint8_t{3}, 1), request));
+  REQUIRE(request.command == ECoS::Command::set);
+  REQUIRE(request.objectId == 1000);
+  REQUIRE(request.options.size() == 1);
+  REQUIRE(request.options[0] == "func[3,1]");
+}
+
+TEST_CASE("ECoS: parser fuzz", "[ecos][fuzz]")
+{
+  static constexpr size_t iterations = 20'000;
+  static constexpr std::string_view specialChars = "<>()[],\" \r\n0123456789";
+
+  const auto session = createSession(20, 10, 4, 20);
+  std::mt19937 random(12345); // fixed seed, reproducible
+  size_t parsed = 0;
+
+  for(size_t i = 0; i < iterations; i++)
+  {
+    std::string text = session[random() % session.size()];
+
+    const size_t mutations = 1 + random() % 4;
+    for(size_t j = 0; j < mutations && !text.empty(); j++)
+    {
+      const size_t pos = random() % text.size();
+      switch(random() % 4)
+      {
+        case 0: // replace
+          text[pos] = specialChars[random() % specialChars.size()];
+          break;
+        case 1: // insert
+          text.insert(pos, 1, specialChars[random() % specialChars.size()]);
+          break;
+        case 2: // erase
+          text.erase(pos, 1 + random() % 8);
+          break;
+        case 3: // truncate
+          text.resize(pos);
+          break;
+      }
+    }
+
+    // copy into an exactly sized buffer, so out of bound reads are detected by sanitizers:
+    const auto buffer = std::make_unique<char[]>(text.size());
+    std::copy(text.begin(), text.end(), buffer.get());
+    const std::string_view message{buffer.get(), text.size()};
+
+    if(parseMessage(message,
+        [&message](std::string_view token)
+        {
+          if(!token.empty())
+          {
+            REQUIRE(token.data() >= message.data());
+            REQUIRE(token.data() + token.size() <= message.data() + message.size());
+          }
+        }))
+    {
+      parsed++;
+    }
+
+    ECoS::Request request;
+    if(ECoS::parseRequest(message, request))
+    {
+      for(auto option : request.options)
+      {
+        REQUIRE_FALSE(option.empty());
+        REQUIRE(option.data() + option.size() <= message.data() + message.size());
+      }
+    }
+  }
+
+  REQUIRE(parsed > 0); // not all mutations break a message
+}
+
+TEST_CASE("ECoS: session parse benchmark", "[.][benchmark][ecos]")
+{
+  const auto session = createSession(600, 200, 32, 5000);
+
+  size_t bytes = 0;
+  for(const auto& message : session)
+    bytes += message.size();
+
+  BENCHMARK("Parse " + std::to_string(session.size()) + " messages, " + std::to_string(bytes) + " bytes")
+  {
+    size_t tokens = 0;
+    for(const auto& message : session)
+    {
+      parseMessage(message,
+        [&tokens](std::string_view /*token*/)
+        {
+          tokens++;
+        });
+    }
+    return tokens;
+  };
+
+  ECoS::Formatter formatter;
+
+  BENCHMARK("Format 10000 commands")
+  {
+    size_t size = 0;
+    for(uint16_t i = 0; i < 10'000; i++)
+    {
+      size += formatter.set(static_cast<uint16_t>(1000 + i % 200), ECoS::Option::func, static_cast<uint8_t>(i % 29), i % 2).size();
+    }
+    return size;
+  };
+}
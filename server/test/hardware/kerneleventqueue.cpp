@@ -0,0 +1,159 @@
+/**
+ * server/test/hardware/kerneleventqueue.cpp
+ *
+ * This file is part of the traintastic test suite.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "../src/core/eventloop.hpp"
+#include "../src/core/method.tpp"
+#include "../src/core/objectproperty.tpp"
+#include "../src/world/world.hpp"
+#include "../src/hardware/input/input.hpp"
+#include "../src/hardware/interface/interfacelist.hpp"
+#include "../src/hardware/interface/loconetinterface.hpp"
+#include "../src/hardware/protocol/kerneleventqueue.hpp"
+
+TEST_CASE("KernelEventQueue: batch and dedupe", "[hardware][kerneleventqueue]")
+{
+  EventLoop::reset();
+  EventLoop::threadId = std::this_thread::get_id();
+
+  auto world = World::create();
+  auto interface = std::dynamic_pointer_cast<LocoNetInterface>(world->interfaces->create(LocoNetInterface::classId));
+  REQUIRE(interface);
+
+  auto input1 = interface->getInput(InputChannel::Input, 1, *world);
+  auto input2 = interface->getInput(InputChannel::Input, 2, *world);
+  REQUIRE(input1);
+  REQUIRE(input2);
+
+  std::vector<bool> input1Changes;
+  size_t input2Changes = 0;
+  input1->onValueChanged.connect(
+    [&input1Changes](bool value, const std::shared_ptr<Input>& /*input*/)
+    {
+      input1Changes.push_back(value);
+    });
+  input2->onValueChanged.connect(
+    [&input2Changes](bool /*value*/, const std::shared_ptr<Input>& /*input*/)
+    {
+      input2Changes++;
+    });
+
+  KernelEventQueue queue;
+
+  std::vector<uint32_t> reportedBatchSizes;
+  queue.setOnStatistics(
+    [&reportedBatchSizes](const KernelEventQueue::Statistics& statistics)
+    {
+      reportedBatchSizes.push_back(statistics.lastBatchSize);
+    });
+
+  std::thread producer(
+    [&queue, &interface]()
+    {
+      queue.pushInput(*interface, InputChannel::Input, 1, TriState::True);
+      queue.pushInput(*interface, InputChannel::Input, 1, TriState::True); // duplicate
+      queue.pushInput(*interface, InputChannel::Input, 1, TriState::False);
+      queue.pushInput(*interface, InputChannel::Input, 1, TriState::True);
+      queue.pushInput(*interface, InputChannel::Input, 2, TriState::True);
+      queue.pushInput(*interface, InputChannel::Input, 2, TriState::True); // duplicate
+      queue.pushInput(*interface, InputChannel::Input, 2, TriState::True); // duplicate
+      queue.pushOutput(*interface, OutputChannel::Accessory, 1, OutputPairValue::Second);
+      queue.pushOutput(*interface, OutputChannel::Accessory, 1, OutputPairValue::Second); // duplicate
+    });
+  producer.join();
+
+  EventLoop::ioContext().run();
+
+  REQUIRE((input1Changes == std::vector<bool>{true, false, true}));
+  REQUIRE(input2Changes == 1);
+  REQUIRE(input1->value.value() == TriState::True);
+  REQUIRE(input2->value.value() == TriState::True);
+
+  const auto& statistics = queue.statistics();
+  REQUIRE(statistics.batches == 1);
+  REQUIRE(statistics.lastBatchSize == 9);
+  REQUIRE(statistics.maxBatchSize == 9);
+  REQUIRE(statistics.events == 5);
+  REQUIRE(statistics.duplicates == 4);
+  REQUIRE((reportedBatchSizes == std::vector<uint32_t>{9}));
+
+  // next batch starts without history:
+  queue.pushInput(*interface, InputChannel::Input, 2, TriState::True);
+  EventLoop::ioContext().restart();
+  EventLoop::ioContext().run();
+
+  REQUIRE(input2Changes == 2);
+  REQUIRE(statistics.batches == 2);
+  REQUIRE(statistics.lastBatchSize == 1);
+  REQUIRE(statistics.maxBatchSize == 9);
+  REQUIRE((reportedBatchSizes == std::vector<uint32_t>{9, 1}));
+}
+
+TEST_CASE("KernelEventQueue: feedback burst benchmark", "[.][benchmark][kerneleventqueue]")
+{
+  static constexpr uint32_t inputCount = 4096;
+  static constexpr size_t eventCount = 100'000;
+
+  EventLoop::reset();
+  EventLoop::threadId = std::this_thread::get_id();
+
+  auto world = World::create();
+  auto interface = std::dynamic_pointer_cast<LocoNetInterface>(world->interfaces->create(LocoNetInterface::classId));
+  REQUIRE(interface);
+
+  BENCHMARK("EventLoop::call per event")
+  {
+    EventLoop::reset();
+    std::thread producer(
+      [&interface]()
+      {
+        for(size_t i = 0; i < eventCount; i++)
+        {
+          EventLoop::call(
+            [&interface, address=1 + static_cast<uint32_t>(i % inputCount), value=toTriState((i / inputCount) % 2 == 0)]()
+            {
+              interface->updateInputValue(InputChannel::Input, address, value);
+            });
+        }
+      });
+    producer.join();
+    EventLoop::ioContext().run();
+    return eventCount;
+  };
+
+  KernelEventQueue queue;
+
+  BENCHMARK("KernelEventQueue")
+  {
+    EventLoop::reset();
+    std::thread producer(
+      [&queue, &interface]()
+      {
+        for(size_t i = 0; i < eventCount; i++)
+          queue.pushInput(*interface, InputChannel::Input, 1 + static_cast<uint32_t>(i % inputCount), toTriState((i / inputCount) % 2 == 0));
+      });
+    producer.join();
+    EventLoop::ioContext().run();
+    return queue.statistics().maxBatchSize;
+  };
+}
@@ -0,0 +1,112 @@
+/**
+ * server/test/hardware/loconetsendqueue.cpp
+ *
+ * This file is part of the traintastic test suite.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include "../src/hardware/protocol/loconet/kernel.hpp"
+#include "../src/hardware/protocol/loconet/messages.hpp"
+
+using SendQueue = LocoNet::Kernel::TestSendQueue;
+
+template<class T>
+static T forSlot(T message, uint8_t slot)
+{
+  message.slot = slot;
+  message.checksum = LocoNet::calcChecksum(message);
+  return message;
+}
+
+static const LocoNet::LocoSpd& frontSpd(const SendQueue& queue)
+{
+  REQUIRE(queue.front().opCode == LocoNet::OPC_LOCO_SPD);
+  return static_cast<const LocoNet::LocoSpd&>(queue.front());
+}
+
+TEST_CASE("LocoNet: send queue supersedes slot commands", "[loconet][sendqueue]")
+{
+  using namespace LocoNet;
+
+  SendQueue queue;
+  REQUIRE(queue.append(forSlot(LocoSpd(10), 1)));
+  REQUIRE(queue.append(forSlot(LocoSpd(20), 2)));
+  REQUIRE(queue.append(forSlot(LocoSpd(30), 1))); // replaces the queued one for slot 1
+  REQUIRE(queue.size() == 2);
+  REQUIRE(queue.superseded() == 1);
+  REQUIRE(frontSpd(queue).slot == 1);
+  REQUIRE(frontSpd(queue).speed == 30);
+
+  // the message being sent isn't replaced:
+  queue.setFrontSent();
+  REQUIRE(queue.append(forSlot(LocoSpd(40), 1)));
+  REQUIRE(queue.size() == 3);
+  REQUIRE(queue.superseded() == 1);
+
+  queue.pop();
+  REQUIRE(frontSpd(queue).slot == 2);
+  queue.pop();
+  REQUIRE(frontSpd(queue).slot == 1);
+  REQUIRE(frontSpd(queue).speed == 40);
+  queue.pop();
+  REQUIRE(queue.empty());
+
+  std::chrono::steady_clock::duration latency{};
+  uint32_t count = 0;
+  queue.takeLatency(latency, count);
+  REQUIRE(count == 3);
+}
+
+TEST_CASE("LocoNet: send queue keeps order of commands for a slot", "[loconet][sendqueue]")
+{
+  using namespace LocoNet;
+
+  // stop, reverse, go:
+  SendQueue queue;
+  REQUIRE(queue.append(forSlot(LocoSpd(0), 1)));
+  REQUIRE(queue.append(forSlot(LocoDirF(Direction::Reverse, false, false, false, false, false), 1)));
+  REQUIRE(queue.append(forSlot(LocoSpd(50), 1))); // may not replace the stop, it's before the reverse
+  REQUIRE(queue.size() == 3);
+  REQUIRE(queue.superseded() == 0);
+
+  // a command for another slot doesn't matter:
+  REQUIRE(queue.append(forSlot(LocoSpd(20), 2)));
+  REQUIRE(queue.append(forSlot(LocoSpd(60), 1))); // replaces go, it's the last one for slot 1
+  REQUIRE(queue.size() == 4);
+  REQUIRE(queue.superseded() == 1);
+
+  // a slot request is an ordering barrier too:
+  REQUIRE(queue.append(RequestSlotData(1)));
+  REQUIRE(queue.append(forSlot(LocoSpd(70), 1)));
+  REQUIRE(queue.size() == 6);
+  REQUIRE(queue.superseded() == 1);
+
+  REQUIRE(frontSpd(queue).speed == 0);
+  queue.pop();
+  REQUIRE(queue.front().opCode == OPC_LOCO_DIRF);
+  REQUIRE(static_cast<const LocoDirF&>(queue.front()).direction() == Direction::Reverse);
+  queue.pop();
+  REQUIRE(frontSpd(queue).speed == 60);
+  queue.pop();
+  REQUIRE(frontSpd(queue).slot == 2);
+  queue.pop();
+  REQUIRE(queue.front().opCode == OPC_RQ_SL_DATA);
+  queue.pop();
+  REQUIRE(frontSpd(queue).speed == 70);
+}
@@ -0,0 +1,147 @@
+/**
+ * server/test/hardware/pcap.cpp
+ *
+ * This file is part of the traintastic test suite.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <cstring>
+#include "../src/core/eventloop.hpp"
+#include "../src/core/method.tpp"
+#include "../src/core/objectproperty.tpp"
+#include "../src/world/world.hpp"
+#include "../src/hardware/interface/interfacelist.hpp"
+#include "../src/hardware/interface/loconetinterface.hpp"
+#include "../src/hardware/protocol/loconet/kernel.hpp"
+#include "../src/hardware/protocol/loconet/messages.hpp"
+#include "../src/hardware/protocol/loconet/settings.hpp"
+#include "../src/hardware/protocol/loconet/iohandler/replayiohandler.hpp"
+#include "../src/pcap/pcapfile.hpp"
+#include "../src/pcap/pcapreader.hpp"
+#include "../src/pcap/pcapreplay.hpp"
+
+//! \brief Create a LocoNet capture with a feedback burst
+static std::filesystem::path createInputCapture(size_t messageCount)
+{
+  const auto filename = std::filesystem::temp_directory_path() / "traintastic-test-loconet.pcap";
+  PCAPFile pcap(filename, PCAPLinkType::LocoNet);
+  for(size_t i = 0; i < messageCount; i++)
+  {
+    const LocoNet::InputRep message(static_cast<uint16_t>(i % 4096), (i / 4096) % 2 == 0);
+    pcap.writeRecord(&message, message.size());
+  }
+  return filename;
+}
+
+TEST_CASE("PCAP: write and read capture", "[pcap]")
+{
+  static constexpr size_t messageCount = 10'000;
+
+  const auto filename = createInputCapture(messageCount);
+
+  PCAPReader reader(filename);
+  REQUIRE(reader.network() == PCAPLinkType::LocoNet);
+
+  PCAPReader::Record record;
+  size_t count = 0;
+  std::chrono::microseconds lastTimestamp{0};
+  while(reader.read(record))
+  {
+    const LocoNet::InputRep expected(static_cast<uint16_t>(count % 4096), (count / 4096) % 2 == 0);
+    REQUIRE(record.data.size() == expected.size());
+    REQUIRE(std::memcmp(record.data.data(), &expected, expected.size()) == 0);
+    REQUIRE(record.timestamp >= lastTimestamp);
+    lastTimestamp = record.timestamp;
+    count++;
+  }
+  REQUIRE(count == messageCount);
+
+  std::filesystem::remove(filename);
+}
+
+TEST_CASE("PCAP: replay capture", "[pcap]")
+{
+  static constexpr size_t messageCount = 1'000;
+
+  const auto filename = createInputCapture(messageCount);
+
+  boost::asio::io_context ioContext;
+  size_t count = 0;
+  bool finished = false;
+
+  PCAPReplay replay(ioContext, filename, PCAPLinkType::LocoNet, PCAPReplay::asFastAsPossible,
+    [&count](const std::byte* data, size_t size)
+    {
+      const LocoNet::InputRep expected(static_cast<uint16_t>(count % 4096), true);
+      REQUIRE(size == expected.size());
+      REQUIRE(std::memcmp(data, &expected, expected.size()) == 0);
+      count++;
+    });
+  replay.setOnFinished(
+    [&finished]()
+    {
+      finished = true;
+    });
+
+  replay.start();
+  ioContext.run();
+
+  REQUIRE(finished);
+  REQUIRE(count == messageCount);
+  REQUIRE(replay.recordCount() == messageCount);
+
+  REQUIRE_THROWS(PCAPReplay(ioContext, filename, PCAPLinkType::Z21, 1, [](const std::byte*, size_t){}));
+
+  std::filesystem::remove(filename);
+}
+
+TEST_CASE("PCAP: LocoNet feedback burst replay benchmark", "[.][benchmark][pcap]")
+{
+  static constexpr size_t messageCount = 100'000;
+
+  EventLoop::reset();
+  EventLoop::threadId = std::this_thread::get_id();
+
+  const auto filename = createInputCapture(messageCount);
+
+  auto world = World::create();
+  auto interface = std::dynamic_pointer_cast<LocoNetInterface>(world->interfaces->create(LocoNetInterface::classId));
+  REQUIRE(interface);
+
+  BENCHMARK("Replay through kernel and event loop")
+  {
+    EventLoop::reset();
+
+    auto kernel = LocoNet::Kernel::create<LocoNet::ReplayIOHandler>(interface->id.value(), interface->loconet->config(), filename, PCAPReplay::asFastAsPossible,
+      []()
+      {
+        EventLoop::call(EventLoop::stop); // stops after all posted input changes are handled
+      });
+    kernel->setInputController(interface.get());
+
+    kernel->start();
+    EventLoop::exec();
+    kernel->stop();
+
+    return messageCount;
+  };
+
+  std::filesystem::remove(filename);
+}
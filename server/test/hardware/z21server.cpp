@@ -0,0 +1,316 @@
+/**
+ * server/test/hardware/z21server.cpp
+ *
+ * This file is part of the traintastic test suite.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <array>
+#include <vector>
+#include "../src/core/eventloop.hpp"
+#include "../src/core/method.tpp"
+#include "../src/core/objectproperty.tpp"
+#include "../src/world/world.hpp"
+#include "../src/hardware/decoder/decoder.hpp"
+#include "../src/hardware/decoder/list/decoderlist.hpp"
+#include "../src/hardware/protocol/z21/messages.hpp"
+#include "../src/hardware/protocol/z21/serverkernel.hpp"
+#include "../src/hardware/protocol/z21/iohandler/udpiohandler.hpp"
+
+using boost::asio::ip::udp;
+
+namespace {
+
+class LoopbackIOHandler;
+
+//! \brief Local UDP stand-in for Z21 clients, all clients share a few sink sockets
+struct Loopback
+{
+  boost::asio::io_context ioContext;
+  std::vector<udp::socket> sinks;
+  LoopbackIOHandler* handler = nullptr;
+  size_t sendCalls = 0; //!< number of IOHandler::sendTo() calls
+
+  Loopback(size_t sinkCount)
+  {
+    for(size_t i = 0; i < sinkCount; i++)
+      sinks.emplace_back(ioContext, udp::endpoint(boost::asio::ip::address_v4::loopback(), 0));
+  }
+
+  udp::endpoint endpoint(Z21::IOHandler::ClientId clientId) const
+  {
+    return sinks[clientId % sinks.size()].local_endpoint();
+  }
+
+  //! \brief Receive all pending datagrams of a sink
+  std::vector<std::vector<std::byte>> receive(size_t sink)
+  {
+    std::vector<std::vector<std::byte>> datagrams;
+    while(const size_t size = sinks[sink].available())
+    {
+      auto& datagram = datagrams.emplace_back(size);
+      sinks[sink].receive(boost::asio::buffer(datagram));
+    }
+    return datagrams;
+  }
+
+  void drain()
+  {
+    for(size_t i = 0; i < sinks.size(); i++)
+      receive(i);
+  }
+};
+
+//! \brief UDP IO handler bound to loopback, sends to the clients of a ::Loopback
+class LoopbackIOHandler final : public Z21::UDPIOHandler
+{
+  private:
+    Loopback& m_loopback;
+
+  protected:
+    void receive(const Z21::Message& /*message*/, const udp::endpoint& /*remoteEndpoint*/) final
+    {
+    }
+
+  public:
+    LoopbackIOHandler(Z21::ServerKernel& kernel, Loopback* loopback)
+      : UDPIOHandler(kernel)
+      , m_loopback{*loopback}
+    {
+      m_socket.open(udp::v4());
+      m_socket.bind(udp::endpoint(boost::asio::ip::address_v4::loopback(), 0));
+      m_loopback.handler = this;
+    }
+
+    void start() final
+    {
+    }
+
+    void stop() final
+    {
+    }
+
+    void addClient(ClientId id)
+    {
+      m_clients.emplace(id, m_loopback.endpoint(id));
+    }
+
+    bool sendTo(const Z21::Message& message, ClientId id) final
+    {
+      m_loopback.sendCalls++;
+      return sendToClient(message, id);
+    }
+
+    bool sendTo(const Z21::Message& message, std::span<const ClientId> ids) final
+    {
+      m_loopback.sendCalls++;
+      return sendToClients(message, ids);
+    }
+
+    void purgeClient(ClientId id) final
+    {
+      m_clients.erase(id);
+    }
+};
+
+//! \brief Run event loop and kernel until both are idle, the test thread acts as both
+void run(Z21::ServerKernel& kernel)
+{
+  for(int i = 0; i < 3; i++)
+  {
+    EventLoop::ioContext().restart();
+    EventLoop::ioContext().run();
+    kernel.ioContext().restart();
+    kernel.ioContext().run();
+  }
+}
+
+void connect(Z21::ServerKernel& kernel, LoopbackIOHandler& handler, Z21::IOHandler::ClientId clientId, Z21::BroadcastFlags broadcastFlags, uint16_t locoAddress)
+{
+  handler.addClient(clientId);
+  kernel.receiveFrom(Z21::LanSetBroadcastFlags(broadcastFlags), clientId);
+  if(locoAddress != 0)
+    kernel.receiveFrom(Z21::LanXGetLocoInfo(locoAddress, false), clientId);
+}
+
+}
+
+TEST_CASE("Z21 server: broadcast fan-out", "[hardware][z21]")
+{
+  EventLoop::reset();
+  EventLoop::threadId = std::this_thread::get_id();
+
+  auto world = World::create();
+  auto decoder = Decoder::create(*world);
+  decoder->address = 3;
+
+  Loopback loopback(3);
+  auto kernel = Z21::ServerKernel::create<LoopbackIOHandler>("z21", Z21::ServerConfig{}, world->decoders.value(), &loopback);
+  REQUIRE(loopback.handler);
+
+  connect(*kernel, *loopback.handler, 0, Z21::BroadcastFlags::PowerLocoTurnoutChanges, 3); // subscribed
+  connect(*kernel, *loopback.handler, 1, Z21::BroadcastFlags::PowerLocoTurnoutChanges, 0); // not subscribed
+  connect(*kernel, *loopback.handler, 2, Z21::BroadcastFlags::None, 3); // subscribed, no broadcasts
+  run(*kernel);
+  loopback.drain(); // loco info replies
+  loopback.sendCalls = 0;
+
+  // loco change, only to subscribed clients with flag, encoded and sent once:
+  decoder->throttle = 0.5f;
+  run(*kernel);
+  REQUIRE(loopback.sendCalls == 1);
+  {
+    const auto datagrams = loopback.receive(0);
+    REQUIRE(datagrams.size() == 1);
+    const auto& message = *reinterpret_cast<const Z21::LanXLocoInfo*>(datagrams.front().data());
+    REQUIRE(message.header() == Z21::LAN_X);
+    REQUIRE(message.xheader == Z21::LAN_X_LOCO_INFO);
+    REQUIRE(message.address() == 3);
+  }
+  REQUIRE(loopback.receive(1).empty());
+  REQUIRE(loopback.receive(2).empty());
+
+  // power broadcast, to all clients with flag:
+  loopback.sendCalls = 0;
+  kernel->setState(true, false);
+  run(*kernel);
+  REQUIRE(loopback.sendCalls == 2); // track power on and system state
+  REQUIRE(loopback.receive(0).size() == 2);
+  REQUIRE(loopback.receive(1).size() == 2);
+  REQUIRE(loopback.receive(2).empty());
+
+  // logoff removes subscriptions and flags:
+  kernel->receiveFrom(Z21::LanLogoff(), 0);
+  loopback.sendCalls = 0;
+  decoder->throttle = 0.25f;
+  run(*kernel);
+  REQUIRE(loopback.sendCalls == 0);
+  REQUIRE(loopback.receive(0).empty());
+
+  kernel->receiveFrom(Z21::LanLogoff(), 1);
+  kernel->receiveFrom(Z21::LanLogoff(), 2);
+  run(*kernel);
+}
+
+TEST_CASE("Z21 server: send to clients", "[hardware][z21]")
+{
+  EventLoop::reset();
+  EventLoop::threadId = std::this_thread::get_id();
+
+  auto world = World::create();
+
+  Loopback loopback(3);
+  auto kernel = Z21::ServerKernel::create<LoopbackIOHandler>("z21", Z21::ServerConfig{}, world->decoders.value(), &loopback);
+  REQUIRE(loopback.handler);
+  loopback.handler->addClient(0);
+  loopback.handler->addClient(1);
+
+  const Z21::LanGetSerialNumber message;
+
+  REQUIRE(loopback.handler->sendTo(message, 0));
+  REQUIRE(!loopback.handler->sendTo(message, 2)); // unknown client
+  REQUIRE(loopback.receive(0).size() == 1);
+  REQUIRE(loopback.receive(2).empty());
+
+  const std::array<Z21::IOHandler::ClientId, 2> known{0, 1};
+  REQUIRE(loopback.handler->sendTo(message, known));
+  REQUIRE(loopback.receive(0).size() == 1);
+  REQUIRE(loopback.receive(1).size() == 1);
+
+  // unknown clients fail the send, the known clients still get the message:
+  const std::array<Z21::IOHandler::ClientId, 3> withUnknown{0, 2, 1};
+  REQUIRE(!loopback.handler->sendTo(message, withUnknown));
+  REQUIRE(loopback.receive(0).size() == 1);
+  REQUIRE(loopback.receive(1).size() == 1);
+  REQUIRE(loopback.receive(2).empty());
+
+  loopback.handler->purgeClient(1);
+  REQUIRE(!loopback.handler->sendTo(message, known));
+  REQUIRE(loopback.receive(0).size() == 1);
+  REQUIRE(loopback.receive(1).empty());
+}
+
+TEST_CASE("Z21 server: broadcast fan-out benchmark", "[.][benchmark][z21]")
+{
+  static constexpr size_t changeCount = 1000;
+
+  EventLoop::reset();
+  EventLoop::threadId = std::this_thread::get_id();
+
+  auto world = World::create();
+  auto decoder = Decoder::create(*world);
+  decoder->address = 3;
+
+  for(size_t clientCount : {20, 100})
+  {
+    Loopback loopback(4);
+    auto kernel = Z21::ServerKernel::create<LoopbackIOHandler>("z21", Z21::ServerConfig{}, world->decoders.value(), &loopback);
+    for(size_t i = 0; i < clientCount; i++)
+      connect(*kernel, *loopback.handler, i, Z21::BroadcastFlags::PowerLocoTurnoutChanges, 3);
+    run(*kernel);
+    loopback.drain();
+
+    const auto clientCountText = std::to_string(clientCount);
+    Z21::LanXLocoInfo message(*decoder);
+    std::vector<Z21::IOHandler::ClientId> clientIds(clientCount);
+    for(size_t i = 0; i < clientCount; i++)
+      clientIds[i] = i;
+
+    BENCHMARK(clientCountText + " clients, send per client")
+    {
+      for(size_t i = 0; i < changeCount; i++)
+      {
+        for(auto clientId : clientIds)
+          loopback.handler->sendTo(message, clientId);
+        if(i % 16 == 0)
+          loopback.drain();
+      }
+      return loopback.sendCalls;
+    };
+
+    BENCHMARK(clientCountText + " clients, gathered send")
+    {
+      for(size_t i = 0; i < changeCount; i++)
+      {
+        loopback.handler->sendTo(message, std::span<const Z21::IOHandler::ClientId>(clientIds));
+        if(i % 16 == 0)
+          loopback.drain();
+      }
+      return loopback.sendCalls;
+    };
+
+    BENCHMARK(clientCountText + " clients, loco changes through kernel")
+    {
+      for(size_t i = 0; i < changeCount; i++)
+      {
+        decoder->throttle = (i % 2 == 0) ? 0.5f : 0.25f;
+        kernel->ioContext().restart();
+        kernel->ioContext().run();
+        if(i % 16 == 0)
+          loopback.drain();
+      }
+      return loopback.sendCalls;
+    };
+
+    for(size_t i = 0; i < clientCount; i++)
+      kernel->receiveFrom(Z21::LanLogoff(), i);
+    run(*kernel);
+  }
+}
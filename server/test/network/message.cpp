@@ -0,0 +1,216 @@
+/**
+ * server/test/network/message.cpp
+ *
+ * This file is part of the traintastic test suite.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <traintastic/network/message.hpp>
+
+TEST_CASE("Message: write and read nested blocks", "[message]")
+{
+  const std::string_view text = "traintastic";
+  const std::vector<uint16_t> values{1, 2, 3};
+
+  auto message = Message::newEvent(Message::Command::ObjectPropertyChanged, Message::writeSize(uint32_t{0}, text));
+  message->write<uint32_t>(42);
+  message->writeBlock();
+  message->write(text);
+  message->writeBlock();
+  message->write(values);
+  message->write(true);
+  message->writeBlockEnd();
+  message->writeBlockEnd();
+  message->write<double>(0.5);
+
+  REQUIRE(message->size() == sizeof(Message::Header) + message->dataSize());
+  REQUIRE(message->dataSize() ==
+    Message::writeSize(uint32_t{0}, uint32_t{0}, text, uint32_t{0}) +
+    sizeof(Message::Length) + values.size() * sizeof(uint16_t) +
+    Message::writeSize(true, 0.5));
+
+  const auto check =
+    [&](const Message& m)
+    {
+      REQUIRE(m.command() == Message::Command::ObjectPropertyChanged);
+      REQUIRE(m.isEvent());
+      REQUIRE(m.read<uint32_t>() == 42);
+      m.readBlock();
+      REQUIRE(m.read<std::string_view>() == text);
+      m.readBlock();
+      REQUIRE(m.read<std::vector<uint16_t>>() == values);
+      REQUIRE(m.read<bool>());
+      REQUIRE(m.endOfBlock());
+      m.readBlockEnd();
+      m.readBlockEnd();
+      REQUIRE(m.read<double>() == 0.5);
+      REQUIRE(m.endOfMessage());
+    };
+
+  SECTION("copy")
+  {
+    check(Message(**message, message->size()));
+  }
+
+  SECTION("view")
+  {
+    const auto* bytes = static_cast<const uint8_t*>(**message);
+    const Message view(std::span<const uint8_t>(bytes, message->size()));
+    REQUIRE(*view == **message);
+    check(view);
+  }
+}
+
+TEST_CASE("Message: data size is stored in the header when sent", "[message]")
+{
+  auto message = Message::newEvent(Message::Command::ObjectPropertyChanged);
+  message->write<uint32_t>(42);
+  message->write(std::string_view("traintastic"));
+  REQUIRE(message->dataSize() == Message::writeSize(uint32_t{0}, std::string_view("traintastic")));
+
+  Message::Header header;
+  std::memcpy(&header, **message, sizeof(header));
+  REQUIRE(header.dataSize == message->dataSize());
+}
+
+TEST_CASE("Message: blocks nested too deep", "[message]")
+{
+  auto message = Message::newEvent(Message::Command::ObjectPropertyChanged);
+  for(size_t i = 0; i < 16; i++)
+    message->writeBlock();
+  REQUIRE_THROWS_AS(message->writeBlock(), std::length_error);
+}
+
+TEST_CASE("Message: buffers are recycled", "[message]")
+{
+  auto& pool = Message::BufferPool::instance();
+
+  auto message = Message::newRequest(Message::Command::Ping);
+  const size_t available = pool.size();
+  const void* buffer = **message;
+  message.reset();
+  REQUIRE(pool.size() == available + 1);
+
+  message = Message::newRequest(Message::Command::Ping);
+  REQUIRE(pool.size() == available);
+  REQUIRE(**message == buffer);
+}
+
+TEST_CASE("Message: item index is skipped by older readers", "[message]")
+{
+  auto message = Message::newResponse(Message::Command::NewSession, 1);
+  message->writeBlock(); // items
+  for(uint16_t slot : {uint16_t{3}, uint16_t{7}})
+  {
+    message->writeBlock(); // item
+    message->write<std::string_view>("name");
+    message->writeBlock(); // attributes
+    message->writeBlockEnd();
+    message->write(slot);
+    message->writeBlockEnd();
+  }
+  message->writeBlockEnd();
+
+  const auto read =
+    [&message](bool withIndex)
+    {
+      const Message m(**message, message->size());
+      std::vector<uint16_t> slots;
+      m.readBlock(); // items
+      while(!m.endOfBlock())
+      {
+        m.readBlock(); // item
+        REQUIRE(m.read<std::string_view>() == "name");
+        m.readBlock(); // attributes
+        m.readBlockEnd();
+        if(withIndex && !m.endOfBlock())
+          slots.push_back(m.read<uint16_t>());
+        m.readBlockEnd();
+      }
+      m.readBlockEnd();
+      REQUIRE(m.endOfMessage());
+      return slots;
+    };
+
+  REQUIRE(read(false).empty());
+  REQUIRE(read(true) == std::vector<uint16_t>{3, 7});
+}
+
+TEST_CASE("Message: split combined frame", "[message]")
+{
+  std::vector<std::unique_ptr<Message>> messages;
+  messages.emplace_back(Message::newRequest(Message::Command::Ping));
+  messages.emplace_back(Message::newEvent(Message::Command::ObjectPropertyChanged));
+  messages.back()->write<uint32_t>(42);
+  messages.back()->write<std::string_view>("name");
+  messages.emplace_back(Message::newResponse(Message::Command::ServerLog, 7));
+  messages.back()->write<uint8_t>(1); // odd size, next header isn't aligned
+  messages.emplace_back(Message::newEvent(Message::Command::ObjectDestroyed));
+  messages.back()->write<uint32_t>(3);
+
+  // combine, starting at an odd offset:
+  std::vector<uint8_t> frame(1);
+  for(const auto& message : messages)
+  {
+    const auto* bytes = static_cast<const uint8_t*>(**message);
+    frame.insert(frame.end(), bytes, bytes + message->size());
+  }
+  const auto data = std::span<const uint8_t>(frame).subspan(1);
+
+  const auto split =
+    [](std::span<const uint8_t> bytes)
+    {
+      std::vector<std::unique_ptr<Message>> result;
+      const size_t used = Message::splitFrame(bytes,
+        [&result](std::span<const uint8_t> message)
+        {
+          result.emplace_back(std::make_unique<Message>(message.data(), message.size()));
+        });
+      return std::make_pair(std::move(result), used);
+    };
+
+  SECTION("complete")
+  {
+    const auto [result, used] = split(data);
+    REQUIRE(used == data.size());
+    REQUIRE(result.size() == messages.size());
+    for(size_t i = 0; i < messages.size(); i++)
+    {
+      REQUIRE(result[i]->size() == messages[i]->size());
+      REQUIRE(std::memcmp(**result[i], **messages[i], messages[i]->size()) == 0);
+    }
+    REQUIRE(result[1]->read<uint32_t>() == 42);
+    REQUIRE(result[1]->read<std::string_view>() == "name");
+    REQUIRE(result[2]->isResponse());
+    REQUIRE(result[2]->requestId() == 7);
+    REQUIRE(result[3]->command() == Message::Command::ObjectDestroyed);
+  }
+
+  SECTION("incomplete")
+  {
+    // last message is incomplete, it is left for the next read:
+    const auto [result, used] = split(data.first(data.size() - 1));
+    REQUIRE(result.size() == messages.size() - 1);
+    REQUIRE(used == data.size() - messages.back()->size());
+
+    // so is a partial header:
+    REQUIRE(split(data.first(messages[0]->size() + 3)).second == messages[0]->size());
+  }
+}
@@ -0,0 +1,97 @@
+/**
+ * server/test/train/trainmotionscheduler.cpp
+ *
+ * This file is part of the traintastic test suite.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include "../../src/core/eventloop.hpp"
+#include "../../src/core/objectproperty.tpp"
+#include "../../src/core/method.tpp"
+#include "../../src/world/world.hpp"
+#include "../../src/vehicle/rail/railvehiclelist.hpp"
+#include "../../src/vehicle/rail/locomotive.hpp"
+#include "../../src/train/trainlist.hpp"
+#include "../../src/train/train.hpp"
+#include "../../src/train/trainmotionscheduler.hpp"
+#include "../../src/train/trainvehiclelist.hpp"
+#include "../../src/hardware/decoder/decoder.hpp"
+
+using Catch::Matchers::WithinAbs;
+
+TEST_CASE("TrainMotionScheduler: accelerate and brake", "[train][trainmotionscheduler]")
+{
+  EventLoop::reset();
+
+  auto world = World::create();
+  auto& scheduler = *world->trainMotionScheduler;
+  REQUIRE(scheduler.interval.value() == 100);
+
+  auto locomotive = world->railVehicles->create(Locomotive::classId);
+  locomotive->speedMax.setValue(100);
+
+  auto train = world->trains->create();
+  train->vehicles->add(locomotive);
+  train->active = true;
+  train->acceleration = 2;
+  train->deceleration = 1;
+
+  const auto ticksUntilDone =
+    [&scheduler]()
+    {
+      int ticks = 0;
+      while(scheduler.activeTrains.value() != 0 && ticks < 1000)
+      {
+        scheduler.tick();
+        ticks++;
+      }
+      return ticks;
+    };
+
+  // 10 m/s at 2 m/s² takes 5 s, 50 ticks:
+  train->throttleSpeed.setValue(36);
+  REQUIRE(scheduler.activeTrains.value() == 1);
+
+  scheduler.tick();
+  REQUIRE_THAT(train->speed.getValue(SpeedUnit::MeterPerSecond), WithinAbs(0.2, 1e-6));
+  REQUIRE_FALSE(train->isStopped.value());
+
+  const int accelerateTicks = 1 + ticksUntilDone();
+  REQUIRE(accelerateTicks >= 50);
+  REQUIRE(accelerateTicks <= 51); // rounding
+  REQUIRE_THAT(train->speed.getValue(SpeedUnit::KiloMeterPerHour), WithinAbs(36, 1e-9));
+  REQUIRE_FALSE(train->isStopped.value());
+
+  // 10 m/s at 1 m/s² takes 10 s, 100 ticks:
+  train->throttleSpeed.setValue(0);
+  REQUIRE(scheduler.activeTrains.value() == 1);
+
+  const int brakeTicks = ticksUntilDone();
+  REQUIRE(brakeTicks >= 100);
+  REQUIRE(brakeTicks <= 101); // rounding
+  REQUIRE(train->isStopped.value());
+  REQUIRE(train->speed.value() == 0);
+
+  // emergency stop removes the train from the scheduler:
+  train->throttleSpeed.setValue(50);
+  REQUIRE(scheduler.activeTrains.value() == 1);
+  train->emergencyStop = true;
+  REQUIRE(scheduler.activeTrains.value() == 0);
+}
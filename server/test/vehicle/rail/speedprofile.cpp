@@ -0,0 +1,133 @@
+/**
+ * server/test/vehicle/rail/speedprofile.cpp
+ *
+ * This file is part of the traintastic test suite.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include "../../../src/core/eventloop.hpp"
+#include "../../../src/core/objectproperty.tpp"
+#include "../../../src/core/method.tpp"
+#include "../../../src/world/world.hpp"
+#include "../../../src/vehicle/rail/railvehiclelist.hpp"
+#include "../../../src/vehicle/rail/locomotive.hpp"
+#include "../../../src/vehicle/rail/speedprofile.hpp"
+#include "../../../src/train/trainlist.hpp"
+#include "../../../src/train/train.hpp"
+#include "../../../src/train/trainmotionscheduler.hpp"
+#include "../../../src/train/trainvehiclelist.hpp"
+#include "../../../src/hardware/decoder/decoder.hpp"
+
+using Catch::Matchers::WithinAbs;
+
+TEST_CASE("SpeedProfile: lookup and inversion", "[speedprofile]")
+{
+  SpeedProfile profile;
+  REQUIRE(profile.empty());
+
+  // locomotive doesn't move below 10% throttle:
+  profile.set(1.0, 120);
+  profile.set(0.1, 0);
+  profile.set(0.5, 60);
+  profile.set(0.5, 50); // replaces
+  profile.set(0, 10); // invalid, throttle zero is always stopped
+  REQUIRE(profile.points().size() == 3);
+  REQUIRE(profile.speedMax() == 120);
+
+  REQUIRE(profile.speed(0) == 0);
+  REQUIRE(profile.speed(0.05) == 0);
+  REQUIRE_THAT(profile.speed(0.3), WithinAbs(25, 1e-4));
+  REQUIRE_THAT(profile.speed(0.75), WithinAbs(85, 1e-4));
+  REQUIRE(profile.speed(1.0) == 120);
+
+  REQUIRE(profile.throttle(0) == 0);
+  REQUIRE_THAT(profile.throttle(25), WithinAbs(0.3, 1e-6));
+  REQUIRE_THAT(profile.throttle(85), WithinAbs(0.75, 1e-6));
+  REQUIRE(profile.throttle(200) == 1.0f);
+  for(double speed = 1; speed < 120; speed += 0.5)
+    REQUIRE_THAT(profile.speed(profile.throttle(speed)), WithinAbs(speed, 1e-4));
+
+  // nearest speed step:
+  REQUIRE(profile.step(0, 126) == 0);
+  REQUIRE(profile.step(0.01, 126) == 13); // first step that moves
+  REQUIRE(profile.step(50, 126) == 63);
+  REQUIRE(profile.step(120, 126) == 126);
+  REQUIRE(profile.step(50, 28) == 14);
+
+  // speed must not decrease, else it can't be inverted:
+  profile.set(0.75, 40);
+  REQUIRE(profile.speed(0.75) == 50);
+  REQUIRE(profile.points()[2].speed == 40); // measured point is kept
+  profile.set(0.75, 90); // correction works on the measured data
+  REQUIRE(profile.speed(0.75) == 90);
+  REQUIRE(profile.speed(0.6) == 66);
+  profile.set(0.75, 40);
+
+  // persistent:
+  SpeedProfile copy;
+  copy.fromJSON(profile.toJSON());
+  REQUIRE(copy.points().size() == profile.points().size());
+  for(size_t i = 0; i < copy.points().size(); i++)
+  {
+    REQUIRE(copy.points()[i].throttle == profile.points()[i].throttle);
+    REQUIRE(copy.points()[i].speed == profile.points()[i].speed);
+  }
+
+  profile.clear();
+  REQUIRE(profile.empty());
+}
+
+TEST_CASE("SpeedProfile: double headed train", "[speedprofile]")
+{
+  EventLoop::reset();
+
+  auto world = World::create();
+
+  auto locomotive1 = std::dynamic_pointer_cast<Locomotive>(world->railVehicles->create(Locomotive::classId));
+  locomotive1->createDecoder();
+  locomotive1->decoder->speedSteps = 126;
+  locomotive1->setSpeedProfilePoint(1.0, 100);
+
+  auto locomotive2 = std::dynamic_pointer_cast<Locomotive>(world->railVehicles->create(Locomotive::classId));
+  locomotive2->createDecoder();
+  locomotive2->decoder->speedSteps = 126;
+  locomotive2->setSpeedProfilePoint(0.5, 40);
+  locomotive2->setSpeedProfilePoint(1.0, 80);
+  REQUIRE(locomotive2->speedMax.getValue(SpeedUnit::KiloMeterPerHour) == 100); // user setting is kept
+  REQUIRE(locomotive2->calcSpeedMax(SpeedUnit::KiloMeterPerHour) == 80);
+
+  auto train = world->trains->create();
+  train->vehicles->add(locomotive1);
+  train->vehicles->add(locomotive2);
+  REQUIRE(train->speedMax.getValue(SpeedUnit::KiloMeterPerHour) == 80); // slowest locomotive
+  train->active = true;
+
+  train->throttleSpeed.setValue(40);
+  while(world->trainMotionScheduler->activeTrains.value() != 0)
+    world->trainMotionScheduler->tick();
+
+  // both locomotives run at 40 km/h:
+  REQUIRE_THAT(locomotive1->decoder->throttle.value(), WithinAbs(50. / 126, 1e-6));
+  REQUIRE_THAT(locomotive2->decoder->throttle.value(), WithinAbs(63. / 126, 1e-6));
+
+  // without profile the maximum speed setting is used again:
+  locomotive2->clearSpeedProfile();
+  REQUIRE(train->speedMax.getValue(SpeedUnit::KiloMeterPerHour) == 100);
+}
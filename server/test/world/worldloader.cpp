@@ -0,0 +1,110 @@
+/**
+ * server/test/world/worldloader.cpp
+ *
+ * This file is part of the traintastic test suite.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "../../src/core/eventloop.hpp"
+#include "../../src/core/method.tpp"
+#include "../../src/core/objectproperty.tpp"
+#include "../../src/world/world.hpp"
+#include "../../src/world/worldloader.hpp"
+#include "../../src/world/worldsaver.hpp"
+#include "../../src/hardware/decoder/list/decoderlist.hpp"
+#include "../../src/vehicle/rail/locomotive.hpp"
+#include "../../src/vehicle/rail/railvehiclelist.hpp"
+#include "../../src/train/train.hpp"
+#include "../../src/train/trainlist.hpp"
+#include "../../src/train/trainvehiclelist.hpp"
+
+//! \brief Create and save a world with a locomotive (with decoder) in every train
+static std::filesystem::path createWorld(size_t trainCount, std::string& uuid)
+{
+  auto world = World::create();
+  uuid = world->uuid;
+
+  for(size_t i = 0; i < trainCount; i++)
+  {
+    auto train = world->trains->create();
+    train->vehicles->add(world->railVehicles->create(Locomotive::classId));
+  }
+
+  const auto path = std::filesystem::temp_directory_path() / uuid;
+  std::filesystem::create_directories(path);
+  WorldSaver saver(*world, path);
+  return path;
+}
+
+TEST_CASE("WorldLoader: load world", "[worldloader]")
+{
+  static constexpr size_t trainCount = 100;
+
+  EventLoop::reset();
+
+  std::string uuid;
+  const auto path = createWorld(trainCount, uuid);
+
+  {
+    WorldLoader loader(path);
+    auto world = loader.world();
+    REQUIRE(world);
+    REQUIRE(world->uuid.value() == uuid);
+    REQUIRE(world->trains->length == trainCount);
+    REQUIRE(world->railVehicles->length == trainCount);
+    REQUIRE(world->decoders->length == trainCount);
+
+    for(size_t i = 0; i < trainCount; i++)
+    {
+      auto train = world->trains->operator[](static_cast<uint32_t>(i));
+      REQUIRE(train->vehicles->length == 1);
+      auto locomotive = std::dynamic_pointer_cast<Locomotive>(train->vehicles->operator[](0));
+      REQUIRE(locomotive);
+      REQUIRE(locomotive->trains.size() == 1);
+      REQUIRE(locomotive->trains[0] == train);
+      REQUIRE(locomotive->decoder);
+      REQUIRE(locomotive->decoder->vehicle.value() == locomotive);
+
+      // nested object id:
+      REQUIRE(loader.getObject(std::string(locomotive->decoder->getObjectId()).append(".functions")) == locomotive->decoder->functions.value());
+    }
+  }
+
+  std::filesystem::remove_all(path);
+}
+
+TEST_CASE("WorldLoader: startup benchmark", "[.][benchmark][worldloader]")
+{
+  static constexpr size_t trainCount = 6250; // train, locomotive, decoder and decoder function: 25k objects
+
+  EventLoop::reset();
+
+  std::string uuid;
+  const auto path = createWorld(trainCount, uuid);
+
+  BENCHMARK("Load world")
+  {
+    EventLoop::reset();
+    WorldLoader loader(path);
+    return loader.world()->trains->length.value();
+  };
+
+  std::filesystem::remove_all(path);
+}
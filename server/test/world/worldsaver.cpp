@@ -0,0 +1,65 @@
+/**
+ * server/test/world/worldsaver.cpp
+ *
+ * This file is part of the traintastic test suite.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include "../../src/core/eventloop.hpp"
+#include "../../src/core/method.tpp"
+#include "../../src/core/objectproperty.tpp"
+#include "../../src/world/world.hpp"
+#include "../../src/world/worldloader.hpp"
+#include "../../src/world/worldsaver.hpp"
+#include "../../src/train/train.hpp"
+#include "../../src/train/trainlist.hpp"
+
+TEST_CASE("WorldSaver: save compressed world twice and load", "[worldsaver]")
+{
+  EventLoop::reset();
+
+  auto world = World::create();
+  const std::string uuid = world->uuid;
+  const auto dir = std::filesystem::temp_directory_path() / ("traintastic-test-" + uuid);
+  const auto savePath = dir / std::string(uuid).append(World::dotCTW);
+  std::filesystem::create_directories(dir);
+
+  for(int i = 1; i <= 2; i++)
+  {
+    world->trains->create();
+    const auto result = WorldSaver(*world).save(savePath, dir / "backup" / (uuid + "_" + std::to_string(i)), false);
+    REQUIRE(result.error.empty());
+    REQUIRE_FALSE(result.createBackupDirectory);
+    REQUIRE_FALSE(result.createBackup);
+    REQUIRE(std::filesystem::is_regular_file(savePath)); // an archive, not a directory
+  }
+
+  // first save is backed up by the second one:
+  REQUIRE(std::filesystem::is_regular_file(dir / "backup" / std::string(uuid).append("_2").append(World::dotCTW)));
+  REQUIRE_FALSE(std::filesystem::exists(dir / std::string(uuid).append(".tmp").append(World::dotCTW)));
+
+  {
+    WorldLoader loader(savePath);
+    REQUIRE(loader.world());
+    REQUIRE(loader.world()->uuid.value() == uuid);
+    REQUIRE(loader.world()->trains->length == 2);
+  }
+
+  std::filesystem::remove_all(dir);
+}
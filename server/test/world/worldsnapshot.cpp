@@ -0,0 +1,226 @@
+/**
+ * server/test/world/worldsnapshot.cpp
+ *
+ * This file is part of the traintastic test suite.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include "../../src/core/eventloop.hpp"
+#include "../../src/core/method.tpp"
+#include "../../src/core/objectproperty.tpp"
+#include "../../src/world/world.hpp"
+#include "../../src/world/worldloader.hpp"
+#include "../../src/world/worldsaver.hpp"
+#include "../../src/world/twbreader.hpp"
+#include "../../src/world/twbwriter.hpp"
+#include "../../src/hardware/decoder/list/decoderlist.hpp"
+#include "../../src/vehicle/rail/locomotive.hpp"
+#include "../../src/vehicle/rail/railvehiclelist.hpp"
+#include "../../src/train/train.hpp"
+#include "../../src/train/trainlist.hpp"
+#include "../../src/train/trainvehiclelist.hpp"
+
+static std::shared_ptr<World> createWorld(size_t trainCount)
+{
+  auto world = World::create();
+  for(size_t i = 0; i < trainCount; i++)
+  {
+    auto train = world->trains->create();
+    train->vehicles->add(world->railVehicles->create(Locomotive::classId));
+  }
+  return world;
+}
+
+TEST_CASE("TWB: write and read", "[worldsnapshot]")
+{
+  const nlohmann::json data = {
+    {"uuid", "00000000-0000-0000-0000-000000000001"},
+    {"name", "Test"},
+    {"objects", {
+      {{"id", "train_1"}, {"class_id", "train"}, {"name", "Train 1"}},
+      {{"id", "board_1"}, {"class_id", "board"}},
+      {{"id", "train_2"}, {"class_id", "train"}, {"name", "Train 2"}},
+    }}};
+  const nlohmann::json state = {
+    {"uuid", "00000000-0000-0000-0000-000000000001"},
+    {"objects", nlohmann::json::array()},
+    {"states", {{"train_1", {{"speed", 12.5}}}}}};
+
+  TWBWriter writer;
+  writer.writeWorld(data, state);
+  writer.writeFile("lua/script_1.lua", "log.info('hello')");
+  const std::string snapshot = writer.finish();
+
+  std::vector<std::byte> memory(snapshot.size());
+  std::memcpy(memory.data(), snapshot.data(), snapshot.size());
+  REQUIRE(TWBReader::isSnapshot(memory));
+
+  TWBReader reader(memory);
+  REQUIRE(nlohmann::json::from_cbor(reader.world()) == nlohmann::json({{"uuid", data["uuid"]}, {"name", "Test"}}));
+
+  // sorted by class id:
+  using Section = TWBReader::Section;
+  REQUIRE(reader.count(Section::Objects) == 3);
+  REQUIRE(reader.string(reader.entry(Section::Objects, 0).name) == "board_1");
+  REQUIRE(reader.string(reader.entry(Section::Objects, 1).name) == "train_1");
+  REQUIRE(reader.string(reader.entry(Section::Objects, 2).name) == "train_2");
+  REQUIRE(reader.string(reader.entry(Section::Objects, 2).classId) == "train");
+  for(uint32_t i = 0; i < reader.count(Section::Objects); i++)
+    REQUIRE(reader.entry(Section::Objects, i).data.offset % TWB::alignment == 0);
+  REQUIRE(nlohmann::json::from_cbor(reader.blob(reader.entry(Section::Objects, 1).data)) == data["objects"][0]);
+
+  REQUIRE(reader.count(Section::StateObjects) == 0);
+  REQUIRE(reader.count(Section::States) == 1);
+  REQUIRE(nlohmann::json::from_cbor(reader.blob(reader.entry(Section::States, 0).data)) == state["states"]["train_1"]);
+
+  std::string file;
+  REQUIRE(reader.readFile("lua/script_1.lua", file));
+  REQUIRE(file == "log.info('hello')");
+  REQUIRE_FALSE(reader.readFile("lua/script_2.lua", file));
+
+  // truncated:
+  memory.resize(sizeof(TWB::Header) + 8);
+  REQUIRE_THROWS(TWBReader(memory));
+}
+
+TEST_CASE("TWB: save and load world", "[worldsnapshot]")
+{
+  static constexpr size_t trainCount = 10;
+
+  EventLoop::reset();
+
+  std::string uuid;
+  std::vector<std::byte> memory;
+  {
+    auto world = createWorld(trainCount);
+    uuid = world->uuid;
+    const auto path = (std::filesystem::temp_directory_path() / uuid).concat(World::dotTWB);
+    WorldSaver saver(*world, path);
+
+    std::ifstream file(path, std::ios::binary);
+    const std::string data(std::istreambuf_iterator<char>(file), {});
+    memory.resize(data.size());
+    std::memcpy(memory.data(), data.data(), data.size());
+    std::filesystem::remove(path);
+  }
+  REQUIRE(TWBReader::isSnapshot(memory));
+
+  // memory is sniffed, so a snapshot can be imported:
+  WorldLoader loader(memory);
+  auto world = loader.world();
+  REQUIRE(world);
+  REQUIRE(world->uuid.value() == uuid);
+  REQUIRE(world->trains->length == trainCount);
+  REQUIRE(world->railVehicles->length == trainCount);
+  REQUIRE(world->decoders->length == trainCount);
+  for(size_t i = 0; i < trainCount; i++)
+  {
+    auto train = world->trains->operator[](static_cast<uint32_t>(i));
+    REQUIRE(train->vehicles->length == 1);
+    auto locomotive = std::dynamic_pointer_cast<Locomotive>(train->vehicles->operator[](0));
+    REQUIRE(locomotive);
+    REQUIRE(locomotive->trains.size() == 1);
+    REQUIRE(locomotive->trains[0] == train);
+    REQUIRE(locomotive->decoder);
+  }
+}
+
+TEST_CASE("TWB: snapshot of restored world is ignored", "[worldsnapshot]")
+{
+  const auto world = std::filesystem::temp_directory_path() / "traintastic-test-stamp.ctw";
+  const auto snapshot = std::filesystem::path(world).replace_extension(World::dotTWB);
+  const auto writeWorld =
+    [&world](std::string_view data)
+    {
+      std::ofstream file(world, std::ios::binary | std::ios::trunc);
+      file.write(data.data(), static_cast<std::streamsize>(data.size()));
+    };
+  const auto writeSnapshot =
+    [&snapshot](uint64_t source)
+    {
+      TWBWriter writer;
+      writer.writeWorld({{"uuid", "00000000-0000-0000-0000-000000000001"}}, nlohmann::json::object());
+      writer.setSource(source);
+      const std::string data = writer.finish();
+      std::ofstream file(snapshot, std::ios::binary | std::ios::trunc);
+      file.write(data.data(), static_cast<std::streamsize>(data.size()));
+    };
+
+  writeWorld("saved world");
+  const auto savedTime = std::filesystem::last_write_time(world);
+  writeSnapshot(TWB::sourceStamp(world));
+  REQUIRE(TWB::sourceStamp(world) != 0);
+  REQUIRE(TWBReader::isCurrent(snapshot, world));
+
+  // restore an older backup, the snapshot is newer but doesn't belong to it:
+  writeWorld("restored backup");
+  std::filesystem::last_write_time(world, savedTime - std::chrono::hours(24));
+  REQUIRE_FALSE(TWBReader::isCurrent(snapshot, world));
+
+  // unknown source is never current:
+  writeSnapshot(0);
+  REQUIRE_FALSE(TWBReader::isCurrent(snapshot, world));
+
+  std::filesystem::remove(world);
+  REQUIRE_FALSE(TWBReader::isCurrent(snapshot, world));
+  std::filesystem::remove(snapshot);
+}
+
+TEST_CASE("TWB: startup benchmark", "[.][benchmark][worldsnapshot]")
+{
+  static constexpr size_t trainCount = 6250; // train, locomotive, decoder and decoder function: 25k objects
+
+  EventLoop::reset();
+
+  auto world = createWorld(trainCount);
+  const auto path = std::filesystem::temp_directory_path() / world->uuid.value();
+  const auto snapshotPath = std::filesystem::path(path).concat(World::dotTWB);
+  std::filesystem::create_directories(path);
+
+  BENCHMARK("Save world")
+  {
+    WorldSaver saver(*world, path);
+  };
+
+  BENCHMARK("Save snapshot")
+  {
+    WorldSaver saver(*world, snapshotPath);
+  };
+
+  world.reset();
+
+  BENCHMARK("Load world")
+  {
+    EventLoop::reset();
+    return WorldLoader(path).world()->trains->length.value();
+  };
+
+  BENCHMARK("Load snapshot")
+  {
+    EventLoop::reset();
+    return WorldLoader(snapshotPath).world()->trains->length.value();
+  };
+
+  std::filesystem::remove_all(path);
+  std::filesystem::remove(snapshotPath);
+}
@@ -49,7 +49,7 @@ struct TileLocation
     return x != other.x || y != other.y;
   }
 
-  TileLocation adjusted(int16_t dx, int16_t dy)
+  TileLocation adjusted(int16_t dx, int16_t dy) const
   {
     return {static_cast<int16_t>(x + dx), static_cast<int16_t>(y + dy)};
   }
@@ -61,7 +61,7 @@ struct TileLocationHash
 {
   std::size_t operator()(const TileLocation& key) const
   {
-    return std::hash<int16_t>()(key.x) ^ std::hash<int16_t>()(key.y);
+    return std::hash<uint32_t>()((static_cast<uint32_t>(static_cast<uint16_t>(key.x)) << 16) | static_cast<uint16_t>(key.y));
   }
 };
 
@@ -61,6 +61,7 @@ enum class LogMessage : uint32_t
   D1001_RESUME_X_MULTIPLIER_X = LogMessageOffset::debug + 1001,
   D1002_TICK_X_ERROR_X_US = LogMessageOffset::debug + 1002,
   D1003_FREEZE_X = LogMessageOffset::debug + 1003,
+  D1004_SENT_X_MESSAGES_IN_X_FRAMES_X_BYTES_AVERAGE_LATENCY_X_US_MAX_X_US = LogMessageOffset::debug + 1004,
   D2001_TX_X = LogMessageOffset::debug + 2001,
   D2002_RX_X = LogMessageOffset::debug + 2002,
   D2003_UNKNOWN_XHEADER_0XX = LogMessageOffset::debug + 2003,
@@ -158,6 +159,8 @@ enum class LogMessage : uint32_t
   W1002_SETTING_X_DOESNT_EXIST = LogMessageOffset::warning + 1002,
   W1003_READING_WORLD_X_FAILED_LIBARCHIVE_ERROR_X_X = LogMessageOffset::warning + 1003,
   W1004_SETTING_FILE_EMPTY_OR_CORRUPT_USING_DEFAULTS = LogMessageOffset::warning + 1004,
+  W1005_WRITING_WORLD_SNAPSHOT_FAILED_X = LogMessageOffset::warning + 1005,
+  W1006_LOADING_WORLD_SNAPSHOT_FAILED_X_LOADING_WORLD_INSTEAD = LogMessageOffset::warning + 1006,
   W2001_RECEIVED_MALFORMED_DATA_DROPPED_X_BYTES = LogMessageOffset::warning + 2001,
   W2002_COMMAND_STATION_DOESNT_SUPPORT_FUNCTIONS_ABOVE_FX = LogMessageOffset::warning + 2002,
   W2003_RECEIVED_MALFORMED_DATA_DROPPED_X_BYTES_X = LogMessageOffset::warning + 2003,
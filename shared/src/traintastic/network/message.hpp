@@ -23,13 +23,17 @@
 #define TRAINTASTIC_SHARED_TRAINTASTIC_NETWORK_MESSAGE_HPP
 
 #include <vector>
+#include <array>
+#include <span>
 #include <string>
 #include <atomic>
 #include <memory>
-#include <stack>
+#include <mutex>
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <cassert>
+#include <stdexcept>
 #ifdef QT_CORE_LIB
   #include <QByteArray>
   #include <QUuid>
@@ -67,6 +71,7 @@ class Message
       TableModelRowCountChanged = 22,
       TableModelSetRegion = 23,
       TableModelUpdateRegion = 24,
+      TableModelRowRemoved = 49,
 
       InputMonitorGetInputInfo = 30,
 
@@ -83,9 +88,55 @@ class Message
       ObjectListGetObjects = 47,
       CallMethod = 48,
 
+      // item addressed by index instead of name, see capabilityItemIndex:
+      ObjectSetPropertyByIndex = 50,
+      ObjectPropertyChangedByIndex = 51,
+      ObjectAttributeChangedByIndex = 52,
+      ObjectEventFiredByIndex = 53,
+
       Discover = 255,
     };
 
+    /**
+     * \brief Item index capability
+     *
+     * Sent by the client as optional capability flags in the NewSession request.
+     * If supported the server appends the index to each item of an object
+     * and sends the ...ByIndex events, the client must only use
+     * ObjectSetPropertyByIndex for items it received an index for.
+     */
+    static constexpr uint32_t capabilityItemIndex = 0x00000001;
+
+    /**
+     * \brief Combined frames capability
+     *
+     * Sent by the client as optional capability flags in the NewSession request.
+     * If supported the server may combine multiple messages into a single
+     * websocket frame, see splitFrame(), else each frame holds one message.
+     */
+    static constexpr uint32_t capabilityCombinedFrames = 0x00000002;
+
+    /**
+     * \brief Server log sequence capability
+     *
+     * Sent by the client as optional capability flags in the NewSession request.
+     * If supported the ServerLog request may contain the log id and next
+     * sequence the client has, and ServerLog events are sent in batches
+     * holding the log id, first sequence, start sequence and count. Else each
+     * event holds the number of logs to remove and the number of logs added.
+     */
+    static constexpr uint32_t capabilityServerLogSequence = 0x00000004;
+
+    /**
+     * \brief Table model row removed capability
+     *
+     * Sent by the client as optional capability flags in the NewSession request.
+     * If supported the server sends TableModelRowRemoved when a row is removed,
+     * else a TableModelRowCountChanged followed by a TableModelUpdateRegion
+     * for the rows that moved up.
+     */
+    static constexpr uint32_t capabilityTableModelRowRemoved = 0x00000008;
+
     enum class Type : uint8_t
     {
       Request = 1,
@@ -116,16 +167,125 @@ class Message
 #endif
     static_assert(sizeof(Header) == 8);
 
+    /**
+     * \brief Recycles message buffers
+     *
+     * Messages are created and destroyed at a high rate, reusing the buffers
+     * avoids a heap allocation (and reallocations while writing) per message.
+     * Buffers can be released from another thread than they're acquired on.
+     */
+    class BufferPool
+    {
+      public:
+        static constexpr size_t maxBuffers = 256;
+        static constexpr size_t minCapacity = 256;
+        static constexpr size_t maxCapacity = 64 * 1024; //!< larger buffers aren't kept, they are rare (e.g. tile data of a large board)
+
+      private:
+        std::mutex m_mutex;
+        std::vector<std::vector<uint8_t>> m_buffers;
+
+        BufferPool()
+        {
+          m_buffers.reserve(maxBuffers);
+        }
+
+      public:
+        static BufferPool& instance()
+        {
+          static BufferPool* pool = new BufferPool(); // never destroyed, static objects can hold messages
+          return *pool;
+        }
+
+        std::vector<uint8_t> acquire(size_t capacity)
+        {
+          std::vector<uint8_t> buffer;
+          {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if(!m_buffers.empty())
+            {
+              buffer = std::move(m_buffers.back());
+              m_buffers.pop_back();
+            }
+          }
+          buffer.reserve(std::max(capacity, minCapacity));
+          return buffer;
+        }
+
+        void release(std::vector<uint8_t>&& buffer)
+        {
+          if(buffer.capacity() == 0 || buffer.capacity() > maxCapacity)
+            return;
+
+          buffer.clear();
+          std::lock_guard<std::mutex> lock(m_mutex);
+          if(m_buffers.size() < maxBuffers)
+            m_buffers.emplace_back(std::move(buffer));
+        }
+
+        size_t size()
+        {
+          std::lock_guard<std::mutex> lock(m_mutex);
+          return m_buffers.size();
+        }
+    };
+
   private:
     inline static std::atomic<uint16_t> s_requestId{0};
 
+    //! Fixed capacity stack for block offsets, blocks are nested only a few levels deep.
+    class BlockStack
+    {
+      public:
+        static constexpr size_t capacity = 16;
+
+      private:
+        std::array<uint32_t, capacity> m_items;
+        size_t m_size = 0;
+
+      public:
+        bool empty() const
+        {
+          return m_size == 0;
+        }
+
+        uint32_t top() const
+        {
+          assert(!empty());
+          return m_items[m_size - 1];
+        }
+
+        void push(uint32_t value)
+        {
+          if(m_size == capacity) /*[[unlikely]]*/
+            throw std::length_error("message blocks nested too deep");
+          m_items[m_size++] = value;
+        }
+
+        void pop()
+        {
+          assert(!empty());
+          m_size--;
+        }
+    };
+
   protected:
     std::vector<uint8_t> m_data;
+    std::span<const uint8_t> m_view; //!< received bytes, if not empty the message doesn't own its data
     mutable uint32_t m_readPosition;
-    mutable std::stack<uint32_t> m_block;
+    mutable BlockStack m_block;
+
+    const uint8_t* bytes() const { return m_view.empty() ? m_data.data() : m_view.data(); }
 
-    const Header& header() const { return *reinterpret_cast<const Header*>(m_data.data()); }
-    Header& header() { return *reinterpret_cast<Header*>(m_data.data()); }
+    const Header& header() const { return *reinterpret_cast<const Header*>(bytes()); }
+    Header& header() { assert(m_view.empty()); return *reinterpret_cast<Header*>(m_data.data()); }
+
+    void append(const void* data, size_t size)
+    {
+      assert(m_view.empty());
+      const auto* p = static_cast<const uint8_t*>(data);
+      m_data.insert(m_data.end(), p, p + size);
+    }
 
     void updateDataSize()
     {
@@ -135,6 +295,30 @@ class Message
   public:
     using Length = uint32_t;
 
+    //! \brief Number of bytes write() appends for the value
+    template<typename T>
+    static size_t writeSize(const T& value)
+    {
+#ifdef QT_CORE_LIB
+      if constexpr(std::is_same_v<T,QByteArray>)
+        return sizeof(Length) + static_cast<size_t>(value.size());
+      else
+#endif
+      if constexpr(std::is_same_v<T,std::string_view> || std::is_same_v<T,std::string>)
+        return sizeof(Length) + value.size();
+      else if constexpr(std::is_trivially_copyable_v<T>)
+        return sizeof(value);
+      else
+        static_assert(sizeof(T) != sizeof(T));
+    }
+
+    //! \brief Number of bytes the writes of all values append, use it to create a message with enough capacity
+    template<typename T, typename... Ts>
+    static size_t writeSize(const T& value, const Ts&... values)
+    {
+      return writeSize(value) + writeSize(values...);
+    }
+
     static std::unique_ptr<Message> newRequest(Command command, size_t capacity = 0)
     {
       return std::make_unique<Message>(command, Type::Request, ++s_requestId, capacity);
@@ -182,36 +366,86 @@ class Message
       return std::make_unique<Message>(command, Type::Event, 0, capacity);
     }
 
+    /**
+     * \brief Split received bytes into messages
+     * \param[in] frame One or more messages, not aligned
+     * \param[in] func Called with the bytes (header and data) of each complete message
+     * \return Number of bytes used, the remainder is an incomplete message
+     */
+    template<class Func>
+    static size_t splitFrame(std::span<const uint8_t> frame, Func&& func)
+    {
+      size_t offset = 0;
+      while(frame.size() - offset >= sizeof(Header))
+      {
+        Header header;
+        std::memcpy(&header, frame.data() + offset, sizeof(Header));
+        const size_t messageSize = sizeof(Header) + header.dataSize;
+        if(frame.size() - offset < messageSize)
+          break;
+        func(frame.subspan(offset, messageSize));
+        offset += messageSize;
+      }
+      return offset;
+    }
+
     Message(const Header& _header) :
-      m_data(sizeof(Header) + _header.dataSize, 0),
+      m_data(BufferPool::instance().acquire(sizeof(Header) + _header.dataSize)),
       m_readPosition{0}
     {
+      m_data.resize(sizeof(Header) + _header.dataSize);
       header() = _header;
     }
 
+    //! \brief Copy a received message
+    //! \param[in] message Header and data, size must match the header
+    Message(const void* message, size_t size) :
+      m_data(BufferPool::instance().acquire(size)),
+      m_readPosition{0}
+    {
+      assert(size >= sizeof(Header));
+      append(message, size);
+      assert(dataSize() == size - sizeof(Header));
+    }
+
+    //! \brief Read a received message without copying it
+    //! \param[in] message Header and data, size must match the header
+    //! \note The message bytes must outlive the message, the message can't be written to.
+    explicit Message(std::span<const uint8_t> message) :
+      m_view{message},
+      m_readPosition{0}
+    {
+      assert(m_view.size() >= sizeof(Header));
+      assert(dataSize() == m_view.size() - sizeof(Header));
+    }
+
     Message(Command command, Type type, uint16_t requestId, size_t capacity = 0) :
-      m_data(sizeof(Header), 0),
+      m_data(BufferPool::instance().acquire(sizeof(Header) + capacity)),
       m_readPosition{0}
     {
+      m_data.resize(sizeof(Header));
+
       header().command = command;
       header().flags.reserved = 0;
       header().flags.error = 0;
       header().flags.type = static_cast<uint8_t>(type);
       header().requestId = requestId;
       header().dataSize = 0;
-
-      if(capacity > 0)
-        m_data.reserve(sizeof(Header) + capacity);
     }
 
     Message(uint32_t size) :
-      m_data(size, 0),
+      m_data(BufferPool::instance().acquire(size)),
       m_readPosition{0}
     {
+      m_data.resize(size);
     }
 
+    Message(const Message&) = delete;
+    Message& operator =(const Message&) = delete;
+
     ~Message()
     {
+      BufferPool::instance().release(std::move(m_data));
     }
 
     inline std::unique_ptr<Message> response(size_t capacity = 0) const
@@ -246,20 +480,28 @@ class Message
     inline bool isError() const { return header().flags.error; }
     inline uint16_t requestId() const { return header().requestId; }
 
-    const void* operator*() const { return m_data.data(); }
-    void* operator*() { return m_data.data(); }
-    size_t size() const { return m_data.size(); }
+    const void* operator*() const { return bytes(); }
+
+    //! \brief Message bytes for sending, stores the data size in the header, write() doesn't
+    void* operator*()
+    {
+      assert(m_view.empty());
+      updateDataSize();
+      return m_data.data();
+    }
 
-    const void* data() const { return m_data.data() + sizeof(Header); }
-    void* data() { return m_data.data() + sizeof(Header); }
-    uint32_t dataSize() const { return header().dataSize; }
+    size_t size() const { return m_view.empty() ? m_data.size() : m_view.size(); }
 
-    const void* current() const { return m_data.data() + sizeof(Header) + m_readPosition; }
+    const void* data() const { return bytes() + sizeof(Header); }
+    void* data() { assert(m_view.empty()); return m_data.data() + sizeof(Header); }
+    uint32_t dataSize() const { return m_view.empty() ? static_cast<uint32_t>(m_data.size() - sizeof(Header)) : header().dataSize; }
+
+    const void* current() const { return bytes() + sizeof(Header) + m_readPosition; }
 
     template<typename T>
     void read(T& value) const
     {
-      const uint8_t* p = m_data.data() + sizeof(Header) + m_readPosition;
+      const uint8_t* p = bytes() + sizeof(Header) + m_readPosition;
 
 #ifdef QT_CORE_LIB
       if constexpr(std::is_same_v<T,QUuid>)
@@ -311,7 +553,7 @@ class Message
       if constexpr(std::is_trivially_copyable_v<T>)
       {
         value.resize(length);
-        memcpy(value.data(), m_data.data() + sizeof(Header) + m_readPosition, length * sizeof(T));
+        memcpy(value.data(), bytes() + sizeof(Header) + m_readPosition, length * sizeof(T));
         m_readPosition += length * sizeof(T);
       }
       else
@@ -355,34 +597,27 @@ class Message
     template<typename T>
     void write(const T& value)
     {
-      const size_t oldSize = m_data.size();
-
 #ifdef QT_CORE_LIB
       if constexpr(std::is_same_v<T,QByteArray>)
       {
-        m_data.resize(oldSize + sizeof(Length) + value.size());
         const Length length = value.size();
-        memcpy(m_data.data() + oldSize, &length, sizeof(length));
-        memcpy(m_data.data() + oldSize + sizeof(Length), value.data(), value.size());
+        append(&length, sizeof(length));
+        append(value.data(), value.size());
       }
       else
 #endif
       if constexpr(std::is_same_v<T,std::string_view> || std::is_same_v<T,std::string>)
       {
-        m_data.resize(oldSize + sizeof(Length) + value.size());
         const Length length = static_cast<Length>(value.size());
-        memcpy(m_data.data() + oldSize, &length, sizeof(length));
-        memcpy(m_data.data() + oldSize + sizeof(Length), value.data(), value.size());
+        append(&length, sizeof(length));
+        append(value.data(), value.size());
       }
       else if constexpr(std::is_trivially_copyable_v<T>)
       {
-        m_data.resize(oldSize + sizeof(value));
-        memcpy(m_data.data() + oldSize, &value, sizeof(value));
+        append(&value, sizeof(value));
       }
       else
         static_assert(sizeof(T) != sizeof(T));
-
-      updateDataSize();
     }
 
     template<typename T>
@@ -397,27 +632,22 @@ class Message
       else if constexpr(std::is_trivially_copyable_v<T>)
       {
         write(static_cast<Length>(value.size())); // number of elements, not bytes!
-        const Length dataSize = value.size() * sizeof(T);
-        const size_t oldSize = m_data.size();
-        m_data.resize(oldSize + dataSize);
-        memcpy(m_data.data() + oldSize, value.data(), dataSize);
+        append(value.data(), value.size() * sizeof(T));
       }
       else
         static_assert(sizeof(T) != sizeof(T));
-
-      updateDataSize();
     }
 
     void writeBlock()
     {
       write<uint32_t>(0);
-      m_block.push(header().dataSize);
+      m_block.push(dataSize());
     }
 
     void writeBlockEnd()
     {
       assert(!m_block.empty());
-      const uint32_t blockSize = header().dataSize - m_block.top();
+      const uint32_t blockSize = dataSize() - m_block.top();
       memcpy(m_data.data() + sizeof(Header) + m_block.top() - sizeof(uint32_t), &blockSize, sizeof(blockSize));
       m_block.pop();
     }